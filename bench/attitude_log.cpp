@@ -0,0 +1,72 @@
+/**
+ * Writes one million float quaternion records into memory, then scans them back through the zero-copy chunk views.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <cmath>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kRecords = 1000000;
+
+struct VectorSink {
+    std::vector<unsigned char>* buffer;
+    bool operator()(const void* data, size_t size) const {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        buffer->insert(buffer->end(), bytes, bytes + size);
+        return true;
+    }
+};
+} // namespace
+
+int main() {
+    std::vector<float> w(kRecords), x(kRecords), y(kRecords), z(kRecords);
+    std::vector<double> t(kRecords);
+    for(size_t i = 0; i < kRecords; i++) {
+        const double s = static_cast<double>(i);
+        const Quaternion<HAMILTON, float> q = Quaternion<HAMILTON, float>{}.boxplus(Vector3<float>{float(std::sin(s)), float(std::cos(s)), 0.5f});
+        w[i] = q.w();
+        x[i] = q.x();
+        y[i] = q.y();
+        z[i] = q.z();
+        t[i] = s * 1e-3;
+    }
+    const QuaternionBatch<HAMILTON, const float> batch{w.data(), x.data(), y.data(), z.data(), kRecords};
+
+    std::vector<unsigned char> buffer;
+    buffer.reserve(kRecords * 32);
+    std::vector<AttitudeLogIndexEntry> index(kRecords / 4096 + 1);
+
+    auto write = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            buffer.clear();
+            AttitudeLogWriter<HAMILTON, float, VectorSink, 4096>* writer = new AttitudeLogWriter<HAMILTON, float, VectorSink, 4096>{VectorSink{&buffer}, index.data(), index.size()};
+            writer->append(t.data(), batch);
+            writer->close();
+            delete writer;
+        }
+        bench::doNotOptimize(buffer[0]);
+    };
+
+    auto read = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            const AttitudeLogReader reader{buffer.data(), buffer.size()};
+            float sum = 0.f;
+            for(size_t chunk = 0; chunk < reader.chunks(); chunk++) {
+                const QuaternionBatch<HAMILTON, const float> q = reader.quaternions<HAMILTON, float>(chunk);
+                for(size_t k = 0; k < q.size(); k++) {
+                    sum += q.w()[k];
+                }
+            }
+            bench::doNotOptimize(sum);
+        }
+    };
+
+    bench::report("write 1M records", bench::measure(write, 1, 5));
+    bench::report("read 1M records", bench::measure(read, 1, 5));
+    std::printf("  %zu bytes, %.1f bytes per record\n", buffer.size(), static_cast<double>(buffer.size()) / static_cast<double>(kRecords));
+    return 0;
+}
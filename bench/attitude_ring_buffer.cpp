@@ -0,0 +1,127 @@
+/**
+ * AttitudeRingBuffer: push and interpolated query costs on a full buffer of 1024 samples,
+ * queries while a producer thread pushes continuously, and the latency from push to visibility
+ * for a producer at 8 kHz and a spinning reader.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <tinyso3/AttitudeRingBuffer.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCapacity = 1024;
+
+using Buffer = AttitudeRingBuffer<HAMILTON, double>;
+
+Buffer::Sample sample(double t) {
+    return Buffer::Sample{t, Quaternion<HAMILTON, double>::Exp(Vector3<double>{0.3, -0.2, 0.5} * t), AngularVelocity<double>{0.6, -0.4, 1.0}};
+}
+
+double now(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+} // namespace
+
+int main() {
+    std::vector<Buffer::Slot> slots(kCapacity);
+
+    {
+        Buffer buffer{slots.data(), kCapacity};
+        double t = 0.0;
+        auto push = [&](size_t iterations) {
+            for(size_t i = 0; i < iterations; i++) {
+                t += 1e-3;
+                buffer.push(sample(t));
+            }
+        };
+        // The sample construction (an Exp) is included, as a producer would compute it.
+        bench::report("push, including the sample", bench::measure(push, 100000));
+    }
+
+    const Interpolation interpolations[] = {Interpolation::SLERP, Interpolation::NLERP, Interpolation::HERMITE};
+    const char* names[] = {"at, SLERP", "at, NLERP", "at, HERMITE"};
+    for(size_t m = 0; m < 3; m++) {
+        Buffer buffer{slots.data(), kCapacity, interpolations[m]};
+        for(size_t k = 0; k < kCapacity; k++) {
+            buffer.push(sample(1e-3 * static_cast<double>(k)));
+        }
+        size_t k = 0;
+        auto at = [&](size_t iterations) {
+            Quaternion<HAMILTON, double> q;
+            for(size_t i = 0; i < iterations; i++) {
+                k = (k * 1103515245u + 12345u) & 0xFFFFFu;
+                buffer.at(1.023 * static_cast<double>(k) / 1048576.0, q);
+                bench::doNotOptimize(q);
+            }
+        };
+        bench::report(names[m], bench::measure(at, 100000));
+    }
+
+    {
+        Buffer buffer{slots.data(), kCapacity};
+        std::atomic<bool> stop{false};
+        std::thread producer([&] {
+            for(size_t k = 0; !stop.load(std::memory_order_relaxed); k++) {
+                buffer.push(sample(1e-3 * static_cast<double>(k)));
+            }
+        });
+        while(buffer.pushed() < kCapacity) {
+            std::this_thread::yield();
+        }
+
+        auto at = [&](size_t iterations) {
+            Quaternion<HAMILTON, double> q;
+            Buffer::Sample newest = sample(0.0);
+            for(size_t i = 0; i < iterations; i++) {
+                buffer.latest(newest);
+                buffer.at(newest.time - 0.5, q);
+                bench::doNotOptimize(q);
+            }
+        };
+        bench::report("latest and at, during pushes", bench::measure(at, 100000));
+        stop.store(true);
+        producer.join();
+    }
+
+    {
+        // The producer stamps each sample with the clock at push, the reader notes when it first sees it.
+        Buffer buffer{slots.data(), kCapacity};
+        const auto start = std::chrono::steady_clock::now();
+        std::atomic<bool> stop{false};
+        std::thread producer([&] {
+            for(size_t k = 0; k < 4000; k++) {
+                while(now(start) < 1.25e-4 * static_cast<double>(k + 1)) {
+                }
+                buffer.push(sample(now(start)));
+            }
+            stop.store(true);
+        });
+
+        std::vector<double> latencies;
+        latencies.reserve(4000);
+        size_t seen = 0;
+        Buffer::Sample newest;
+        while(!stop.load(std::memory_order_relaxed)) {
+            const size_t pushed = buffer.pushed();
+            if(pushed != seen && buffer.latest(newest)) {
+                latencies.push_back(now(start) - newest.time);
+                seen = pushed;
+            }
+        }
+        producer.join();
+
+        std::sort(latencies.begin(), latencies.end());
+        if(!latencies.empty()) {
+            bench::report("push to visibility, median", 1e9 * latencies[latencies.size() / 2]);
+            bench::report("push to visibility, 99th percentile", 1e9 * latencies[latencies.size() * 99 / 100]);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file bench.hpp
+ *
+ * Minimal timing helpers shared by the benchmarks.
+ *
+ * Each measurement runs the function once untimed to warm caches and branch predictors, then times
+ * a number of repetitions and keeps their median, their minimum and their median absolute deviation.
+ * Pinning the calling thread to its current CPU with pin() before measuring avoids migrations between samples.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace bench {
+/**
+ * Prevents the compiler from discarding a computed value.
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Pins the calling thread to the CPU it is running on, returns false where unsupported.
+ */
+inline bool pin() {
+#if defined(__linux__)
+    const int cpu = sched_getcpu();
+    if(cpu < 0) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<size_t>(cpu), &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Time per iteration in nanoseconds over the repetitions of a measurement.
+ */
+struct Timing {
+    double median;
+    double minimum;
+    double deviation; // median absolute deviation from the median
+};
+
+/**
+ * Runs function(iterations) once to warm up, then repeatedly, and returns the time per iteration.
+ */
+template<typename Function>
+Timing run(Function&& function, size_t iterations, size_t repetitions = 7) {
+    function(iterations);
+
+    std::vector<double> samples;
+    for(size_t r = 0; r < repetitions; r++) {
+        const auto start = std::chrono::steady_clock::now();
+        function(iterations);
+        const auto stop = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(iterations));
+    }
+
+    std::sort(samples.begin(), samples.end());
+    Timing timing;
+    timing.median = samples[samples.size() / 2];
+    timing.minimum = samples.front();
+    for(double& sample : samples) {
+        sample = std::fabs(sample - timing.median);
+    }
+    std::sort(samples.begin(), samples.end());
+    timing.deviation = samples[samples.size() / 2];
+    return timing;
+}
+
+/**
+ * Runs function(iterations) once to warm up, then repeatedly, and returns the median time per iteration in nanoseconds.
+ */
+template<typename Function>
+double measure(Function&& function, size_t iterations, size_t repetitions = 7) {
+    return run(function, iterations, repetitions).median;
+}
+
+inline void report(const char* name, double ns_per_iteration) {
+    std::printf("%-56s %12.2f ns %14.0f op/s\n", name, ns_per_iteration, 1e9 / ns_per_iteration);
+}
+
+inline void report(const char* name, const Timing& timing) {
+    std::printf("%-56s %12.2f ns %14.0f op/s  min %10.2f ns  +-%5.1f%%\n", name, timing.median, 1e9 / timing.median, timing.minimum,
+                100.0 * timing.deviation / timing.median);
+}
+} // namespace bench
@@ -0,0 +1,156 @@
+/**
+ * Every direct conversion between Euler angles of each convention and sequence, rotation matrices and quaternions
+ * of each convention and axis angles, in float, double and long double, over 256 rotations cycled through.
+ * Benchmarks whose name does not contain the first argument, if given, are skipped.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCount = 256; // a power of two
+const size_t kIterations = 20000;
+const char* filter = nullptr;
+
+template<typename T>
+struct Describe;
+
+template<>
+struct Describe<INTRINSIC> {
+    static const char* Name() { return "INTRINSIC"; }
+};
+template<>
+struct Describe<EXTRINSIC> {
+    static const char* Name() { return "EXTRINSIC"; }
+};
+template<>
+struct Describe<ACTIVE> {
+    static const char* Name() { return "ACTIVE"; }
+};
+template<>
+struct Describe<PASSIVE> {
+    static const char* Name() { return "PASSIVE"; }
+};
+template<>
+struct Describe<HAMILTON> {
+    static const char* Name() { return "HAMILTON"; }
+};
+template<>
+struct Describe<JPL> {
+    static const char* Name() { return "JPL"; }
+};
+
+template<typename Convention, typename Sequence, typename Type>
+struct Describe<Euler<Convention, Sequence, Type>> {
+    static void Name(char* name, size_t size) {
+        snprintf(name, size, "Euler<%s, %c%c%c>", Describe<Convention>::Name(), "XYZ"[static_cast<int>(Sequence::Axis1)],
+                 "XYZ"[static_cast<int>(Sequence::Axis2)], "XYZ"[static_cast<int>(Sequence::Axis3)]);
+    }
+};
+template<typename Convention, typename Type>
+struct Describe<RotationMatrix<Convention, Type>> {
+    static void Name(char* name, size_t size) { snprintf(name, size, "RotationMatrix<%s>", Describe<Convention>::Name()); }
+};
+template<typename Convention, typename Type>
+struct Describe<Quaternion<Convention, Type>> {
+    static void Name(char* name, size_t size) { snprintf(name, size, "Quaternion<%s>", Describe<Convention>::Name()); }
+};
+template<typename Type>
+struct Describe<AxisAngle<Type>> {
+    static void Name(char* name, size_t size) { snprintf(name, size, "AxisAngle"); }
+};
+
+template<typename Type>
+AxisAngle<Type> rotation(size_t i) {
+    const double s = static_cast<double>(i);
+    const Vector3<Type> axis{Type(std::sin(1.7 * s)), Type(std::cos(2.3 * s)), Type(std::sin(0.37 * s) + 0.1)};
+    return AxisAngle<Type>{axis.unit(), Type(3.0 * std::fabs(std::sin(0.91 * s)))};
+}
+
+template<typename Type, typename From, typename To>
+void conversion(const char* type) {
+    char from[48], to[48], name[128];
+    Describe<From>::Name(from, sizeof(from));
+    Describe<To>::Name(to, sizeof(to));
+    snprintf(name, sizeof(name), "%s -> %s, %s", from, to, type);
+    if(filter != nullptr && strstr(name, filter) == nullptr) {
+        return;
+    }
+
+    std::vector<From> inputs;
+    inputs.reserve(kCount);
+    for(size_t i = 0; i < kCount; i++) {
+        inputs.push_back(From{rotation<Type>(i)});
+    }
+
+    auto convert = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            const To out{inputs[n & (kCount - 1)]};
+            bench::doNotOptimize(out);
+        }
+    };
+    bench::report(name, bench::run(convert, kIterations));
+}
+
+template<typename Type, typename From, typename To>
+void conversions(const char* type) {
+    conversion<Type, From, To>(type);
+    conversion<Type, To, From>(type);
+}
+
+template<typename Type, typename Convention, typename Sequence>
+void euler(const char* type) {
+    using EulerType = Euler<Convention, Sequence, Type>;
+    conversions<Type, EulerType, RotationMatrix<ACTIVE, Type>>(type);
+    conversions<Type, EulerType, RotationMatrix<PASSIVE, Type>>(type);
+    conversions<Type, EulerType, Quaternion<HAMILTON, Type>>(type);
+    conversions<Type, EulerType, Quaternion<JPL, Type>>(type);
+    conversions<Type, EulerType, AxisAngle<Type>>(type);
+}
+
+template<typename Type, typename Convention>
+void eulers(const char* type) {
+    euler<Type, Convention, XYZ>(type);
+    euler<Type, Convention, XZY>(type);
+    euler<Type, Convention, YXZ>(type);
+    euler<Type, Convention, YZX>(type);
+    euler<Type, Convention, ZXY>(type);
+    euler<Type, Convention, ZYX>(type);
+    euler<Type, Convention, XYX>(type);
+    euler<Type, Convention, XZX>(type);
+    euler<Type, Convention, YXY>(type);
+    euler<Type, Convention, YZY>(type);
+    euler<Type, Convention, ZXZ>(type);
+    euler<Type, Convention, ZYZ>(type);
+}
+
+template<typename Type>
+void run(const char* type) {
+    conversions<Type, RotationMatrix<ACTIVE, Type>, Quaternion<HAMILTON, Type>>(type);
+    conversions<Type, RotationMatrix<PASSIVE, Type>, Quaternion<JPL, Type>>(type);
+    conversions<Type, AxisAngle<Type>, RotationMatrix<ACTIVE, Type>>(type);
+    conversions<Type, AxisAngle<Type>, RotationMatrix<PASSIVE, Type>>(type);
+    conversions<Type, AxisAngle<Type>, Quaternion<HAMILTON, Type>>(type);
+    conversions<Type, AxisAngle<Type>, Quaternion<JPL, Type>>(type);
+    eulers<Type, INTRINSIC>(type);
+    eulers<Type, EXTRINSIC>(type);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    filter = argc > 1 ? argv[1] : nullptr;
+    if(!bench::pin()) {
+        printf("could not pin to a CPU\n");
+    }
+
+    run<float>("float");
+    run<double>("double");
+    run<long double>("long double");
+    return 0;
+}
@@ -0,0 +1,53 @@
+/**
+ * Euler rate from angular velocity, through a rotation matrix against the Euler overload and the batch API.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+int main() {
+    using EulerType = Euler<INTRINSIC, ZYX, double>;
+    using EulerRateType = EulerRate<INTRINSIC, ZYX, double>;
+
+    const size_t N = 4096;
+    std::vector<EulerType> euler(N);
+    std::vector<RotationMatrix<PASSIVE, double>> dcm(N);
+    std::vector<AngularVelocity<double>> angular_velocity(N);
+    std::vector<EulerRateType> euler_rate(N);
+
+    for(size_t i = 0; i < N; i++) {
+        const double s = static_cast<double>(i) / static_cast<double>(N);
+        euler[i] = EulerType{-3.0 + 6.0 * s, 1.2 * s - 0.6, 0.5 - s};
+        dcm[i] = RotationMatrix<PASSIVE, double>{euler[i]};
+        angular_velocity[i] = AngularVelocity<double>{0.1 + s, -0.3, 0.7 * s};
+    }
+
+    auto from_dcm = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            euler_rate[i % N] = EulerRateType{dcm[i % N], angular_velocity[i % N]};
+        }
+        bench::doNotOptimize(euler_rate[0](0));
+    };
+
+    auto from_euler = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            euler_rate[i % N] = EulerRateType{euler[i % N], angular_velocity[i % N]};
+        }
+        bench::doNotOptimize(euler_rate[0](0));
+    };
+
+    auto batch = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i += N) {
+            EulerRateType::FromAngularVelocities(euler.data(), angular_velocity.data(), euler_rate.data(), N);
+        }
+        bench::doNotOptimize(euler_rate[0](0));
+    };
+
+    bench::report("EulerRate(dcm, angular_velocity)", bench::measure(from_dcm, N * 100));
+    bench::report("EulerRate(euler, angular_velocity)", bench::measure(from_euler, N * 100));
+    bench::report("EulerRate::FromAngularVelocities", bench::measure(batch, N * 100));
+    return 0;
+}
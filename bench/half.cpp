@@ -0,0 +1,72 @@
+/**
+ * Conversion of 4096 values between float and the Half and BFloat16 storage types, scalar and by arrays.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCount = 4096;
+const size_t kIterations = 20000;
+} // namespace
+
+int main() {
+    std::vector<float> values(kCount), out(kCount);
+    for(size_t i = 0; i < kCount; i++) {
+        values[i] = static_cast<float>(i % 97) * 0.0173f - 0.8f;
+    }
+    std::vector<Half> half(kCount);
+    std::vector<BFloat16> bfloat(kCount);
+
+    auto narrowHalf = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            Half::Narrow(values.data(), half.data(), kCount);
+            bench::doNotOptimize(half[n % kCount]);
+        }
+    };
+    auto widenHalf = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            Half::Widen(half.data(), out.data(), kCount);
+            bench::doNotOptimize(out[n % kCount]);
+        }
+    };
+    auto narrowHalfScalar = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            for(size_t i = 0; i < kCount; i++) {
+                half[i] = Half(values[i]);
+            }
+            bench::doNotOptimize(half[n % kCount]);
+        }
+    };
+    auto widenHalfScalar = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            for(size_t i = 0; i < kCount; i++) {
+                out[i] = half[i];
+            }
+            bench::doNotOptimize(out[n % kCount]);
+        }
+    };
+    auto narrowBFloat = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            BFloat16::Narrow(values.data(), bfloat.data(), kCount);
+            bench::doNotOptimize(bfloat[n % kCount]);
+        }
+    };
+    auto widenBFloat = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            BFloat16::Widen(bfloat.data(), out.data(), kCount);
+            bench::doNotOptimize(out[n % kCount]);
+        }
+    };
+
+    bench::report("Half::Narrow, per value", bench::measure(narrowHalf, kIterations) / double(kCount));
+    bench::report("Half::Widen, per value", bench::measure(widenHalf, kIterations) / double(kCount));
+    bench::report("Half(float) loop, per value", bench::measure(narrowHalfScalar, kIterations) / double(kCount));
+    bench::report("float(Half) loop, per value", bench::measure(widenHalfScalar, kIterations) / double(kCount));
+    bench::report("BFloat16::Narrow, per value", bench::measure(narrowBFloat, kIterations) / double(kCount));
+    bench::report("BFloat16::Widen, per value", bench::measure(widenBFloat, kIterations) / double(kCount));
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * LatestAttitude of a RotationMatrix<double>: store and load costs, then the time per load of each reader
+ * and per store of the writer with 1 to N reader threads and a writer storing continuously,
+ * against the same value behind a std::mutex. The maximum number of readers may be given as the first argument.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <tinyso3/LatestAttitude.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+using Rotation = RotationMatrix<ACTIVE, double>;
+
+const double kSeconds = 0.2;
+
+// The same interface over a mutex, for comparison.
+class Locked {
+public:
+    void store(const Rotation& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _value = value;
+    }
+    Rotation load() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _value;
+    }
+
+private:
+    mutable std::mutex _mutex;
+    Rotation _value;
+};
+
+template<typename Cell>
+void contend(Cell& cell, size_t readers, const char* name) {
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> loads{0};
+    std::vector<std::thread> threads;
+    for(size_t r = 0; r < readers; r++) {
+        threads.emplace_back([&] {
+            size_t n = 0;
+            double sum = 0.0;
+            while(!stop.load(std::memory_order_relaxed)) {
+                sum += cell.load()(0, 0);
+                n++;
+            }
+            bench::doNotOptimize(sum);
+            loads += n;
+        });
+    }
+
+    const Rotation a = Rotation{Euler<INTRINSIC, ZYX, double>{0.1, 0.2, 0.3}};
+    const Rotation b = Rotation{Euler<INTRINSIC, ZYX, double>{0.3, 0.2, 0.1}};
+    size_t stores = 0;
+    const auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    while(elapsed < kSeconds) {
+        for(size_t i = 0; i < 64; i++) {
+            cell.store(stores++ % 2 == 0 ? a : b);
+        }
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    stop.store(true);
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+
+    char label[96];
+    std::snprintf(label, sizeof(label), "  %s, load per reader", name);
+    bench::report(label, 1e9 * elapsed * double(readers) / double(loads.load()));
+    std::snprintf(label, sizeof(label), "  %s, store", name);
+    bench::report(label, 1e9 * elapsed / double(stores));
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    {
+        LatestAttitude<Rotation> latest{Rotation::Identity()};
+        const Rotation value = Rotation{Euler<INTRINSIC, ZYX, double>{0.1, 0.2, 0.3}};
+        auto store = [&](size_t iterations) {
+            for(size_t i = 0; i < iterations; i++) {
+                latest.store(value);
+            }
+        };
+        auto load = [&](size_t iterations) {
+            for(size_t i = 0; i < iterations; i++) {
+                bench::doNotOptimize(latest.load());
+            }
+        };
+        bench::report("store, uncontended", bench::measure(store, 1000000));
+        bench::report("load, uncontended", bench::measure(load, 1000000));
+    }
+
+    const size_t hardware = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+    const size_t maximum = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : (hardware > 1 ? hardware - 1 : 1);
+    for(size_t readers = 1; readers <= maximum; readers = readers < maximum && 2 * readers > maximum ? maximum : 2 * readers) {
+        std::printf("%zu readers, 1 writer\n", readers);
+        LatestAttitude<Rotation> latest{Rotation::Identity()};
+        contend(latest, readers, "LatestAttitude");
+        Locked locked;
+        contend(locked, readers, "std::mutex");
+    }
+    return 0;
+}
@@ -0,0 +1,157 @@
+/**
+ * normalize, log, Exp, slerp and products of quaternions and rotation matrices of each convention,
+ * EigenSolver and Matrix products, in float, double and long double, over 256 inputs cycled through.
+ * Benchmarks whose name does not contain the first argument, if given, are skipped.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCount = 256; // a power of two
+const size_t kIterations = 20000;
+const char* filter = nullptr;
+
+template<typename Type>
+Vector3<Type> vector(size_t i) {
+    const double s = static_cast<double>(i);
+    return Vector3<Type>{Type(std::sin(1.7 * s)), Type(std::cos(2.3 * s)), Type(std::sin(0.37 * s) + 0.1)};
+}
+
+// Second operands, computed before timing.
+template<typename Type>
+struct Operands {
+    Vector3<Type> vectors[kCount];
+    Type scalars[kCount];
+
+    Operands() {
+        for(size_t i = 0; i < kCount; i++) {
+            vectors[i] = vector<Type>(i + kCount);
+            scalars[i] = Type(std::fabs(std::sin(0.91 * static_cast<double>(i))));
+        }
+    }
+};
+
+template<typename Type>
+const Operands<Type>& operands() {
+    static const Operands<Type> operands;
+    return operands;
+}
+
+// Reports operate(input i, input i + 1, i) over inputs made by make(i), unless filtered out.
+template<typename Make, typename Operation>
+void operation(const char* what, const char* convention, const char* type, Make&& make, Operation&& operate) {
+    char name[128];
+    snprintf(name, sizeof(name), "%s%s%s, %s", what, convention[0] != '\0' ? " " : "", convention, type);
+    if(filter != nullptr && strstr(name, filter) == nullptr) {
+        return;
+    }
+
+    std::vector<decltype(make(size_t(0)))> inputs;
+    inputs.reserve(kCount);
+    for(size_t i = 0; i < kCount; i++) {
+        inputs.push_back(make(i));
+    }
+
+    auto run = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            const size_t i = n & (kCount - 1);
+            const auto out = operate(inputs[i], inputs[(i + 1) & (kCount - 1)], i);
+            bench::doNotOptimize(out);
+        }
+    };
+    bench::report(name, bench::run(run, kIterations));
+}
+
+template<typename Type, typename Convention>
+void quaternion(const char* convention, const char* type) {
+    using QuaternionType = Quaternion<Convention, Type>;
+    auto unit = [](size_t i) { return QuaternionType::Exp(vector<Type>(i)); };
+    auto scaled = [](size_t i) { return QuaternionType{Vector<4, Type>{QuaternionType::Exp(vector<Type>(i))} * Type(1.001)}; };
+
+    const Operands<Type>& other = operands<Type>();
+
+    operation("Quaternion normalize", convention, type, scaled, [](QuaternionType q, const QuaternionType&, size_t) {
+        q.normalize();
+        return q;
+    });
+    operation("Quaternion log", convention, type, unit, [](const QuaternionType& q, const QuaternionType&, size_t) { return q.log(); });
+    operation("Quaternion Exp", convention, type, vector<Type>, [](const Vector3<Type>& v, const Vector3<Type>&, size_t) { return QuaternionType::Exp(v); });
+    operation("Quaternion slerp", convention, type, unit, [&](QuaternionType q, const QuaternionType& to, size_t i) { return q.slerp(to, other.scalars[i]); });
+    operation("Quaternion * Quaternion", convention, type, unit, [](const QuaternionType& q, const QuaternionType& p, size_t) { return q * p; });
+    operation("Quaternion * Vector3", convention, type, unit, [&](const QuaternionType& q, const QuaternionType&, size_t i) { return q * other.vectors[i]; });
+}
+
+template<typename Type, typename Convention>
+void rotationMatrix(const char* convention, const char* type) {
+    using RotationMatrixType = RotationMatrix<Convention, Type>;
+    auto unit = [](size_t i) { return RotationMatrixType::Exp(vector<Type>(i).hat()); };
+    auto perturbed = [&](size_t i) { return RotationMatrixType{unit(i) + SquareMatrix<3, Type>::Identity() * Type(1e-3)}; };
+
+    const Operands<Type>& other = operands<Type>();
+
+    operation("RotationMatrix normalize", convention, type, perturbed, [](RotationMatrixType R, const RotationMatrixType&, size_t) {
+        R.normalize();
+        return R;
+    });
+    operation("RotationMatrix log", convention, type, unit, [](const RotationMatrixType& R, const RotationMatrixType&, size_t) { return R.log(); });
+    operation("RotationMatrix Exp", convention, type, vector<Type>, [](const Vector3<Type>& v, const Vector3<Type>&, size_t) { return RotationMatrixType::Exp(v.hat()); });
+    operation("RotationMatrix * RotationMatrix", convention, type, unit, [](const RotationMatrixType& R, const RotationMatrixType& P, size_t) { return R * P; });
+    operation("RotationMatrix * Vector3", convention, type, unit,
+              [&](const RotationMatrixType& R, const RotationMatrixType&, size_t i) { return Vector3<Type>{R * other.vectors[i]}; });
+}
+
+template<size_t M, typename Type>
+Matrix<M, M, Type> square(size_t i) {
+    Matrix<M, M, Type> A;
+    for(size_t r = 0; r < M; r++) {
+        for(size_t c = 0; c < M; c++) {
+            A(r, c) = Type(std::sin(static_cast<double>(i * M * M + r * M + c)));
+        }
+    }
+    return A;
+}
+
+template<typename Type>
+void matrix(const char* type) {
+    const Operands<Type>& other = operands<Type>();
+
+    operation("EigenSolver", "", type, [](size_t i) {
+        const SquareMatrix<3, Type> A{square<3, Type>(i)};
+        return SquareMatrix<3, Type>{A * A.transpose()};
+    },
+              [](const SquareMatrix<3, Type>& A, const SquareMatrix<3, Type>&, size_t) { return EigenSolver<Type>{}(A); });
+    operation("Matrix<3, 3> * Vector3", "", type, square<3, Type>,
+              [&](const Matrix<3, 3, Type>& A, const Matrix<3, 3, Type>&, size_t i) { return A * Matrix<3, 1, Type>{other.vectors[i]}; });
+    operation("Matrix<3, 3> * Matrix<3, 3>", "", type, square<3, Type>, [](const Matrix<3, 3, Type>& A, const Matrix<3, 3, Type>& B, size_t) { return A * B; });
+    operation("Matrix<4, 4> * Matrix<4, 4>", "", type, square<4, Type>, [](const Matrix<4, 4, Type>& A, const Matrix<4, 4, Type>& B, size_t) { return A * B; });
+    operation("Matrix<6, 6> * Matrix<6, 6>", "", type, square<6, Type>, [](const Matrix<6, 6, Type>& A, const Matrix<6, 6, Type>& B, size_t) { return A * B; });
+}
+
+template<typename Type>
+void run(const char* type) {
+    quaternion<Type, HAMILTON>("HAMILTON", type);
+    quaternion<Type, JPL>("JPL", type);
+    rotationMatrix<Type, ACTIVE>("ACTIVE", type);
+    rotationMatrix<Type, PASSIVE>("PASSIVE", type);
+    matrix<Type>(type);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    filter = argc > 1 ? argv[1] : nullptr;
+    if(!bench::pin()) {
+        printf("could not pin to a CPU\n");
+    }
+
+    run<float>("float");
+    run<double>("double");
+    run<long double>("long double");
+    return 0;
+}
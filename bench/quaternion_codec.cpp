@@ -0,0 +1,67 @@
+/**
+ * Batch encode and decode of 4096 quaternions for each bit budget, with the measured worst-case angular error.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <cmath>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCount = 4096;
+
+template<size_t Bits>
+void run() {
+    using Codec = QuaternionCodec<Bits, HAMILTON, float>;
+
+    std::vector<float> w(kCount), x(kCount), y(kCount), z(kCount), dw(kCount), dx(kCount), dy(kCount), dz(kCount);
+    const QuaternionBatch<HAMILTON, float> q{w.data(), x.data(), y.data(), z.data(), kCount};
+    const QuaternionBatch<HAMILTON, float> decoded{dw.data(), dx.data(), dy.data(), dz.data(), kCount};
+    for(size_t i = 0; i < kCount; i++) {
+        const double s = static_cast<double>(i);
+        q.set(i, Quaternion<HAMILTON, float>{float(std::sin(1.7 * s)), float(std::cos(2.3 * s)), float(std::sin(0.37 * s)), float(std::cos(3.1 * s))}.unit());
+    }
+    std::vector<typename Codec::Code> codes(kCount);
+
+    auto encode = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            Codec::Encode(q, codes.data());
+        }
+        bench::doNotOptimize(codes[0]);
+    };
+
+    auto decode = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            Codec::Decode(codes.data(), decoded);
+        }
+        bench::doNotOptimize(dw[0]);
+    };
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "encode %zu x %zu bits", kCount, Bits);
+    bench::report(name, bench::measure(encode, 100));
+    std::snprintf(name, sizeof(name), "decode %zu x %zu bits", kCount, Bits);
+    bench::report(name, bench::measure(decode, 100));
+
+    double error = 0.0;
+    for(size_t i = 0; i < kCount; i++) {
+        double dot = 0.0, n1 = 0.0, n2 = 0.0;
+        for(size_t k = 0; k < 4; k++) {
+            dot += double(Vector<4, float>{q[i]}(k)) * double(Vector<4, float>{decoded[i]}(k));
+            n1 += double(Vector<4, float>{q[i]}(k)) * double(Vector<4, float>{q[i]}(k));
+            n2 += double(Vector<4, float>{decoded[i]}(k)) * double(Vector<4, float>{decoded[i]}(k));
+        }
+        error = std::fmax(error, 2.0 * std::acos(std::fmin(std::fabs(dot) / std::sqrt(n1 * n2), 1.0)));
+    }
+    std::printf("  max angular error %.3g rad (bound %.3g rad)\n", error, double(Codec::MaxAngularError()));
+}
+} // namespace
+
+int main() {
+    run<32>();
+    run<48>();
+    run<64>();
+    return 0;
+}
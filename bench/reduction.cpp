@@ -0,0 +1,103 @@
+/**
+ * Sum of the rotation matrices of 65536 rotations: a naive serial loop against MatrixSum NAIVE and KAHAN
+ * along the ReductionTree, serial and on a ThreadPool, with the largest elementwise error of each against
+ * the long double sum of the same float matrices (floats near 65536 are 0.0078 apart). The number of threads may be given as the first argument.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <tinyso3/ThreadPool.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCount = 65536;
+const size_t kIterations = 200;
+
+template<typename Summation>
+using Statistics = RotationStatistics<HAMILTON, float, Summation>;
+
+double error(const SquareMatrix<3, float>& sum, const SquareMatrix<3, long double>& reference) {
+    double largest = 0.0;
+    for(size_t i = 0; i < 3; i++) {
+        for(size_t j = 0; j < 3; j++) {
+            const double e = double(fabsl(static_cast<long double>(sum(i, j)) - reference(i, j)));
+            largest = e > largest ? e : largest;
+        }
+    }
+    return largest;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t threads = argc > 1 ? static_cast<size_t>(atoi(argv[1])) : 4;
+
+    std::vector<float> w(kCount), x(kCount), y(kCount), z(kCount);
+    const QuaternionBatch<HAMILTON, float> batch{w.data(), x.data(), y.data(), z.data(), kCount};
+    SquareMatrix<3, long double> reference{};
+    for(size_t i = 0; i < kCount; i++) {
+        const float t = static_cast<float>(i);
+        batch.set(i, Quaternion<HAMILTON, float>::Exp(Vector3<float>{0.3f + 0.001f * sinf(t), 0.2f * cosf(0.7f * t), 0.1f}));
+        const RotationMatrix<ACTIVE, float> R{batch[i]};
+        for(size_t r = 0; r < 3; r++) {
+            for(size_t c = 0; c < 3; c++) {
+                reference(r, c) += static_cast<long double>(R(r, c));
+            }
+        }
+    }
+    const QuaternionBatch<HAMILTON, const float> q{batch};
+    ThreadPool pool{threads};
+
+    SquareMatrix<3, float> naive_loop;
+    auto naiveLoop = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            SquareMatrix<3, float> sum{};
+            for(size_t i = 0; i < kCount; i++) {
+                sum += RotationMatrix<ACTIVE, float>{q[i]};
+            }
+            naive_loop = sum;
+            bench::doNotOptimize(naive_loop);
+        }
+    };
+
+    SquareMatrix<3, float> naive_tree, kahan_tree, kahan_parallel;
+    auto naiveTree = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            naive_tree = Statistics<NAIVE>::RotationSum(q).value();
+            bench::doNotOptimize(naive_tree);
+        }
+    };
+    auto kahanTree = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            kahan_tree = Statistics<KAHAN>::RotationSum(q).value();
+            bench::doNotOptimize(kahan_tree);
+        }
+    };
+    auto kahanParallel = [&](size_t iterations) {
+        using Sum = Statistics<KAHAN>::SumType;
+        for(size_t n = 0; n < iterations; n++) {
+            kahan_parallel = pool.parallelReduce(
+                                   kCount, Sum{}, [&](size_t begin, size_t end) { return Statistics<KAHAN>::RotationSum(q, begin, end); },
+                                   [](Sum a, const Sum& b) {
+                                       a.merge(b);
+                                       return a;
+                                   },
+                                   Statistics<KAHAN>::LeafSize, Chunking::DETERMINISTIC)
+                               .value();
+            bench::doNotOptimize(kahan_parallel);
+        }
+    };
+
+    bench::report("naive loop", bench::measure(naiveLoop, kIterations));
+    bench::report("NAIVE tree", bench::measure(naiveTree, kIterations));
+    bench::report("KAHAN tree", bench::measure(kahanTree, kIterations));
+    bench::report("KAHAN tree, thread pool", bench::measure(kahanParallel, kIterations));
+
+    printf("largest error: naive loop %.3g, NAIVE tree %.3g, KAHAN tree %.3g, KAHAN tree on %zu threads %.3g (%s serial)\n",
+           error(naive_loop, reference), error(naive_tree, reference), error(kahan_tree, reference), threads, error(kahan_parallel, reference),
+           error(kahan_parallel, reference) == error(kahan_tree, reference) ? "identical to" : "differs from");
+    return 0;
+}
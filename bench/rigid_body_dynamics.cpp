@@ -0,0 +1,54 @@
+/**
+ * Torque-free tumbling of 4096 bodies sharing one inertia tensor, stepped as a structure of arrays batch.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <cmath>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kBodies = 4096;
+
+template<typename Scheme, typename Type>
+void run(const char* scheme, const char* type) {
+    SquareMatrix<3, Type> inertia{};
+    inertia(0, 0) = Type(1.0);
+    inertia(1, 1) = Type(2.0);
+    inertia(2, 2) = Type(3.5);
+    inertia(0, 1) = inertia(1, 0) = Type(0.2);
+    const RigidBodyDynamics<Scheme, HAMILTON, Type> dynamics{inertia};
+
+    std::vector<Type> qw(kBodies, Type(1)), qx(kBodies), qy(kBodies), qz(kBodies);
+    std::vector<Type> wx(kBodies), wy(kBodies), wz(kBodies);
+    for(size_t i = 0; i < kBodies; i++) {
+        const double s = static_cast<double>(i);
+        wx[i] = Type(std::sin(s));
+        wy[i] = Type(1.5 * std::cos(0.3 * s));
+        wz[i] = Type(-0.4 + 0.1 * std::sin(2.0 * s));
+    }
+    const QuaternionBatch<HAMILTON, Type> q{qw.data(), qx.data(), qy.data(), qz.data(), kBodies};
+    const Vector3Batch<Type> w{wx.data(), wy.data(), wz.data(), kBodies};
+
+    auto step = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            dynamics.step(q, w, Type(1e-3));
+        }
+        bench::doNotOptimize(qw[0]);
+    };
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s, %zu bodies (%s)", scheme, kBodies, type);
+    bench::report(name, bench::measure(step, 20));
+}
+} // namespace
+
+int main() {
+    run<SPLITTING, float>("splitting", "float");
+    run<SPLITTING, double>("splitting", "double");
+    run<MIDPOINT, float>("midpoint", "float");
+    run<MIDPOINT, double>("midpoint", "double");
+    return 0;
+}
@@ -0,0 +1,65 @@
+/**
+ * Batch quantization of 4096 quaternions and cell center evaluation, for growing grid resolutions.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <cmath>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCount = 4096;
+
+template<size_t Resolution>
+void run() {
+    using Grid = RotationGrid<Resolution, HAMILTON, float>;
+
+    std::vector<float> w(kCount), x(kCount), y(kCount), z(kCount), cw(kCount), cx(kCount), cy(kCount), cz(kCount);
+    const QuaternionBatch<HAMILTON, float> q{w.data(), x.data(), y.data(), z.data(), kCount};
+    for(size_t i = 0; i < kCount; i++) {
+        const double s = static_cast<double>(i);
+        q.set(i, Quaternion<HAMILTON, float>{float(std::sin(1.7 * s)), float(std::cos(2.3 * s)), float(std::sin(0.37 * s)), float(std::cos(3.1 * s))}.unit());
+    }
+    std::vector<typename Grid::Cell> cells(kCount);
+
+    auto quantize = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            Grid::Quantize(QuaternionBatch<HAMILTON, const float>{w.data(), x.data(), y.data(), z.data(), kCount}, cells.data());
+        }
+        bench::doNotOptimize(cells[0]);
+    };
+
+    auto center = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            Grid::CellCenter(cells.data(), QuaternionBatch<HAMILTON, float>{cw.data(), cx.data(), cy.data(), cz.data(), kCount});
+        }
+        bench::doNotOptimize(cw[0]);
+    };
+
+    typename Grid::Cell neighbors[Grid::MaxNeighbors];
+    auto neighborhood = [&](size_t iterations) {
+        size_t count = 0;
+        for(size_t i = 0; i < iterations; i++) {
+            count += Grid::Neighbors(cells[i % kCount], neighbors);
+        }
+        bench::doNotOptimize(count);
+    };
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "quantize %zu, %zu cells", kCount, Grid::Size);
+    bench::report(name, bench::measure(quantize, 100));
+    std::snprintf(name, sizeof(name), "cell center %zu, %zu cells", kCount, Grid::Size);
+    bench::report(name, bench::measure(center, 100));
+    std::snprintf(name, sizeof(name), "neighbors, %zu cells", Grid::Size);
+    bench::report(name, bench::measure(neighborhood, 10000));
+}
+} // namespace
+
+int main() {
+    run<8>();
+    run<64>();
+    run<512>();
+    return 0;
+}
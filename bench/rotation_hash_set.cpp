@@ -0,0 +1,57 @@
+/**
+ * Deduplication of 10^6 rotations, half of them repeated with small perturbations, for several tolerances.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <cmath>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCount = 1000000;
+const size_t kCapacity = size_t(1) << 21;
+
+using Set = RotationHashSet<HAMILTON, float>;
+} // namespace
+
+int main() {
+    // Uniform rotations (Shoemake 1992), each odd one a perturbed copy of the previous.
+    std::vector<float> w(kCount), x(kCount), y(kCount), z(kCount);
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    const QuaternionBatch<HAMILTON, float> q{w.data(), x.data(), y.data(), z.data(), kCount};
+    for(size_t i = 0; i < kCount; i++) {
+        double u[3];
+        for(size_t k = 0; k < 3; k++) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            u[k] = static_cast<double>(state >> 11) / 9007199254740992.0;
+        }
+        const double a = std::sqrt(1.0 - u[0]), b = std::sqrt(u[0]);
+        const Quaternion<HAMILTON, float> r{float(a * std::sin(2.0 * M_PI * u[1])), float(a * std::cos(2.0 * M_PI * u[1])),
+                                            float(b * std::sin(2.0 * M_PI * u[2])), float(b * std::cos(2.0 * M_PI * u[2]))};
+        q.set(i, i % 2 == 1 ? q[i - 1].boxplus(Vector3<float>{1e-4f, -2e-4f, 1e-4f}) : r);
+    }
+
+    std::vector<Set::Slot> slots(kCapacity);
+    std::vector<uint32_t> ids(kCount);
+    const float tolerances[] = {1e-3f, 1e-2f, 1e-1f};
+    for(const float tolerance : tolerances) {
+        size_t unique = 0;
+        auto insert = [&](size_t iterations) {
+            for(size_t i = 0; i < iterations; i++) {
+                Set set{slots.data(), kCapacity, tolerance};
+                unique = set.insert(QuaternionBatch<HAMILTON, const float>{q}, ids.data());
+            }
+            bench::doNotOptimize(ids[0]);
+        };
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "insert 10^6, tolerance %g rad", double(tolerance));
+        bench::report(name, bench::measure(insert, 1, 3) / double(kCount));
+        std::printf("  %zu unique\n", unique);
+    }
+    return 0;
+}
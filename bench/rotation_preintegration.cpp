@@ -0,0 +1,72 @@
+/**
+ * Preintegration of a synthetic 1 kHz gyroscope stream between keyframes 100 ms apart,
+ * comparing the first-order bias correction against re-integration.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <cmath>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kRate = 1000;
+const size_t kKeyframe = 100; // samples between keyframes
+
+template<typename Type>
+void run(const char* type) {
+    std::vector<AngularVelocity<Type>> stream;
+    for(size_t k = 0; k < kRate; k++) {
+        const double t = static_cast<double>(k) / static_cast<double>(kRate);
+        stream.push_back(AngularVelocity<Type>{Type(0.4 * std::sin(3.0 * t)), Type(-0.8 + 0.3 * std::cos(2.0 * t)), Type(1.1 * std::sin(t))});
+    }
+
+    const Type dt = Type(1) / Type(kRate);
+    const Vector3<Type> bias{Type(0.01), Type(-0.02), Type(0.03)};
+    const Vector3<Type> updated = bias + Vector3<Type>{Type(2e-3), Type(1e-3), Type(-3e-3)};
+
+    RotationPreintegration<ACTIVE, Type> preintegration{bias, Type(1e-3)};
+    for(size_t k = 0; k < kKeyframe; k++) {
+        preintegration.integrate(stream[k], dt);
+    }
+
+    auto integrate = [&](size_t iterations) {
+        RotationPreintegration<ACTIVE, Type> p{bias, Type(1e-3)};
+        for(size_t i = 0; i < iterations; i++) {
+            p.integrate(stream[i % kRate], dt);
+        }
+        bench::doNotOptimize(p.deltaRotation()(0, 0));
+    };
+
+    auto correct = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            bench::doNotOptimize(preintegration.deltaRotation(updated)(0, 0));
+        }
+    };
+
+    auto reintegrate = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            RotationPreintegration<ACTIVE, Type> p{updated, Type(1e-3)};
+            for(size_t k = 0; k < kKeyframe; k++) {
+                p.integrate(stream[k], dt);
+            }
+            bench::doNotOptimize(p.deltaRotation()(0, 0));
+        }
+    };
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "integrate (%s)", type);
+    bench::report(name, bench::measure(integrate, 100000));
+    std::snprintf(name, sizeof(name), "bias correction (%s)", type);
+    bench::report(name, bench::measure(correct, 100000));
+    std::snprintf(name, sizeof(name), "re-integration of %zu samples (%s)", kKeyframe, type);
+    bench::report(name, bench::measure(reintegrate, 1000));
+}
+} // namespace
+
+int main() {
+    run<float>("float");
+    run<double>("double");
+    return 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * Repeated vector alignment problems solved with Gauss-Newton and Levenberg-Marquardt,
+ * as in calibration sweeps over many candidate correspondences.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <cmath>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCorrespondences = 64;
+
+template<typename Type>
+struct Alignment {
+    const Vector3<Type>* v;
+    const Vector3<Type>* u;
+    size_t count;
+
+    size_t size() const { return count; }
+
+    void operator()(const RotationMatrix<ACTIVE, Type>& R, size_t begin, size_t end, Vector3<Type>* residuals, SquareMatrix<3, Type>* jacobians) const {
+        for(size_t i = begin; i < end; i++) {
+            residuals[i - begin] = R * v[i] - u[i];
+            if(jacobians != nullptr) {
+                jacobians[i - begin] = -(R * v[i].hat());
+            }
+        }
+    }
+};
+
+template<typename Type>
+void run(const char* type) {
+    const RotationMatrix<ACTIVE, Type> truth = RotationMatrix<ACTIVE, Type>::Exp(Vector3<Type>{Type(0.3), Type(-0.9), Type(1.4)}.hat());
+
+    std::vector<Vector3<Type>> v, u;
+    for(size_t i = 0; i < kCorrespondences; i++) {
+        const double s = static_cast<double>(i);
+        v.push_back(Vector3<Type>{Type(std::sin(s)), Type(std::cos(1.3 * s)), Type(std::sin(0.7 * s + 1.0))});
+        u.push_back(truth * v.back() + Vector3<Type>{Type(1e-3 * std::cos(5.0 * s)), Type(1e-3 * std::sin(3.0 * s)), Type(0)});
+    }
+    const Alignment<Type> problem{v.data(), u.data(), kCorrespondences};
+
+    char name[64];
+    const Optimization methods[] = {Optimization::GAUSS_NEWTON, Optimization::LEVENBERG_MARQUARDT};
+    const char* labels[] = {"gauss-newton", "levenberg-marquardt"};
+    for(size_t m = 0; m < 2; m++) {
+        typename RotationSolver<ACTIVE, Type>::Options options;
+        options.method = methods[m];
+        RotationSolver<ACTIVE, Type> solver{options};
+
+        auto solve = [&](size_t iterations) {
+            for(size_t i = 0; i < iterations; i++) {
+                bench::doNotOptimize(solver.solve(problem, RotationMatrix<ACTIVE, Type>::Identity())(0, 0));
+            }
+        };
+
+        std::snprintf(name, sizeof(name), "%s, %zu residuals (%s)", labels[m], kCorrespondences, type);
+        bench::report(name, bench::measure(solve, 2000));
+        std::printf("  iterations %zu, evaluations %zu, rejected %zu\n", solver.statistics().iterations, solver.statistics().evaluations, solver.statistics().rejected_steps);
+    }
+}
+} // namespace
+
+int main() {
+    run<float>("float");
+    run<double>("double");
+    return 0;
+}
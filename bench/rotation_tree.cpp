@@ -0,0 +1,126 @@
+/**
+ * Vantage point tree over 10^6 rotations: serial and threaded construction, k nearest neighbor and radius queries,
+ * against a linear scan with acos distances.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCount = 1000000;
+const size_t kQueries = 256;
+const size_t kNeighbors = 10;
+
+using Tree = RotationTree<HAMILTON, float>;
+
+// Uniformly distributed rotations (Shoemake 1992).
+void uniform(uint64_t& state, float& w, float& x, float& y, float& z) {
+    double u[3];
+    for(size_t k = 0; k < 3; k++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        u[k] = static_cast<double>(state >> 11) / 9007199254740992.0;
+    }
+    const double a = std::sqrt(1.0 - u[0]), b = std::sqrt(u[0]);
+    w = float(a * std::sin(2.0 * M_PI * u[1]));
+    x = float(a * std::cos(2.0 * M_PI * u[1]));
+    y = float(b * std::sin(2.0 * M_PI * u[2]));
+    z = float(b * std::cos(2.0 * M_PI * u[2]));
+}
+} // namespace
+
+int main() {
+    std::vector<float> w(kCount), x(kCount), y(kCount), z(kCount), qw(kQueries), qx(kQueries), qy(kQueries), qz(kQueries);
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    for(size_t i = 0; i < kCount; i++) {
+        uniform(state, w[i], x[i], y[i], z[i]);
+    }
+    for(size_t i = 0; i < kQueries; i++) {
+        uniform(state, qw[i], qx[i], qy[i], qz[i]);
+    }
+    const QuaternionBatch<HAMILTON, const float> points{w.data(), x.data(), y.data(), z.data(), kCount};
+    const QuaternionBatch<HAMILTON, const float> queries{qw.data(), qx.data(), qy.data(), qz.data(), kQueries};
+
+    std::vector<Tree::Node> nodes(kCount);
+    Tree tree{nodes.data(), kCount};
+
+    auto build = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            tree.build(points);
+        }
+        bench::doNotOptimize(nodes[0]);
+    };
+
+    const size_t threads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+    auto threaded_build = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            Tree::Subtree subtrees[64];
+            const size_t count = tree.buildTop(points, 6, subtrees);
+            std::vector<std::thread> workers;
+            for(size_t t = 0; t < threads; t++) {
+                workers.emplace_back([&, t]() {
+                    for(size_t s = t; s < count; s += threads) {
+                        tree.buildSubtree(subtrees[s]);
+                    }
+                });
+            }
+            for(std::thread& worker : workers) {
+                worker.join();
+            }
+        }
+        bench::doNotOptimize(nodes[0]);
+    };
+
+    std::vector<Tree::Neighbor> neighbors(kQueries * kNeighbors);
+    auto nearest = [&](size_t iterations) {
+        for(size_t i = 0; i < iterations; i++) {
+            tree.nearest(queries, kNeighbors, neighbors.data());
+        }
+        bench::doNotOptimize(neighbors[0]);
+    };
+
+    std::vector<Tree::Neighbor> within(kCount);
+    auto radius = [&](size_t iterations) {
+        size_t count = 0;
+        for(size_t i = 0; i < iterations; i++) {
+            for(size_t q = 0; q < kQueries; q++) {
+                count += tree.radius(queries[q], 0.1f, within.data(), kCount);
+            }
+        }
+        bench::doNotOptimize(count);
+    };
+
+    // Nearest rotation of each query by a linear scan.
+    auto scan = [&](size_t iterations) {
+        size_t best = 0;
+        for(size_t i = 0; i < iterations; i++) {
+            for(size_t q = 0; q < kQueries; q++) {
+                float closest = 10.0f;
+                for(size_t p = 0; p < kCount; p++) {
+                    const float angle = 2.0f * std::acos(std::fmin(std::fabs(qw[q] * w[p] + qx[q] * x[p] + qy[q] * y[p] + qz[q] * z[p]), 1.0f));
+                    best = angle < closest ? p : best;
+                    closest = angle < closest ? angle : closest;
+                }
+            }
+        }
+        bench::doNotOptimize(best);
+    };
+
+    char name[64];
+    bench::report("build 10^6", bench::measure(build, 1, 3));
+    std::snprintf(name, sizeof(name), "build 10^6, %zu threads", threads);
+    bench::report(name, bench::measure(threaded_build, 1, 3));
+    std::snprintf(name, sizeof(name), "%zu nearest x %zu queries", kNeighbors, kQueries);
+    bench::report(name, bench::measure(nearest, 1));
+    std::snprintf(name, sizeof(name), "radius 0.1 rad x %zu queries", kQueries);
+    bench::report(name, bench::measure(radius, 1));
+    std::snprintf(name, sizeof(name), "linear scan nearest x %zu queries", kQueries);
+    bench::report(name, bench::measure(scan, 1, 1));
+    return 0;
+}
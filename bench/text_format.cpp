@@ -0,0 +1,99 @@
+/**
+ * Formatting and parsing of 4096 doubles and floats with TextFormat, against snprintf and strtod / strtof.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCount = 4096;
+
+inline void strto(const char* text, double& value) { value = std::strtod(text, nullptr); }
+inline void strto(const char* text, float& value) { value = std::strtof(text, nullptr); }
+
+template<typename Type>
+void run(const char* type, int precision) {
+    std::vector<Type> values(kCount), parsed(kCount);
+    for(size_t i = 0; i < kCount; i++) {
+        const double s = static_cast<double>(i);
+        values[i] = static_cast<Type>(std::sin(1.7 * s) * std::pow(10.0, std::fmod(s, 9.0) - 4.0));
+    }
+    std::vector<char> text(kCount * (TextFormat<Type>::MaxLength + 1));
+    std::vector<size_t> offsets(kCount + 1);
+
+    auto format = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            size_t offset = 0;
+            for(size_t i = 0; i < kCount; i++) {
+                offsets[i] = offset;
+                offset += TextFormat<Type>::Format(values[i], text.data() + offset);
+                text[offset++] = '\0';
+            }
+            offsets[kCount] = offset;
+        }
+        bench::doNotOptimize(text[0]);
+    };
+
+    auto snprintf_format = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            char* out = text.data();
+            for(size_t i = 0; i < kCount; i++) {
+                out += std::snprintf(out, TextFormat<Type>::MaxLength, "%.*g", precision, static_cast<double>(values[i])) + 1;
+            }
+        }
+        bench::doNotOptimize(text[0]);
+    };
+
+    auto parse = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            for(size_t i = 0; i < kCount; i++) {
+                const char* cursor = text.data() + offsets[i];
+                TextFormat<Type>::Parse(cursor, text.data() + offsets[i + 1], parsed[i]);
+            }
+        }
+        bench::doNotOptimize(parsed[0]);
+    };
+
+    auto strtod_parse = [&](size_t iterations) {
+        for(size_t n = 0; n < iterations; n++) {
+            for(size_t i = 0; i < kCount; i++) {
+                strto(text.data() + offsets[i], parsed[i]);
+            }
+        }
+        bench::doNotOptimize(parsed[0]);
+    };
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "TextFormat format %zu %s", kCount, type);
+    bench::report(name, bench::measure(format, 20));
+    std::snprintf(name, sizeof(name), "snprintf %%.%dg %zu %s", precision, kCount, type);
+    bench::report(name, bench::measure(snprintf_format, 20));
+
+    format(1); // shortest text, parsed by both
+    std::snprintf(name, sizeof(name), "TextFormat parse %zu %s", kCount, type);
+    bench::report(name, bench::measure(parse, 20));
+    std::snprintf(name, sizeof(name), "strtod / strtof %zu %s", kCount, type);
+    bench::report(name, bench::measure(strtod_parse, 20));
+
+    size_t mismatches = 0;
+    for(size_t i = 0; i < kCount; i++) {
+        mismatches += parsed[i] != values[i];
+    }
+    parse(1);
+    for(size_t i = 0; i < kCount; i++) {
+        mismatches += parsed[i] != values[i];
+    }
+    std::printf("  %zu round trip mismatches, %.1f characters per value\n", mismatches, static_cast<double>(offsets[kCount]) / kCount - 1.0);
+}
+} // namespace
+
+int main() {
+    run<double>("double", 17);
+    run<float>("float", 9);
+    return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * Scaling of batch kernels over a ThreadPool from 1 to the hardware concurrency threads, on 10^6 rotations:
+ * quaternion to rotation matrix conversion, rotation of points, and a deterministic quaternion sum.
+ * The maximum number of threads may be given as the first argument.
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <tinyso3/ThreadPool.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "bench.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCount = 1000000;
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<float> w(kCount), x(kCount), y(kCount), z(kCount);
+    std::vector<float> px(kCount), py(kCount), pz(kCount), rx(kCount), ry(kCount), rz(kCount);
+    std::vector<float> elements(9 * kCount);
+    const QuaternionBatch<HAMILTON, float> q{w.data(), x.data(), y.data(), z.data(), kCount};
+    const Vector3Batch<float> points{px.data(), py.data(), pz.data(), kCount};
+    const Vector3Batch<float> rotated{rx.data(), ry.data(), rz.data(), kCount};
+    float* const columns[9] = {&elements[0], &elements[kCount], &elements[2 * kCount], &elements[3 * kCount], &elements[4 * kCount],
+                               &elements[5 * kCount], &elements[6 * kCount], &elements[7 * kCount], &elements[8 * kCount]};
+    const RotationMatrixBatch<ACTIVE, float> matrices{columns, kCount};
+    for(size_t i = 0; i < kCount; i++) {
+        const float angle = 0.37f * static_cast<float>(i % 1000);
+        q.set(i, Quaternion<HAMILTON, float>::Exp(Vector3<float>{std::cos(angle), std::sin(angle), 0.3f} * angle));
+        points.set(i, Vector3<float>{1.0f, 0.5f * static_cast<float>(i % 7), -2.0f});
+    }
+
+    const size_t hardware = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+    const size_t maximum = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : hardware;
+    for(size_t threads = 1; threads <= maximum; threads = threads < maximum && 2 * threads > maximum ? maximum : 2 * threads) {
+        ThreadPool pool{threads};
+        std::printf("%zu threads\n", threads);
+
+        auto convert = [&](size_t iterations) {
+            for(size_t n = 0; n < iterations; n++) {
+                pool.parallelFor(kCount, [&](size_t begin, size_t end) {
+                    for(size_t i = begin; i < end; i++) {
+                        matrices.set(i, RotationMatrix<ACTIVE, float>{q[i]});
+                    }
+                });
+            }
+            bench::doNotOptimize(elements[kCount / 2]);
+        };
+        auto rotate = [&](size_t iterations) {
+            for(size_t n = 0; n < iterations; n++) {
+                pool.parallelFor(kCount, [&](size_t begin, size_t end) {
+                    for(size_t i = begin; i < end; i++) {
+                        rotated.set(i, q[i] * points[i]);
+                    }
+                });
+            }
+            bench::doNotOptimize(rx[kCount / 2]);
+        };
+        auto sum = [&](size_t iterations) {
+            for(size_t n = 0; n < iterations; n++) {
+                const Vector<4, double> total = pool.parallelReduce(kCount, Vector<4, double>{}, [&](size_t begin, size_t end) {
+                    Vector<4, double> s{};
+                    for(size_t i = begin; i < end; i++) {
+                        const double sign = w[i] < 0.0f ? -1.0 : 1.0;
+                        s += Vector<4, double>{sign * double(w[i]), sign * double(x[i]), sign * double(y[i]), sign * double(z[i])};
+                    }
+                    return s;
+                },
+                                                                    [](const Vector<4, double>& a, const Vector<4, double>& b) { return Vector<4, double>{a + b}; });
+                bench::doNotOptimize(total);
+            }
+        };
+
+        bench::report("  quaternion to rotation matrix, 10^6", bench::measure(convert, 5));
+        bench::report("  rotate points, 10^6", bench::measure(rotate, 5));
+        bench::report("  deterministic quaternion sum, 10^6", bench::measure(sum, 5));
+    }
+    return 0;
+}
@@ -13,12 +13,10 @@
 
 #include "Euler.hpp"
 #include "RotationMatrix.hpp"
+#include "EulerRate.hpp"
 
 namespace tinyso3 {
 
-template<typename EulerConvention, typename EulerSequence, typename Type>
-class EulerRate;
-
 template<typename Type>
 class AngularVelocity : public Vector3<Type> {
 protected:
@@ -32,6 +30,13 @@ class AngularVelocity : public Vector3<Type> {
 
     template<typename EulerConvention, typename EulerSequence>
     AngularVelocity(const Euler<EulerConvention, EulerSequence, Type>& euler, const EulerRate<EulerConvention, EulerSequence, Type>& euler_rate);
+
+    /**
+     * Static Methods
+     */
+    // angular_velocity[i] = AngularVelocity{euler[i], euler_rate[i]}
+    template<typename EulerConvention, typename EulerSequence>
+    static void FromEulerRates(const Euler<EulerConvention, EulerSequence, Type>* euler, const EulerRate<EulerConvention, EulerSequence, Type>* euler_rate, AngularVelocity* angular_velocity, size_t count);
 };
 
 using AngularVelocityf = AngularVelocity<float>;
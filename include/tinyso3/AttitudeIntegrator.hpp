@@ -0,0 +1,90 @@
+/**
+ * @file AttitudeIntegrator.hpp
+ *
+ * Attitude propagation from body(local) frame angular velocity samples.
+ *
+ * The angular velocity within a step of length dt is either linear between w0 and w1,
+ * or quadratic through w0, wm and w1 where wm is sampled at dt / 2.
+ * The scheme is selected at compile time with one of the AttitudeIntegration tags,
+ *
+ * EXPONENTIAL : q [+] (w_mean * dt), exact for a constant angular velocity.
+ *               w_mean is the Simpson mean (w0 + 4 wm + w1) / 6. (2nd order)
+ * RK4         : Classical Runge-Kutta on the quaternion ODE using w0, wm and w1. (4th order)
+ * MAGNUS4     : q [+] phi, phi = dt / 2 * (wg1 + wg2) + sqrt(3) / 12 * dt^2 * (wg1 x wg2),
+ *               where wg1, wg2 are the angular velocities at the Gauss points. (4th order)
+ *               The cross product is the coning correction, with a linear angular velocity it reduces to dt^2 / 12 * (w0 x w1).
+ *
+ * [+] is Quaternion::boxplus. The result is renormalized lazily,
+ * only when the squared norm drifts from 1 by more than the tolerance, using the sqrt-free update q * (3 - |q|^2) / 2.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "Quaternion.hpp"
+#include "AngularVelocity.hpp"
+#include "QuaternionBatch.hpp"
+#include "Vector3Batch.hpp"
+
+namespace tinyso3 {
+template<typename AttitudeIntegrationScheme = MAGNUS4, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class AttitudeIntegrator {
+    static_assert(is_attitude_integration<AttitudeIntegrationScheme>::value, "AttitudeIntegrationScheme must be one of the AttitudeIntegration types (EXPONENTIAL, RK4, MAGNUS4).");
+
+public:
+    using Scheme = AttitudeIntegrationScheme;
+    using QuaternionType = Quaternion<QuaternionConvention, Type>;
+
+    /**
+     * Constructors
+     */
+    AttitudeIntegrator(const Type& tolerance = epsilon<Type>()) :
+    _tolerance(tolerance) {}
+
+    /**
+     * Advances q by dt, the angular velocity is linear from w0 to w1.
+     */
+    QuaternionType step(const QuaternionType& q, const AngularVelocity<Type>& w0, const AngularVelocity<Type>& w1, const Type& dt) const;
+
+    /**
+     * Advances q by dt, the angular velocity is quadratic through w0, wm (at dt / 2) and w1.
+     */
+    QuaternionType step(const QuaternionType& q, const AngularVelocity<Type>& w0, const AngularVelocity<Type>& wm, const AngularVelocity<Type>& w1, const Type& dt) const;
+
+    /**
+     * Advances every attitude of the batch in place, q[i] = step(q[i], w0[i], w1[i], dt).
+     * All batches must have the same size.
+     */
+    void step(const QuaternionBatch<QuaternionConvention, Type>& q, const Vector3Batch<const Type>& w0, const Vector3Batch<const Type>& w1, const Type& dt) const;
+    void step(const QuaternionBatch<QuaternionConvention, Type>& q, const Vector3Batch<const Type>& w0, const Vector3Batch<const Type>& wm, const Vector3Batch<const Type>& w1, const Type& dt) const;
+
+    /**
+     * Renormalizes q only if its squared norm differs from 1 by more than the tolerance.
+     */
+    QuaternionType renormalize(const QuaternionType& q) const;
+
+    inline const Type& tolerance() const { return _tolerance; }
+
+private:
+    QuaternionType integrate(EXPONENTIAL, const QuaternionType& q, const Vector3<Type>& w0, const Vector3<Type>& wm, const Vector3<Type>& w1, const Type& dt) const;
+    QuaternionType integrate(RK4, const QuaternionType& q, const Vector3<Type>& w0, const Vector3<Type>& wm, const Vector3<Type>& w1, const Type& dt) const;
+    QuaternionType integrate(MAGNUS4, const QuaternionType& q, const Vector3<Type>& w0, const Vector3<Type>& wm, const Vector3<Type>& w1, const Type& dt) const;
+
+    // Time derivative of q for the body frame angular velocity w.
+    static inline QuaternionType derivative(const QuaternionType& q, const Vector3<Type>& w);
+    // q + k * s, without normalization.
+    static inline QuaternionType add(const QuaternionType& q, const QuaternionType& k, const Type& s);
+
+    Type _tolerance;
+};
+
+template<typename AttitudeIntegrationScheme = MAGNUS4, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using AttitudeIntegratorf = AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, float>;
+template<typename AttitudeIntegrationScheme = MAGNUS4, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using AttitudeIntegratord = AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, double>;
+template<typename AttitudeIntegrationScheme = MAGNUS4, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using AttitudeIntegratorld = AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, long double>;
+
+#include "impl/AttitudeIntegrator_impl.hpp"
+} // namespace tinyso3
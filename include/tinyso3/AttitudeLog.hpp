@@ -0,0 +1,219 @@
+/**
+ * @file AttitudeLog.hpp
+ *
+ * A versioned, chunked, columnar binary format for timestamped attitudes.
+ *
+ * header    : AttitudeLogHeader (32 bytes)
+ * chunk * K : AttitudeLogChunkHeader (16 bytes), timestamps double[n], columns Type[n] * C, zero padding to 8 bytes
+ * index     : AttitudeLogIndexEntry (32 bytes) * K
+ * footer    : AttitudeLogFooter (32 bytes)
+ *
+ * C is 4 for quaternions, stored as w, x, y, z columns regardless of the storage order of the convention,
+ * and 9 for rotation matrices, stored row major. The convention and scalar type are recorded in the header.
+ * Values are in the native byte order, which the header records and the reader checks.
+ *
+ * AttitudeLogReader works over any memory holding a complete log, e.g. a memory mapped file (see MappedFile in AttitudeLogFile.hpp),
+ * and exposes every chunk as batch views pointing into that memory, without copying.
+ * The memory must be 8 byte aligned.
+ *
+ * AttitudeLogWriter buffers at most ChunkSize records and hands complete chunks to a user sink,
+ * struct Sink { bool operator()(const void* data, size_t size); }; // returns false on failure
+ * The index entries are kept in caller provided storage, bounding the number of chunks of a log.
+ * The log is complete only after close(), a log without footer is rejected by the reader.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "RotationMatrixBatch.hpp"
+
+namespace tinyso3 {
+struct AttitudeLogHeader {
+    char magic[8];         // "TSO3LOG"
+    uint32_t version;      // AttitudeLogVersion
+    uint32_t byte_order;   // AttitudeLogByteOrder as written by the host
+    uint32_t convention;   // attitude_log_convention
+    uint32_t scalar_size;  // sizeof(Type)
+    uint32_t components;   // 4 or 9
+    uint32_t reserved;
+};
+
+struct AttitudeLogChunkHeader {
+    uint32_t magic; // AttitudeLogChunkMagic
+    uint32_t count; // records
+    uint64_t size;  // bytes including this header and the padding
+};
+
+struct AttitudeLogIndexEntry {
+    uint64_t offset; // of the chunk header from the beginning of the log
+    uint64_t count;
+    double first;    // timestamps of the first and last records
+    double last;
+};
+
+struct AttitudeLogFooter {
+    uint64_t index_offset;
+    uint64_t chunks;
+    uint64_t records;
+    char magic[8]; // "TSO3END"
+};
+
+static_assert(sizeof(AttitudeLogHeader) == 32, "AttitudeLogHeader must be 32 bytes.");
+static_assert(sizeof(AttitudeLogChunkHeader) == 16, "AttitudeLogChunkHeader must be 16 bytes.");
+static_assert(sizeof(AttitudeLogIndexEntry) == 32, "AttitudeLogIndexEntry must be 32 bytes.");
+static_assert(sizeof(AttitudeLogFooter) == 32, "AttitudeLogFooter must be 32 bytes.");
+
+constexpr uint32_t AttitudeLogVersion = 1;
+constexpr uint32_t AttitudeLogByteOrder = 0x01020304;
+constexpr uint32_t AttitudeLogChunkMagic = 0x43334F54; // "TO3C" in little endian
+
+// Convention codes recorded in the header.
+template<typename Convention>
+struct attitude_log_convention;
+template<>
+struct attitude_log_convention<HAMILTON> : integral_constant<uint32_t, 0> {};
+template<>
+struct attitude_log_convention<JPL> : integral_constant<uint32_t, 1> {};
+template<>
+struct attitude_log_convention<ACTIVE> : integral_constant<uint32_t, 2> {};
+template<>
+struct attitude_log_convention<PASSIVE> : integral_constant<uint32_t, 3> {};
+
+/**
+ * @class AttitudeLogReader
+ *
+ * Zero-copy reader over a complete log in memory.
+ */
+class AttitudeLogReader {
+public:
+    /**
+     * Constructors
+     * Validates the header, footer and every index entry, valid() reports the result.
+     */
+    AttitudeLogReader(const void* data, size_t size);
+
+    /**
+     * Accessors
+     */
+    inline bool valid() const { return _valid; }
+    inline const AttitudeLogHeader& header() const { return *_header; }
+    inline size_t chunks() const { return _valid ? static_cast<size_t>(_footer->chunks) : 0; }
+    inline size_t records() const { return _valid ? static_cast<size_t>(_footer->records) : 0; }
+    inline const AttitudeLogIndexEntry& index(size_t chunk) const { return _index[chunk]; }
+
+    /**
+     * True if the log holds the representation of the Convention (HAMILTON, JPL, ACTIVE, PASSIVE) with the scalar Type.
+     */
+    template<typename Convention, typename Type>
+    bool holds() const;
+
+    /**
+     * The first chunk whose last timestamp is not before t, chunks() if there is none.
+     */
+    size_t find(double t) const;
+
+    /**
+     * Views into the chunk, valid while the memory is.
+     */
+    const double* timestamps(size_t chunk) const;
+    template<typename QuaternionConvention, typename Type, enable_if_t<(is_quaternion_convention<QuaternionConvention>::value), int> = 0>
+    QuaternionBatch<QuaternionConvention, const Type> quaternions(size_t chunk) const;
+    template<typename RotationMatrixConvention, typename Type, enable_if_t<(is_rotation_matrix_convention<RotationMatrixConvention>::value), int> = 0>
+    RotationMatrixBatch<RotationMatrixConvention, const Type> rotationMatrices(size_t chunk) const;
+
+private:
+    template<typename Type>
+    const Type* column(size_t chunk, size_t component) const;
+    static inline bool equal(const char* a, const char* b, size_t n);
+
+    const unsigned char* _data;
+    size_t _size;
+    const AttitudeLogHeader* _header;
+    const AttitudeLogFooter* _footer;
+    const AttitudeLogIndexEntry* _index;
+    bool _valid;
+};
+
+/**
+ * @class AttitudeLogWriter
+ *
+ * Append-only writer, Convention selects the representation (HAMILTON, JPL, ACTIVE, PASSIVE).
+ * Timestamps must not decrease.
+ */
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize = 1024>
+class AttitudeLogWriter {
+    static_assert(is_quaternion_convention<Convention>::value || is_rotation_matrix_convention<Convention>::value, "Convention must be one of HAMILTON, JPL, ACTIVE or PASSIVE.");
+    static_assert(ChunkSize > 0, "ChunkSize must be positive.");
+
+public:
+    static constexpr bool IsQuaternion = is_quaternion_convention<Convention>::value;
+    static constexpr size_t Components = IsQuaternion ? 4 : 9;
+    using ValueType = conditional_t<IsQuaternion, Quaternion<Convention, Type>, RotationMatrix<Convention, Type>>;
+    using BatchType = conditional_t<IsQuaternion, QuaternionBatch<Convention, const Type>, RotationMatrixBatch<Convention, const Type>>;
+
+    /**
+     * Constructors
+     * index must hold index_capacity entries, the maximum number of chunks of the log.
+     */
+    AttitudeLogWriter(const Sink& sink, AttitudeLogIndexEntry* index, size_t index_capacity);
+
+    /**
+     * Appends records, writing a chunk whenever ChunkSize records are buffered.
+     * Returns false if the sink fails, the index is full or the log is closed.
+     */
+    bool append(double timestamp, const ValueType& value);
+    bool append(const double* timestamps, const BatchType& values);
+
+    /**
+     * Writes the buffered records as a chunk.
+     */
+    bool flush();
+
+    /**
+     * Flushes, then writes the index and the footer. No record can be appended afterwards.
+     */
+    bool close();
+
+    /**
+     * Accessors
+     */
+    inline size_t records() const { return _records; }
+    inline size_t chunks() const { return _chunks; }
+    inline size_t pending() const { return _count; }
+    inline uint64_t bytes() const { return _offset; }
+    inline const Sink& sink() const { return _sink; }
+
+private:
+    bool write(const void* data, size_t size);
+
+    // Components of a quaternion (w, x, y, z) or a rotation matrix (row major), selected by IsQuaternion.
+    template<typename Value>
+    static inline void components(const Value& value, Type* out, true_type);
+    template<typename Value>
+    static inline void components(const Value& value, Type* out, false_type);
+    template<typename Batch>
+    static inline const Type* column(const Batch& batch, size_t component, true_type);
+    template<typename Batch>
+    static inline const Type* column(const Batch& batch, size_t component, false_type);
+
+    Sink _sink;
+    AttitudeLogIndexEntry* _index;
+    size_t _index_capacity;
+
+    double _timestamps[ChunkSize];
+    Type _columns[Components][ChunkSize];
+    size_t _count{0};
+
+    size_t _chunks{0};
+    size_t _records{0};
+    uint64_t _offset{0};
+    bool _closed{false};
+};
+
+#include "impl/AttitudeLog_impl.hpp"
+} // namespace tinyso3
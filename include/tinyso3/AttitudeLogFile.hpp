@@ -0,0 +1,95 @@
+/**
+ * @file AttitudeLogFile.hpp
+ *
+ * POSIX file access for AttitudeLog, a read only memory mapping for AttitudeLogReader and a file sink for AttitudeLogWriter.
+ *
+ * Unlike the rest of the library this header depends on the operating system, and is not included by tinyso3.hpp.
+ *
+ * MappedFile file{"attitude.log"};
+ * AttitudeLogReader reader{file.data(), file.size()};
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "AttitudeLog.hpp"
+
+namespace tinyso3 {
+/**
+ * @class MappedFile
+ *
+ * Maps a whole file read only, the mapping is page aligned.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const char* path) {
+        const int fd = ::open(path, O_RDONLY);
+        if(fd < 0) {
+            return;
+        }
+
+        struct stat status;
+        if(::fstat(fd, &status) == 0 && status.st_size > 0) {
+            void* data = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if(data != MAP_FAILED) {
+                _data = data;
+                _size = static_cast<size_t>(status.st_size);
+                ::madvise(data, _size, MADV_SEQUENTIAL);
+            }
+        }
+        ::close(fd);
+    }
+    ~MappedFile() {
+        if(_data != nullptr) {
+            ::munmap(_data, _size);
+        }
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    inline bool valid() const { return _data != nullptr; }
+    inline const void* data() const { return _data; }
+    inline size_t size() const { return _size; }
+
+private:
+    void* _data{nullptr};
+    size_t _size{0};
+};
+
+/**
+ * @class FileSink
+ *
+ * Writes to a file descriptor owned by the caller, retrying partial writes.
+ */
+class FileSink {
+public:
+    explicit FileSink(int fd) :
+    _fd(fd) {}
+
+    bool operator()(const void* data, size_t size) const {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        while(size > 0) {
+            const ssize_t written = ::write(_fd, bytes, size);
+            if(written < 0 && errno == EINTR) {
+                continue;
+            }
+            if(written <= 0) {
+                return false;
+            }
+            bytes += written;
+            size -= static_cast<size_t>(written);
+        }
+        return true;
+    }
+
+private:
+    int _fd;
+};
+} // namespace tinyso3
@@ -0,0 +1,117 @@
+/**
+ * @file AttitudeRingBuffer.hpp
+ *
+ * Lock-free ring buffer of timestamped attitude samples, written by one producer and interpolated by any number of readers.
+ *
+ * The producer pushes samples with increasing timestamps, e.g. from an IMU thread, overwriting the oldest when full.
+ * push is wait-free, a constant number of stores, and never waits for readers.
+ * Readers query the attitude at any time within the buffered samples, interpolated between the two samples around it
+ * by SLERP, NLERP or HERMITE (using the angular velocities), see Interpolation.
+ *
+ * Each slot carries a sequence number, set to a busy marker while the producer writes it,
+ * so a reader copying a slot being overwritten detects it and retries with the newer samples.
+ * Samples are copied word by word with atomic loads and stores, as in LatestAttitude, so a copy never races.
+ * Readers only load, a query is lock-free, retried only when the producer has overwritten the samples it was reading.
+ * The count of pushed samples, written by the producer and read by every reader, is alone on its cache line.
+ * Atomic operations are the GCC / Clang __atomic builtins, the standard library is not used.
+ *
+ * AttitudeRingBuffer<HAMILTON, double>::Slot slots[1024];
+ * AttitudeRingBuffer<HAMILTON, double> buffer{slots, 1024, Interpolation::HERMITE};
+ * buffer.push({t, q, w}); // IMU thread
+ * Quaternion<HAMILTON, double> q_t;
+ * if(buffer.at(t_camera, q_t)) { ... } // any other thread
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <string.h>
+
+#include "Quaternion.hpp"
+#include "AngularVelocity.hpp"
+#include "QuaternionHermite.hpp"
+#include "tiny_type_traits.hpp"
+
+namespace tinyso3 {
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class AttitudeRingBuffer {
+public:
+    using QuaternionType = Quaternion<QuaternionConvention, Type>;
+
+    /**
+     * Sample, angular_velocity is expressed in the body(local) frame and only used by Interpolation::HERMITE.
+     */
+    struct Sample {
+        Type time;
+        QuaternionType quaternion;
+        AngularVelocity<Type> angular_velocity;
+    };
+
+    static_assert(is_trivially_copyable<Sample>::value, "Sample must be trivially copyable.");
+    static constexpr size_t Words = (sizeof(Sample) + sizeof(size_t) - 1) / sizeof(size_t);
+
+    struct Slot {
+        size_t sequence;     // index of the sample + 1, Busy while written
+        size_t words[Words]; // the sample
+    };
+
+    /**
+     * Constructors, over capacity slots, a power of two of at least 2, empty.
+     */
+    AttitudeRingBuffer(Slot* slots, size_t capacity, Interpolation interpolation = Interpolation::SLERP);
+
+    /**
+     * Producer side, appends a sample, overwriting the oldest when full.
+     * Returns false, keeping the buffer unchanged, unless the time is after the last pushed sample.
+     */
+    bool push(const Sample& sample);
+
+    /**
+     * Reader side, the attitude at time, interpolated between the buffered samples around it.
+     * Returns false if time is before the oldest or after the newest buffered sample.
+     */
+    bool at(const Type& time, QuaternionType& quaternion) const;
+
+    /**
+     * Reader side, the newest sample, false if none was pushed.
+     */
+    bool latest(Sample& sample) const;
+
+    /**
+     * Accessors, pushed() counts every sample pushed, size() the buffered ones.
+     */
+    inline size_t pushed() const { return __atomic_load_n(&_head, __ATOMIC_ACQUIRE); }
+    inline size_t size() const { return pushed() < _capacity ? pushed() : _capacity; }
+    inline size_t capacity() const { return _capacity; }
+    inline Interpolation interpolation() const { return _interpolation; }
+
+private:
+    static constexpr size_t Busy = ~size_t(0);
+    // time is the first member of Sample, so it is held by the first words of a slot.
+    static constexpr size_t TimeWords = (sizeof(Type) + sizeof(size_t) - 1) / sizeof(size_t);
+
+    // Copies sample index i, false if it is being or was overwritten.
+    inline bool read(size_t i, Sample& sample) const;
+    inline bool readTime(size_t i, Type& time) const;
+    QuaternionType interpolate(const Sample& from, const Sample& to, const Type& time) const;
+
+    Slot* _slots;
+    size_t _capacity;
+    Interpolation _interpolation;
+
+    // Shared with the readers, alone on its cache line.
+    alignas(64) size_t _head{0};
+    // Producer only and written on every push, on the next line, away from _head and the members readers load.
+    alignas(64) Type _last_time{};
+};
+
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using AttitudeRingBufferf = AttitudeRingBuffer<QuaternionConvention, float>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using AttitudeRingBufferd = AttitudeRingBuffer<QuaternionConvention, double>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using AttitudeRingBufferld = AttitudeRingBuffer<QuaternionConvention, long double>;
+
+#include "impl/AttitudeRingBuffer_impl.hpp"
+} // namespace tinyso3
@@ -0,0 +1,65 @@
+/**
+ * @file BFloat16.hpp
+ *
+ * bfloat16 storage type, the upper half of a float, converted to and from float for computation.
+ *
+ * BFloat16 holds 1 sign, 8 exponent and 7 significand bits, the range of float with about 2 decimal digits,
+ * halving the memory of float arrays. Unit quaternion components are kept within 3.9e-3.
+ * Construction from float rounds to nearest even, and conversion to float is exact.
+ * It is a storage type only, without arithmetic, usable in batch views, e.g. QuaternionBatch<HAMILTON, BFloat16>,
+ * whose elements are read and written as float.
+ *
+ * Widen and Narrow convert arrays, written as branch free loops the compiler vectorizes.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "tiny_type_traits.hpp"
+
+namespace tinyso3 {
+class BFloat16 {
+public:
+    /**
+     * Constructors
+     */
+    BFloat16() = default;
+    BFloat16(float value) :
+    _bits(narrow(value)) {}
+
+    static inline BFloat16 FromBits(uint16_t bits) {
+        BFloat16 b;
+        b._bits = bits;
+        return b;
+    }
+
+    /**
+     * Conversion
+     */
+    inline operator float() const { return widen(_bits); }
+    inline uint16_t bits() const { return _bits; }
+
+    /**
+     * Converts n values between arrays.
+     */
+    static void Widen(const BFloat16* in, float* out, size_t n);
+    static void Narrow(const float* in, BFloat16* out, size_t n);
+
+private:
+    static inline uint16_t narrow(float value);
+    static inline float widen(uint16_t bits);
+
+    uint16_t _bits;
+};
+
+static_assert(sizeof(BFloat16) == 2, "BFloat16 must be 2 bytes.");
+
+template<>
+struct compute_type<BFloat16> { using type = float; };
+
+#include "impl/BFloat16_impl.hpp"
+} // namespace tinyso3
@@ -0,0 +1,84 @@
+/**
+ * @file ConingAccumulator.hpp
+ *
+ * Coning and sculling compensation for strapdown integration of high rate IMU increments (Savage, 1998).
+ *
+ * Each IMU sample provides the body(local) frame delta angle d_theta and optionally the delta velocity d_v over its sample interval.
+ * Within an attitude update interval the samples are accumulated recursively,
+ *
+ * alpha  += d_theta
+ * beta   += 1/2 * (alpha_prev + 1/6 * d_theta_prev) x d_theta                                          (coning)
+ * nu     += d_v
+ * gamma  += 1/2 * ((alpha_prev + 1/6 * d_theta_prev) x d_v + (nu_prev + 1/6 * d_v_prev) x d_theta)    (sculling)
+ *
+ * which costs a few cross products per sample. Once per attitude update,
+ * the rotation vector is phi = alpha + beta and the velocity increment, expressed in the body frame at the start of the interval,
+ * is nu + 1/2 * alpha x nu + gamma. Only then the exponential is evaluated.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "Quaternion.hpp"
+#include "RotationMatrix.hpp"
+
+namespace tinyso3 {
+template<typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class ConingAccumulator {
+public:
+    /**
+     * Constructors
+     */
+    ConingAccumulator();
+
+    /**
+     * Accumulates a delta angle sample, and a delta velocity sample for the sculling compensation.
+     */
+    void push(const Vector3<Type>& delta_angle);
+    void push(const Vector3<Type>& delta_angle, const Vector3<Type>& delta_velocity);
+
+    /**
+     * Body frame rotation vector over the accumulated interval, alpha + beta.
+     */
+    inline Vector3<Type> rotationVector() const { return _alpha + _beta; }
+
+    /**
+     * Body frame velocity increment over the accumulated interval, expressed at the start of the interval.
+     */
+    inline Vector3<Type> velocityIncrement() const { return _nu + _alpha.cross(_nu) / Type(2) + _gamma; }
+
+    /**
+     * Attitude increment of the accumulated interval, composed in the same order as Quaternion::boxplus.
+     * HAMILTON : q_next = q * increment, JPL : q_next = increment * q
+     * ACTIVE : R_next = R * increment, PASSIVE : R_next = increment * R
+     */
+    template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+    Quaternion<QuaternionConvention, Type> quaternion() const;
+    template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+    RotationMatrix<RotationMatrixConvention, Type> rotationMatrix() const;
+
+    /**
+     * Starts a new attitude update interval.
+     */
+    void reset();
+
+    inline size_t count() const { return _count; }
+
+private:
+    Vector3<Type> _alpha;
+    Vector3<Type> _beta;
+    Vector3<Type> _nu;
+    Vector3<Type> _gamma;
+
+    Vector3<Type> _prev_delta_angle;
+    Vector3<Type> _prev_delta_velocity;
+    size_t _count;
+};
+
+using ConingAccumulatorf = ConingAccumulator<float>;
+using ConingAccumulatord = ConingAccumulator<double>;
+using ConingAccumulatorld = ConingAccumulator<long double>;
+
+#include "impl/ConingAccumulator_impl.hpp"
+} // namespace tinyso3
@@ -0,0 +1,92 @@
+/**
+ * @file CsvReader.hpp
+ *
+ * Streaming CSV tokenizer, filling batches and arrays of rotations directly, without allocation.
+ *
+ * Each line holds one record, an optional timestamp followed by the components of the value,
+ * separated by the separator with optional spaces. Values are parsed with TextFormat, independent of the C locale.
+ * Quaternions are read in their storage order, rotation matrices row major, Vector3, Euler and AxisAngle as x, y, z.
+ * Empty lines, comments (#) and header lines starting with a letter (other than inf or nan) are skipped.
+ *
+ * The input may be fed in pieces of any size. read() consumes complete lines only and returns the bytes consumed,
+ * the rest (an incomplete line, or lines beyond the capacity) must be passed again at the beginning of the next piece.
+ * With last = true the final line does not need a line break.
+ *
+ * CsvReader<double> reader;
+ * const size_t consumed = reader.read(text, size, QuaternionBatch<HAMILTON, double>{w, x, y, z, 1024}, timestamps);
+ * // reader.records() quaternions and timestamps are written
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "TextFormat.hpp"
+#include "QuaternionBatch.hpp"
+#include "RotationMatrixBatch.hpp"
+#include "Vector3Batch.hpp"
+
+namespace tinyso3 {
+template<typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class CsvReader {
+public:
+    /**
+     * Constructors
+     */
+    explicit CsvReader(char separator = ',') :
+    _separator(separator) {}
+
+    /**
+     * Reads records into the batch from index 0, at most batch.size() records.
+     * If timestamps is given, each line begins with a timestamp written to timestamps, which must hold batch.size() values.
+     */
+    template<typename QuaternionConvention>
+    size_t read(const char* data, size_t size, const QuaternionBatch<QuaternionConvention, Type>& batch, double* timestamps = nullptr, bool last = false);
+    size_t read(const char* data, size_t size, const Vector3Batch<Type>& batch, double* timestamps = nullptr, bool last = false);
+    template<typename RotationMatrixConvention>
+    size_t read(const char* data, size_t size, const RotationMatrixBatch<RotationMatrixConvention, Type>& batch, double* timestamps = nullptr, bool last = false);
+
+    /**
+     * Reads records into values[0, capacity), e.g. arrays of Euler, AxisAngle, Vector3, Quaternion or RotationMatrix.
+     */
+    template<typename Value>
+    size_t read(const char* data, size_t size, Value* values, size_t capacity, double* timestamps = nullptr, bool last = false);
+
+    /**
+     * Accessors
+     */
+    inline size_t records() const { return _records; } // written by the last read
+    inline size_t line() const { return _line; }       // lines consumed since construction
+    inline bool failed() const { return _failed; }     // the last read stopped before the malformed line line() + 1
+    inline char separator() const { return _separator; }
+
+private:
+    template<typename Parsed, typename Target>
+    size_t parse(const char* data, size_t size, const Target& target, size_t capacity, double* timestamps, bool last);
+    inline bool skip(const char* cursor, const char* end) const;
+    inline void spaces(const char*& cursor, const char* end) const;
+
+    template<typename QuaternionConvention>
+    static inline void store(const QuaternionBatch<QuaternionConvention, Type>& batch, size_t i, const Vector<4, Type>& value) { batch.set(i, Quaternion<QuaternionConvention, Type>{value}); }
+    static inline void store(const Vector3Batch<Type>& batch, size_t i, const Vector<3, Type>& value) { batch.set(i, Vector3<Type>{value}); }
+    template<typename RotationMatrixConvention>
+    static inline void store(const RotationMatrixBatch<RotationMatrixConvention, Type>& batch, size_t i, const SquareMatrix<3, Type>& value) { batch.set(i, RotationMatrix<RotationMatrixConvention, Type>{value}); }
+    template<typename Value, typename Parsed>
+    static inline void store(Value* const& values, size_t i, const Parsed& value) { values[i] = Value{value}; }
+
+    // Components parsed for each value type.
+    static Vector<3, Type> parsed(const Vector<3, Type>*);
+    static Vector<4, Type> parsed(const Vector<4, Type>*);
+    static SquareMatrix<3, Type> parsed(const Matrix<3, 3, Type>*);
+
+    char _separator;
+    size_t _records{0};
+    size_t _line{0};
+    bool _failed{false};
+};
+
+using CsvReaderf = CsvReader<float>;
+using CsvReaderd = CsvReader<double>;
+
+#include "impl/CsvReader_impl.hpp"
+} // namespace tinyso3
@@ -78,7 +78,7 @@ class Euler : public Vector3<Type> {
      */
     using Vector3<Type>::Vector3;
 
-    Euler(const Euler& other);
+    Euler(const Euler& other) = default;
     template<typename RotationMatrixConvention>
     Euler(const RotationMatrix<RotationMatrixConvention, Type>& dcm);
     Euler(const AxisAngle<Type>& axis_angle);
@@ -32,6 +32,21 @@ class EulerRate : public Vector3<Type> {
 
     template<typename RotationMatrixConvention>
     EulerRate(const RotationMatrix<RotationMatrixConvention, Type>& dcm, const AngularVelocity<Type>& angular_velocity);
+    EulerRate(const Euler<EulerConvention, EulerSequence, Type>& euler, const AngularVelocity<Type>& angular_velocity);
+
+    /**
+     * Static Methods
+     */
+    // angular_velocity = KinematicMatrix(euler) * euler_rate, closed-form for each sequence and convention.
+    static SquareMatrix<3, Type> KinematicMatrix(const Euler<EulerConvention, EulerSequence, Type>& euler);
+    // euler_rate = InverseKinematicMatrix(euler) * angular_velocity, singular at gimbal lock.
+    static SquareMatrix<3, Type> InverseKinematicMatrix(const Euler<EulerConvention, EulerSequence, Type>& euler);
+    // euler_rate[i] = EulerRate{euler[i], angular_velocity[i]}
+    static void FromAngularVelocities(const Euler<EulerConvention, EulerSequence, Type>* euler, const AngularVelocity<Type>* angular_velocity, EulerRate* euler_rate, size_t count);
+
+private:
+    // Passive principal axis rotation of v, given cos and sin of the angle.
+    static inline Vector3<Type> RotatePassive(PrincipalAxis axis, const Type& c, const Type& s, const Vector3<Type>& v);
 };
 
 template<typename EulerConvention = TINYSO3_DEFAULT_EULER_ANGLE_CONVENTION, typename EulerSequence = TINYSO3_DEFAULT_EULER_ANGLE_SEQUENCE>
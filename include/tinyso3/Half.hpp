@@ -0,0 +1,68 @@
+/**
+ * @file Half.hpp
+ *
+ * IEEE 754 binary16 storage type, converted to and from float for computation.
+ *
+ * Half holds 1 sign, 5 exponent and 10 significand bits, about 3 decimal digits within 6.1e-5 to 65504
+ * (subnormals down to 6.0e-8), halving the memory of float arrays. Unit quaternion components are kept within 4.9e-4.
+ * Construction from float rounds to nearest even, overflowing to infinity, and conversion to float is exact.
+ * It is a storage type only, without arithmetic, usable in batch views, e.g. QuaternionBatch<HAMILTON, Half>,
+ * whose elements are read and written as float.
+ *
+ * Widen and Narrow convert arrays, with F16C instructions when compiled for them (e.g. -mf16c), otherwise branch free loops the compiler vectorizes.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+#include "tiny_type_traits.hpp"
+
+namespace tinyso3 {
+class Half {
+public:
+    /**
+     * Constructors
+     */
+    Half() = default;
+    Half(float value) :
+    _bits(narrow(value)) {}
+
+    static inline Half FromBits(uint16_t bits) {
+        Half h;
+        h._bits = bits;
+        return h;
+    }
+
+    /**
+     * Conversion
+     */
+    inline operator float() const { return widen(_bits); }
+    inline uint16_t bits() const { return _bits; }
+
+    /**
+     * Converts n values between arrays.
+     */
+    static void Widen(const Half* in, float* out, size_t n);
+    static void Narrow(const float* in, Half* out, size_t n);
+
+private:
+    static inline uint16_t narrow(float value);
+    static inline float widen(uint16_t bits);
+
+    uint16_t _bits;
+};
+
+static_assert(sizeof(Half) == 2, "Half must be 2 bytes.");
+
+template<>
+struct compute_type<Half> { using type = float; };
+
+#include "impl/Half_impl.hpp"
+} // namespace tinyso3
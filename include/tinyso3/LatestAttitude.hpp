@@ -0,0 +1,78 @@
+/**
+ * @file LatestAttitude.hpp
+ *
+ * Latest value of a rotation, published by one writer and read by any number of threads without locks.
+ *
+ * T is any trivially copyable value, e.g. Quaternion, RotationMatrix or a struct of a timestamp and a rotation.
+ * The writer copies each value into the next of Buffers cells, then publishes its version.
+ * A reader copies the cell of the published version, and checks that the cell still holds that version after the copy.
+ * store is wait-free, and a load only retries if the writer published Buffers - 1 more values while it was copying,
+ * which for a rotation sized value (tens of bytes copied in a few nanoseconds) is rare, so loads are wait-free in practice.
+ * Every word is copied with an atomic load or store, so a load never returns a torn mix of two values.
+ * Cells are on separate cache lines, and readers never write to shared memory, so they do not contend with each other.
+ * Atomic operations are the GCC / Clang __atomic builtins, the standard library is not used.
+ *
+ * LatestAttitude<Quaternion<HAMILTON, double>> latest{Quaternion<HAMILTON, double>{}};
+ * latest.store(q);                               // estimator thread
+ * const Quaternion<HAMILTON, double> q = latest.load(); // any thread
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+#include "tiny_type_traits.hpp"
+
+namespace tinyso3 {
+template<typename T, size_t Buffers = 2>
+class LatestAttitude {
+    static_assert(is_trivially_copyable<T>::value, "T must be trivially copyable.");
+    static_assert(Buffers >= 2, "Buffers must be at least 2.");
+
+public:
+    /**
+     * Constructors, publishing initial as version 1.
+     */
+    explicit LatestAttitude(const T& initial = T());
+
+    LatestAttitude(const LatestAttitude&) = delete;
+    LatestAttitude& operator=(const LatestAttitude&) = delete;
+
+    /**
+     * Writer side, publishes value. Only one thread may store.
+     */
+    void store(const T& value);
+
+    /**
+     * Reader side, the latest published value.
+     */
+    T load() const;
+
+    /**
+     * Reader side, a single attempt, false if the writer overwrote the cell while it was copied.
+     * version, if not null, receives the version of the value.
+     */
+    bool tryLoad(T& value, size_t* version = nullptr) const;
+
+    /**
+     * Number of values published, the initial value included.
+     */
+    inline size_t version() const { return __atomic_load_n(&_version, __ATOMIC_ACQUIRE); }
+
+private:
+    static constexpr size_t Words = (sizeof(T) + sizeof(size_t) - 1) / sizeof(size_t);
+
+    struct alignas(64) Cell {
+        size_t version; // version of the value, 0 while written
+        size_t words[Words];
+    };
+
+    Cell _cells[Buffers];
+    alignas(64) size_t _version{0};
+};
+
+#include "impl/LatestAttitude_impl.hpp"
+} // namespace tinyso3
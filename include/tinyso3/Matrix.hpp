@@ -27,7 +27,7 @@ class Matrix {
     Matrix() = default;
     Matrix(const Type data_[M * N]);
     Matrix(const Type data_[M][N]);
-    Matrix(const Matrix& other);
+    Matrix(const Matrix& other) = default; // trivially copyable, e.g. for LatestAttitude
     Matrix(const Type& value); // Fill with a value
     template<typename U, typename V, typename... Args>
     Matrix(const U&, const V&, const Args&... args); // replacement of initializer_list
@@ -35,7 +35,7 @@ class Matrix {
     /**
      * Assignment
      */
-    Matrix& operator=(const Matrix& other);
+    Matrix& operator=(const Matrix& other) = default;
     Matrix& operator=(const Type& value); // Fill with a value
     template<size_t O, size_t P, size_t Q, size_t R>
     Matrix& setBlock(const Matrix<Q, R, Type>& block);
@@ -0,0 +1,118 @@
+/**
+ * @file MatrixMap.hpp
+ *
+ * A non-owning MxN matrix view over external memory.
+ *
+ * Element (i, j) is data[i * row_stride + j * col_stride], row major by default,
+ * MatrixMap<3, 3, float>{buffer, 1, 3} views a column major buffer.
+ * Type may be const qualified for read only views, e.g. MatrixMap<3, 3, const float>.
+ *
+ * Arithmetic reads the view and returns an owning Matrix, assignment writes through the view.
+ * Copy construction aliases the same memory, while copy assignment writes the elements of the other view.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "Matrix.hpp"
+#include "tiny_type_traits.hpp"
+
+namespace tinyso3 {
+template<size_t M, size_t N, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class MatrixMap {
+public:
+    using ValueType = remove_const_t<Type>;
+    using MatrixType = Matrix<M, N, ValueType>;
+
+    /**
+     * Constructors
+     */
+    MatrixMap(Type* data, size_t row_stride = N, size_t col_stride = 1) :
+    _data(data), _row_stride(row_stride), _col_stride(col_stride) {}
+    MatrixMap(const MatrixMap& other) = default;
+
+    // A mutable view converts to a read only view.
+    template<typename Other, enable_if_t<(is_same<const Other, Type>::value && !is_same<Other, Type>::value), int> = 0>
+    MatrixMap(const MatrixMap<M, N, Other>& other) :
+    _data(other.data()), _row_stride(other.rowStride()), _col_stride(other.colStride()) {}
+
+    /**
+     * Assignment, writes through the view.
+     */
+    MatrixMap& operator=(const MatrixMap& other);
+    MatrixMap& operator=(const MatrixType& other);
+    MatrixMap& operator=(const ValueType& value); // Fill with a value
+
+    /**
+     * Accessors
+     */
+    inline Type& operator()(size_t i, size_t j) const { return _data[i * _row_stride + j * _col_stride]; }
+    inline Type* data() const { return _data; }
+    inline size_t rowStride() const { return _row_stride; }
+    inline size_t colStride() const { return _col_stride; }
+
+    /**
+     * Copy to an owning matrix
+     */
+    MatrixType matrix() const;
+    inline operator MatrixType() const { return matrix(); }
+
+    /**
+     * Arithmetic operators by scalar
+     */
+    inline MatrixType operator+(ValueType scalar) const { return matrix() + scalar; }
+    inline MatrixType operator-(ValueType scalar) const { return matrix() - scalar; }
+    inline MatrixType operator*(ValueType scalar) const { return matrix() * scalar; }
+    inline MatrixType operator/(ValueType scalar) const { return matrix() / scalar; }
+    inline MatrixType operator-() const { return -matrix(); }
+    inline void operator+=(ValueType scalar) { *this = matrix() + scalar; }
+    inline void operator-=(ValueType scalar) { *this = matrix() - scalar; }
+    inline void operator*=(ValueType scalar) { *this = matrix() * scalar; }
+    inline void operator/=(ValueType scalar) { *this = matrix() / scalar; }
+
+    inline friend MatrixType operator+(ValueType lhs, const MatrixMap& rhs) { return rhs + lhs; }
+    inline friend MatrixType operator-(ValueType lhs, const MatrixMap& rhs) { return -rhs + lhs; }
+    inline friend MatrixType operator*(ValueType lhs, const MatrixMap& rhs) { return rhs * lhs; }
+
+    /**
+     * Arithmetic operators by matrix
+     */
+    inline MatrixType operator+(const MatrixType& other) const { return matrix() + other; }
+    inline MatrixType operator-(const MatrixType& other) const { return matrix() - other; }
+    inline void operator+=(const MatrixType& other) { *this = matrix() + other; }
+    inline void operator-=(const MatrixType& other) { *this = matrix() - other; }
+    template<size_t P>
+    inline Matrix<M, P, ValueType> operator*(const Matrix<N, P, ValueType>& other) const { return matrix() * other; }
+    template<size_t P, typename Other>
+    inline Matrix<M, P, ValueType> operator*(const MatrixMap<N, P, Other>& other) const { return matrix() * other.matrix(); }
+
+    /**
+     * Transpose and utility functions
+     */
+    inline Matrix<N, M, ValueType> T() const { return matrix().T(); }
+    inline MatrixType abs() const { return matrix().abs(); }
+    inline ValueType min() const { return matrix().min(); }
+    inline ValueType max() const { return matrix().max(); }
+
+protected:
+    Type* _data;
+    size_t _row_stride;
+    size_t _col_stride;
+};
+
+// Owning matrix on the left hand side.
+template<size_t M, size_t N, size_t P, typename Type, typename Other>
+inline Matrix<M, P, Type> operator*(const Matrix<M, N, Type>& lhs, const MatrixMap<N, P, Other>& rhs) {
+    return lhs * rhs.matrix();
+}
+
+template<size_t M, size_t N>
+using MatrixMapf = MatrixMap<M, N, float>;
+template<size_t M, size_t N>
+using MatrixMapd = MatrixMap<M, N, double>;
+template<size_t M, size_t N>
+using MatrixMapld = MatrixMap<M, N, long double>;
+
+#include "impl/MatrixMap_impl.hpp"
+} // namespace tinyso3
@@ -96,6 +96,25 @@ class Quaternion : public Vector<4, Type> {
     Vector3<Type> log() const;
     Quaternion<QuaternionConvention, Type> pow(Type t) const;
 
+    /**
+     * Perturbs the rotation by a rotation vector phi expressed in the body(local) frame.
+     * phi is the full rotation vector (axis * angle), compatible with AngularVelocity * dt.
+     *
+     * HAMILTON : q * Exp(phi / 2)
+     * JPL : Exp(-phi / 2) * q
+     */
+    Quaternion<QuaternionConvention, Type> boxplus(const Vector3<Type>& phi) const;
+
+    /**
+     * Inverse of boxplus, returns the shortest body(local) frame rotation vector phi satisfying other.boxplus(phi) = *this.
+     */
+    Vector3<Type> boxminus(const Quaternion<QuaternionConvention, Type>& other) const;
+
+    /**
+     * Adjoint, the matrix of v -> q * v, satisfying q * Exp(phi / 2) * q^(*) = Exp(Ad * phi / 2).
+     */
+    SquareMatrix<3, Type> adjoint() const;
+
     inline Quaternion<QuaternionConvention, Type> unit() const { return Vector<4, Type>::unit(); }
 
 private:
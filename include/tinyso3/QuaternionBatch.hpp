@@ -0,0 +1,84 @@
+/**
+ * @file QuaternionBatch.hpp
+ *
+ * A non-owning structure of arrays view over N quaternions.
+ *
+ * Components are stored in four separate arrays w[N], x[N], y[N], z[N], owned by the user,
+ * so that loops over the batch access each component contiguously.
+ * Type may be const qualified for read only views, e.g. QuaternionBatch<HAMILTON, const float>,
+ * or a storage only type (Half, BFloat16), converted to float on access.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "Quaternion.hpp"
+
+namespace tinyso3 {
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class QuaternionBatch {
+public:
+    using ValueType = compute_type_t<remove_const_t<Type>>;
+    using QuaternionType = Quaternion<QuaternionConvention, ValueType>;
+
+    /**
+     * Constructors
+     */
+    QuaternionBatch(Type* w, Type* x, Type* y, Type* z, size_t size) :
+    _w(w), _x(x), _y(y), _z(z), _size(size) {}
+
+    // A mutable view converts to a read only view.
+    template<typename Other, enable_if_t<(is_same<const Other, Type>::value && !is_same<Other, Type>::value), int> = 0>
+    QuaternionBatch(const QuaternionBatch<QuaternionConvention, Other>& other) :
+    _w(other.w()), _x(other.x()), _y(other.y()), _z(other.z()), _size(other.size()) {}
+
+    /**
+     * Element access
+     */
+    inline QuaternionType operator[](size_t i) const {
+        QuaternionType q;
+        q.w() = _w[i];
+        q.x() = _x[i];
+        q.y() = _y[i];
+        q.z() = _z[i];
+        return q;
+    }
+
+    template<typename T = Type, enable_if_t<(is_same<T, remove_const_t<T>>::value), int> = 0>
+    inline void set(size_t i, const QuaternionType& q) const {
+        _w[i] = q.w();
+        _x[i] = q.x();
+        _y[i] = q.y();
+        _z[i] = q.z();
+    }
+
+    /**
+     * View over the size elements from offset, e.g. a chunk of a batch processed by one thread.
+     */
+    inline QuaternionBatch slice(size_t offset, size_t size) const { return QuaternionBatch{_w + offset, _x + offset, _y + offset, _z + offset, size}; }
+
+    /**
+     * Accessors
+     */
+    inline Type* w() const { return _w; }
+    inline Type* x() const { return _x; }
+    inline Type* y() const { return _y; }
+    inline Type* z() const { return _z; }
+    inline size_t size() const { return _size; }
+
+private:
+    Type* _w;
+    Type* _x;
+    Type* _y;
+    Type* _z;
+    size_t _size;
+};
+
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionBatchf = QuaternionBatch<QuaternionConvention, float>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionBatchd = QuaternionBatch<QuaternionConvention, double>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionBatchld = QuaternionBatch<QuaternionConvention, long double>;
+} // namespace tinyso3
@@ -0,0 +1,88 @@
+/**
+ * @file QuaternionCodec.hpp
+ *
+ * "Smallest three" compression of unit quaternions into 32, 48 or 64 bits.
+ *
+ * Since q and -q are the same rotation, the largest magnitude component is dropped after flipping it positive,
+ * and recovered as sqrt(1 - a^2 - b^2 - c^2). The other three lie within [-1/sqrt(2), 1/sqrt(2)],
+ * and are quantized uniformly with ComponentBits each,
+ *
+ * bits [0, B)      : first remaining component in w, x, y, z order
+ * bits [B, 2B)     : second remaining component
+ * bits [2B, 3B)    : third remaining component
+ * bits [3B, 3B + 2): index of the dropped component, 0(w) 1(x) 2(y) 3(z)
+ *
+ * where B = ComponentBits = 10, 15, 20 for Bits = 32, 48, 64. Codes are independent of the storage order of the convention.
+ * Decoded quaternions are unit and canonical, the same as Quaternion::canonicalize(), w >= 0.
+ *
+ * With the quantization step d = sqrt(2) / (2^B - 1), the rotation angle between q and Decode(Encode(q))
+ * is bounded to first order by MaxAngularError() = 2 * sqrt(3) * d,
+ *
+ * 32 bits : 4.8e-3 rad (0.27 deg)
+ * 48 bits : 1.5e-4 rad (0.0086 deg)
+ * 64 bits : 4.7e-6 rad (0.00027 deg)
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+
+namespace tinyso3 {
+template<size_t Bits = 32, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class QuaternionCodec {
+    static_assert(Bits == 32 || Bits == 48 || Bits == 64, "Bits must be one of 32, 48 or 64.");
+
+public:
+    using QuaternionType = Quaternion<QuaternionConvention, Type>;
+    using Code = conditional_t<Bits == 32, uint32_t, uint64_t>;
+
+    static constexpr size_t ComponentBits = (Bits - 2) / 3;
+    static constexpr size_t Bytes = Bits / 8;
+
+    /**
+     * Encodes a unit quaternion, and decodes it to a unit canonical quaternion.
+     */
+    static Code Encode(const QuaternionType& q);
+    static QuaternionType Decode(const Code& code);
+
+    /**
+     * Encodes or decodes every quaternion of the batch, codes must hold q.size() elements.
+     */
+    static void Encode(const QuaternionBatch<QuaternionConvention, const Type>& q, Code* codes);
+    static void Decode(const Code* codes, const QuaternionBatch<QuaternionConvention, Type>& q);
+
+    /**
+     * Writes or reads a code as Bytes little endian bytes.
+     */
+    static void Store(const Code& code, unsigned char* bytes);
+    static Code Load(const unsigned char* bytes);
+
+    /**
+     * First-order bound of the rotation angle [rad] introduced by a round trip.
+     */
+    static Type MaxAngularError();
+
+private:
+    static constexpr Code Levels = (Code(1) << ComponentBits) - Code(1);
+
+    // Component wise kernels shared by the single and batch versions.
+    static inline Code encode(const Type& w, const Type& x, const Type& y, const Type& z);
+    static inline void decode(const Code& code, Type& w, Type& x, Type& y, Type& z);
+    static inline Code quantize(const Type& value);
+    static inline Type dequantize(const Code& level);
+};
+
+template<size_t Bits = 32, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionCodecf = QuaternionCodec<Bits, QuaternionConvention, float>;
+template<size_t Bits = 32, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionCodecd = QuaternionCodec<Bits, QuaternionConvention, double>;
+template<size_t Bits = 32, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionCodecld = QuaternionCodec<Bits, QuaternionConvention, long double>;
+
+#include "impl/QuaternionCodec_impl.hpp"
+} // namespace tinyso3
@@ -0,0 +1,75 @@
+/**
+ * @file QuaternionHermite.hpp
+ *
+ * Cubic Hermite interpolation on SO(3) from quaternion and angular velocity endpoints.
+ *
+ * The curve is the cumulative cubic Bezier form (Kim, Kim and Shin, 1995),
+ * q(u) = q0 [+] (phi1 * b1(u)) [+] (phi2 * b2(u)) [+] (phi3 * b3(u)),
+ * b1 = 1 - (1 - u)^3, b2 = 3u^2 - 2u^3, b3 = u^3,
+ * where [+] is Quaternion::boxplus, phi1 = w0 * T / 3, phi3 = w1 * T / 3
+ * and phi2 connects the two inner control points.
+ * It passes through both endpoints with the body(local) frame angular velocities w0 and w1, T being the duration.
+ *
+ * Axes and angles of phi1, phi2, phi3 are cached on construction,
+ * so that each evaluation costs three sin/cos pairs and three quaternion products.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "Quaternion.hpp"
+#include "AngularVelocity.hpp"
+
+namespace tinyso3 {
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class QuaternionHermite {
+public:
+    using QuaternionType = Quaternion<QuaternionConvention, Type>;
+
+    /**
+     * Constructors
+     */
+    QuaternionHermite() = default;
+    QuaternionHermite(const QuaternionType& from, const AngularVelocity<Type>& from_angular_velocity,
+                      const QuaternionType& to, const AngularVelocity<Type>& to_angular_velocity,
+                      const Type& duration);
+
+    /**
+     * Evaluates the curve at normalized time u in [0, 1], u = 0 returns from and u = 1 returns to.
+     */
+    QuaternionType operator()(const Type& u) const;
+
+    /**
+     * Evaluates count points, out[i] = (*this)(u[i]).
+     */
+    void operator()(const Type* u, QuaternionType* out, size_t count) const;
+
+    /**
+     * Body(local) frame angular velocity of the curve at normalized time u.
+     */
+    AngularVelocity<Type> angularVelocity(const Type& u) const;
+
+    inline const Type& duration() const { return _duration; }
+
+private:
+    // Exp of (axis * angle / 2) in the body frame sense of boxplus.
+    inline QuaternionType increment(size_t i, const Type& b) const;
+    // Rodrigues rotation of v about a unit axis.
+    static inline Vector3<Type> rotate(const Vector3<Type>& v, const Vector3<Type>& axis, const Type& angle);
+
+    QuaternionType _from;
+    Type _duration{};
+    Vector3<Type> _axis[3];
+    Type _angle[3]{};
+};
+
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionHermitef = QuaternionHermite<QuaternionConvention, float>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionHermited = QuaternionHermite<QuaternionConvention, double>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionHermiteld = QuaternionHermite<QuaternionConvention, long double>;
+
+#include "impl/QuaternionHermite_impl.hpp"
+} // namespace tinyso3
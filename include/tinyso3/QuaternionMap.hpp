@@ -0,0 +1,110 @@
+/**
+ * @file QuaternionMap.hpp
+ *
+ * A non-owning quaternion view over external memory.
+ *
+ * Components follow the storage order of the convention, w, x, y, z (HAMILTON) or x, y, z, w (JPL),
+ * and component i is data[i * stride].
+ * Type may be const qualified for read only views, e.g. QuaternionMap<HAMILTON, const float>.
+ *
+ * Operations read the view and return an owning Quaternion, assignment writes through the view.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "Quaternion.hpp"
+#include "tiny_type_traits.hpp"
+
+namespace tinyso3 {
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class QuaternionMap {
+public:
+    using ValueType = remove_const_t<Type>;
+    using QuaternionType = Quaternion<QuaternionConvention, ValueType>;
+
+    /**
+     * Constructors
+     */
+    QuaternionMap(Type* data, size_t stride = 1) :
+    _data(data), _stride(stride) {}
+    QuaternionMap(const QuaternionMap& other) = default;
+
+    // A mutable view converts to a read only view.
+    template<typename Other, enable_if_t<(is_same<const Other, Type>::value && !is_same<Other, Type>::value), int> = 0>
+    QuaternionMap(const QuaternionMap<QuaternionConvention, Other>& other) :
+    _data(other.data()), _stride(other.stride()) {}
+
+    /**
+     * Assignment, writes through the view.
+     */
+    QuaternionMap& operator=(const QuaternionMap& other) { return *this = other.quaternion(); }
+    QuaternionMap& operator=(const QuaternionType& q) {
+        static_assert(is_same<Type, ValueType>::value, "Cannot write through a read only view.");
+        w() = q.w();
+        x() = q.x();
+        y() = q.y();
+        z() = q.z();
+        return *this;
+    }
+
+    /**
+     * Accessors
+     */
+    inline Type& w() const { return _data[(is_same<QuaternionConvention, HAMILTON>::value ? 0 : 3) * _stride]; }
+    inline Type& x() const { return _data[(is_same<QuaternionConvention, HAMILTON>::value ? 1 : 0) * _stride]; }
+    inline Type& y() const { return _data[(is_same<QuaternionConvention, HAMILTON>::value ? 2 : 1) * _stride]; }
+    inline Type& z() const { return _data[(is_same<QuaternionConvention, HAMILTON>::value ? 3 : 2) * _stride]; }
+    inline Type* data() const { return _data; }
+    inline size_t stride() const { return _stride; }
+
+    /**
+     * Copy to an owning quaternion
+     */
+    inline QuaternionType quaternion() const {
+        QuaternionType q;
+        q.w() = w();
+        q.x() = x();
+        q.y() = y();
+        q.z() = z();
+        return q;
+    }
+    inline operator QuaternionType() const { return quaternion(); }
+
+    /**
+     * Real and Imaginary parts
+     */
+    inline Vector3<ValueType> Im() const { return Vector3<ValueType>{x(), y(), z()}; }
+    inline ValueType Re() const { return w(); }
+
+    /**
+     * operator overloading
+     */
+    inline QuaternionType operator*(const QuaternionType& other) const { return quaternion() * other; }
+    inline Vector3<ValueType> operator*(const Vector3<ValueType>& other_vec) const { return quaternion() * other_vec; }
+    inline QuaternionType operator/(const QuaternionType& other) const { return quaternion() / other; }
+    inline void operator*=(const QuaternionType& other) { *this = quaternion() * other; }
+    inline void operator/=(const QuaternionType& other) { *this = quaternion() / other; }
+
+    inline QuaternionType conjugate() const { return quaternion().conjugate(); }
+    inline QuaternionType canonicalize() const { return quaternion().canonicalize(); }
+    inline QuaternionType unit() const { return quaternion().unit(); }
+    inline ValueType norm() const { return quaternion().norm(); }
+    inline ValueType dot(const QuaternionType& other) const { return quaternion().dot(other); }
+    inline Vector3<ValueType> log() const { return quaternion().log(); }
+    inline QuaternionType boxplus(const Vector3<ValueType>& phi) const { return quaternion().boxplus(phi); }
+    inline Vector3<ValueType> boxminus(const QuaternionType& other) const { return quaternion().boxminus(other); }
+
+private:
+    Type* _data;
+    size_t _stride;
+};
+
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionMapf = QuaternionMap<QuaternionConvention, float>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionMapd = QuaternionMap<QuaternionConvention, double>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionMapld = QuaternionMap<QuaternionConvention, long double>;
+} // namespace tinyso3
@@ -0,0 +1,104 @@
+/**
+ * @file QuaternionResampler.hpp
+ *
+ * A streaming resampler from irregularly timestamped quaternion samples to a fixed output rate.
+ *
+ * Only the previous input sample is kept, so memory is bounded regardless of the stream length.
+ * Output ticks are located at exact multiples of 1 / rate, t_k = k / rate.
+ * Consecutive inputs further apart than max_gap are treated as a gap, and no output is produced inside of it.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "Quaternion.hpp"
+#include "AngularVelocity.hpp"
+#include "QuaternionHermite.hpp"
+
+namespace tinyso3 {
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class QuaternionResampler {
+public:
+    using QuaternionType = Quaternion<QuaternionConvention, Type>;
+
+    /**
+     * Input sample, angular_velocity is expressed in the body(local) frame and only used by Interpolation::HERMITE.
+     */
+    struct Sample {
+        Type time;
+        QuaternionType quaternion;
+        AngularVelocity<Type> angular_velocity;
+    };
+
+    /**
+     * Stream statistics, rates are measured in samples per second of stream time.
+     */
+    struct Statistics {
+        size_t input_count;    // accepted input samples
+        size_t output_count;   // emitted output samples
+        size_t gap_count;      // detected gaps
+        size_t rejected_count; // input samples with non-increasing timestamp
+        Type first_time;
+        Type last_time;
+
+        inline Type inputRate() const { return input_count > 1 ? Type(input_count - 1) / (last_time - first_time) : Type(0); }
+        inline Type outputRate() const { return input_count > 1 ? Type(output_count) / (last_time - first_time) : Type(0); }
+    };
+
+    /**
+     * Constructors
+     */
+    QuaternionResampler(const Type& rate, const Type& max_gap, Interpolation interpolation = Interpolation::SLERP);
+
+    /**
+     * Pushes a sample and emits every output tick in (previous.time, sample.time] to sink.
+     * sink is called as sink(const Type& time, const QuaternionType& quaternion).
+     * Returns the number of emitted outputs.
+     */
+    template<typename Sink>
+    size_t push(const Sample& sample, Sink&& sink);
+
+    /**
+     * Drops the held sample and statistics.
+     */
+    void reset();
+
+    /**
+     * Accessors
+     */
+    inline const Statistics& statistics() const { return _statistics; }
+    inline Type rate() const { return _rate; }
+    inline Type maxGap() const { return _max_gap; }
+    inline Interpolation interpolation() const { return _interpolation; }
+
+private:
+    inline Type tickTime() const { return Type(_tick) / _rate; }
+    inline long long firstTickFrom(const Type& time) const { return static_cast<long long>(ceil(time * _rate)); }
+    void prepare(const Sample& to);
+    QuaternionType evaluate(const Sample& to, const Type& u) const;
+
+    Type _rate;
+    Type _max_gap;
+    Interpolation _interpolation;
+
+    bool _has_previous{false};
+    Sample _previous;
+    long long _tick{0};
+
+    // Per segment cache, body frame rotation vector for SLERP and the curve for HERMITE.
+    Vector3<Type> _phi;
+    QuaternionHermite<QuaternionConvention, Type> _hermite;
+
+    Statistics _statistics;
+};
+
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionResamplerf = QuaternionResampler<QuaternionConvention, float>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionResamplerd = QuaternionResampler<QuaternionConvention, double>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using QuaternionResamplerld = QuaternionResampler<QuaternionConvention, long double>;
+
+#include "impl/QuaternionResampler_impl.hpp"
+} // namespace tinyso3
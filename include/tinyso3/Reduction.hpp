@@ -0,0 +1,106 @@
+/**
+ * @file Reduction.hpp
+ *
+ * Deterministic sums of matrices, vectors and quaternions, with optional compensated summation.
+ *
+ * MatrixSum accumulates Matrix values elementwise, Vector3, Quaternion and SquareMatrix values through their Matrix base.
+ * With KAHAN each element carries the rounding error of its additions, so that the error of a sum of n values
+ * stays about one rounding instead of growing with n, at about twice the cost of NAIVE.
+ *
+ * ReductionTree combines partial results (any type with merge) in a fixed tree over their index order:
+ * leaves are consecutive ranges of LeafSize values, merged pairwise, then pairs of pairs, and so on.
+ * The tree depends only on the number of values, so a reduction is bitwise identical whether the leaves are
+ * computed serially, or in any order by any number of threads and merged with Combine,
+ * e.g. ThreadPool::parallelReduce with Chunking::DETERMINISTIC and a grain of LeafSize builds the same tree.
+ *
+ * ReductionTree<MatrixSum<3, 3, double>> tree;
+ * for(size_t leaf = 0; leaf < leaves; leaf++) {
+ *     tree.push(sumOfLeaf(leaf)); // in index order
+ * }
+ * const SquareMatrix<3, double> total = tree.result().value();
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "Matrix.hpp"
+#include "conventions.hpp"
+
+namespace tinyso3 {
+template<size_t M, size_t N, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE, typename Summation = KAHAN>
+class MatrixSum {
+    static_assert(is_summation<Summation>::value, "Summation must be one of the Summation types (NAIVE, KAHAN).");
+
+public:
+    using MatrixType = Matrix<M, N, Type>;
+
+    /**
+     * Constructors, an empty sum.
+     */
+    MatrixSum() = default;
+
+    /**
+     * Adds a value, or every value of another sum, merging their compensations.
+     */
+    void add(const MatrixType& value);
+    void merge(const MatrixSum& other);
+
+    /**
+     * The sum, compensated, and the number of values added.
+     */
+    MatrixType value() const;
+    inline size_t count() const { return _count; }
+
+private:
+    static inline void accumulate(Type& sum, Type& compensation, const Type& value);
+
+    MatrixType _sum{};
+    MatrixType _compensation{}; // rounding errors of the additions, zero for NAIVE
+    size_t _count{0};
+};
+
+template<typename Accumulator>
+class ReductionTree {
+public:
+    /**
+     * Appends the partial result of the next leaf, in index order, merging the complete subtrees.
+     */
+    void push(const Accumulator& leaf);
+
+    /**
+     * The merge of every leaf pushed, empty if none.
+     */
+    Accumulator result() const;
+
+    /**
+     * Merges count leaves in place into leaves[0] along the same tree, and returns it.
+     */
+    static Accumulator Combine(Accumulator* leaves, size_t count);
+
+    /**
+     * Number of leaves of LeafSize values, and the range [begin, end) of a leaf, over size values.
+     */
+    static inline size_t Leaves(size_t size, size_t leaf_size) { return (size + leaf_size - 1) / leaf_size; }
+    static inline void Range(size_t leaf, size_t size, size_t leaf_size, size_t& begin, size_t& end) {
+        begin = leaf * leaf_size;
+        end = size - begin > leaf_size ? begin + leaf_size : size;
+    }
+
+private:
+    static constexpr size_t Depth = 8 * sizeof(size_t);
+
+    Accumulator _subtrees[Depth]; // complete subtrees, of decreasing sizes
+    size_t _leaves[Depth]{};      // leaves in each subtree
+    size_t _size{0};
+};
+
+template<size_t M, size_t N, typename Summation = KAHAN>
+using MatrixSumf = MatrixSum<M, N, float, Summation>;
+template<size_t M, size_t N, typename Summation = KAHAN>
+using MatrixSumd = MatrixSum<M, N, double, Summation>;
+template<size_t M, size_t N, typename Summation = KAHAN>
+using MatrixSumld = MatrixSum<M, N, long double, Summation>;
+
+#include "impl/Reduction_impl.hpp"
+} // namespace tinyso3
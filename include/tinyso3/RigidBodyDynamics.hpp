@@ -0,0 +1,102 @@
+/**
+ * @file RigidBodyDynamics.hpp
+ *
+ * Rotational dynamics of a rigid body, Euler's equations together with the attitude.
+ *
+ * The inertia tensor J is diagonalized once with EigenSolver, J = A * diag(I) * A^T,
+ * where the columns of A are the principal axes in the body frame.
+ * Each step integrates the principal frame angular momentum m = diag(I) * A^T * w,
+ *
+ * dm/dt = m x (m / I) + A^T * torque
+ *
+ * and the attitude is advanced by body(local) frame increments, the same as Quaternion::boxplus.
+ * The torque is given in the body frame and held constant over a step, applied as two half kicks around the free flow.
+ * The scheme is selected at compile time with one of the RigidBodyIntegration tags,
+ *
+ * SPLITTING : Strang splitting of the kinetic energy into the three principal axis terms,
+ *             X(dt / 2) Y(dt / 2) Z(dt) Y(dt / 2) X(dt / 2), each an exact rotation about a single axis.
+ *             Explicit, symplectic, |m| and the world frame angular momentum are conserved to rounding. (2nd order)
+ * MIDPOINT  : Implicit midpoint rule on m solved with fixed point iterations, then the attitude is rotated by the midpoint angular velocity.
+ *             Kinetic energy and |m| of the free body are conserved up to the tolerance. (2nd order)
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "EigenSolver.hpp"
+#include "Quaternion.hpp"
+#include "AngularVelocity.hpp"
+#include "QuaternionBatch.hpp"
+#include "Vector3Batch.hpp"
+
+namespace tinyso3 {
+template<typename RigidBodyIntegrationScheme = SPLITTING, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class RigidBodyDynamics {
+    static_assert(is_rigid_body_integration<RigidBodyIntegrationScheme>::value, "RigidBodyIntegrationScheme must be one of the RigidBodyIntegration types (SPLITTING, MIDPOINT).");
+
+public:
+    using Scheme = RigidBodyIntegrationScheme;
+    using QuaternionType = Quaternion<QuaternionConvention, Type>;
+
+    /**
+     * Constructors
+     * inertia must be symmetric positive definite, tolerance and max_iterations bound the MIDPOINT iterations.
+     */
+    RigidBodyDynamics(const SquareMatrix<3, Type>& inertia, const Type& tolerance = epsilon<Type>(), size_t max_iterations = 16);
+
+    /**
+     * Advances the attitude q and the body frame angular velocity w by dt.
+     */
+    void step(QuaternionType& q, AngularVelocity<Type>& w, const Type& dt) const;
+    void step(QuaternionType& q, AngularVelocity<Type>& w, const Vector3<Type>& torque, const Type& dt) const;
+
+    /**
+     * Advances every body of the batch in place.
+     * All batches must have the same size.
+     */
+    void step(const QuaternionBatch<QuaternionConvention, Type>& q, const Vector3Batch<Type>& w, const Type& dt) const;
+    void step(const QuaternionBatch<QuaternionConvention, Type>& q, const Vector3Batch<Type>& w, const Vector3Batch<const Type>& torque, const Type& dt) const;
+
+    /**
+     * Body frame angular momentum J * w, and kinetic energy w^T * J * w / 2.
+     */
+    inline Vector3<Type> angularMomentum(const Vector3<Type>& w) const { return _inertia * w; }
+    inline Type kineticEnergy(const Vector3<Type>& w) const { return w.dot(_inertia * w) / Type(2); }
+
+    /**
+     * Accessors
+     */
+    inline const SquareMatrix<3, Type>& inertia() const { return _inertia; }
+    inline const Vector3<Type>& principalMoments() const { return _moments; }
+    inline const SquareMatrix<3, Type>& principalAxes() const { return _axes; } // columns, in the body frame
+    inline const Type& tolerance() const { return _tolerance; }
+    inline size_t maxIterations() const { return _max_iterations; }
+
+private:
+    // Advances q and the principal frame angular momentum m, torque is in the principal frame.
+    void advance(SPLITTING, QuaternionType& q, Vector3<Type>& m, const Vector3<Type>& torque, const Type& dt) const;
+    void advance(MIDPOINT, QuaternionType& q, Vector3<Type>& m, const Vector3<Type>& torque, const Type& dt) const;
+
+    // Exact flow of the kinetic energy about the principal axis i over dt.
+    inline void rotate(size_t i, QuaternionType& q, Vector3<Type>& m, const Type& dt) const;
+    // Applies the body frame increment (cos(angle / 2), sin(angle / 2) * axis).
+    static inline void increment(QuaternionType& q, const Type& c, const Vector3<Type>& s_axis);
+    static inline QuaternionType renormalize(const QuaternionType& q);
+
+    SquareMatrix<3, Type> _inertia;
+    SquareMatrix<3, Type> _axes;
+    Vector3<Type> _moments;
+    Type _tolerance;
+    size_t _max_iterations;
+};
+
+template<typename RigidBodyIntegrationScheme = SPLITTING, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RigidBodyDynamicsf = RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, float>;
+template<typename RigidBodyIntegrationScheme = SPLITTING, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RigidBodyDynamicsd = RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, double>;
+template<typename RigidBodyIntegrationScheme = SPLITTING, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RigidBodyDynamicsld = RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, long double>;
+
+#include "impl/RigidBodyDynamics_impl.hpp"
+} // namespace tinyso3
@@ -0,0 +1,80 @@
+/**
+ * @file RotationGrid.hpp
+ *
+ * Discretization of SO(3) into Size = 4 * Resolution^3 cells, with constant time quantization.
+ *
+ * The unit quaternions, with q and -q identified, are projected onto the facets of the enclosing 4D cube.
+ * The largest magnitude component selects one of 4 facets, and the other three ratios u = c / c_max,
+ * in w, x, y, z order, are mapped to angles a = atan(u) within [-pi/4, pi/4] and split into Resolution equal intervals.
+ * The grid is implicit, cells are computed without tables and cell ids are independent of the storage order of the convention,
+ *
+ * cell = ((facet * Resolution + i0) * Resolution + i1) * Resolution + i2
+ *
+ * Equal intervals of angle keep the cells close to uniform. The volume density, prod_i sec^2(a_i) / (1 + sum_i tan^2(a_i))^2,
+ * falls from 1 at the center of a facet to 1/2 at its corners and 4/9 at the midpoints of its edges,
+ * so cell volumes differ by a factor below 2.25, approached as Resolution grows (1.62 at Resolution = 4, 1.90 at 8, 2.20 at 50).
+ * Every rotation lies within MaxAngularError() = sqrt(3) * pi / (2 * Resolution) of its cell center (to first order),
+ * e.g. 0.054 rad (3.1 deg) for Resolution = 50, 500000 cells.
+ *
+ * RotationGrid<16, HAMILTON, float>::Cell cell = RotationGrid<16, HAMILTON, float>::Quantize(q);
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+
+namespace tinyso3 {
+template<size_t Resolution = 16, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class RotationGrid {
+    static_assert(Resolution >= 2 && Resolution <= 1024, "Resolution must be within [2, 1024].");
+
+public:
+    using QuaternionType = Quaternion<QuaternionConvention, Type>;
+    using Cell = uint32_t;
+
+    static constexpr size_t Size = 4 * Resolution * Resolution * Resolution;
+    static constexpr size_t MaxNeighbors = 26;
+
+    /**
+     * Cell containing a unit quaternion, and the unit canonical quaternion (w >= 0) at the center of a cell.
+     */
+    static Cell Quantize(const QuaternionType& q);
+    static QuaternionType CellCenter(const Cell& cell);
+
+    /**
+     * Quantizes or evaluates the cell centers of every element of the batch, cells must hold q.size() elements.
+     */
+    static void Quantize(const QuaternionBatch<QuaternionConvention, const Type>& q, Cell* cells);
+    static void CellCenter(const Cell* cells, const QuaternionBatch<QuaternionConvention, Type>& q);
+
+    /**
+     * Writes the distinct cells adjacent to cell, the cells containing the centers of its 26 neighbours in angle space,
+     * continued across facet boundaries. Returns their number, at most MaxNeighbors.
+     */
+    static size_t Neighbors(const Cell& cell, Cell* neighbors);
+
+    /**
+     * First-order bound of the rotation angle [rad] between any rotation and the center of its cell.
+     */
+    static Type MaxAngularError();
+
+private:
+    static inline Cell quantize(const Type& w, const Type& x, const Type& y, const Type& z);
+    static inline void center(const Cell& cell, Type& w, Type& x, Type& y, Type& z);
+    static inline void point(size_t facet, const int (&index)[3], Type (&c)[4]); // center of an index, also beyond the facet
+};
+
+template<size_t Resolution = 16, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RotationGridf = RotationGrid<Resolution, QuaternionConvention, float>;
+template<size_t Resolution = 16, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RotationGridd = RotationGrid<Resolution, QuaternionConvention, double>;
+template<size_t Resolution = 16, typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RotationGridld = RotationGrid<Resolution, QuaternionConvention, long double>;
+
+#include "impl/RotationGrid_impl.hpp"
+} // namespace tinyso3
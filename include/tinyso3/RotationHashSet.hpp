@@ -0,0 +1,109 @@
+/**
+ * @file RotationHashSet.hpp
+ *
+ * Set of rotations deduplicated within a tolerance angle, by open addressing in caller provided slots.
+ *
+ * Rotations are keyed by the cell of their canonical quaternion (w >= 0) on a 4D lattice of spacing h = 4 d,
+ * where d = 2 sin(tolerance / 4) is the chordal distance between unit quaternions at the tolerance angle
+ * (the spacing is at least 2 / 65000, to fit the indices in 16 bits).
+ * A lookup probes the cell of the rotation and those of its neighbours the ball of radius d reaches,
+ * on average about 5 cells, plus the cells of -q when the rotation is near w = 0, where the canonical sign flips.
+ * Two rotations are duplicates if their rotation angle is at most the tolerance.
+ *
+ * Slots are hashed by cell with linear probing, capacity must be a power of two, and at most 3/4 of it are used.
+ * Inserts and lookups take O(1) expected time, and nothing is allocated.
+ *
+ * RotationHashSet<HAMILTON, float>::Slot slots[1 << 16];
+ * RotationHashSet<HAMILTON, float> set{slots, 1 << 16, 0.01f};
+ * const uint32_t id = set.insert(q); // id of q, or of the rotation within 0.01 rad inserted before
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+
+namespace tinyso3 {
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class RotationHashSet {
+public:
+    using QuaternionType = Quaternion<QuaternionConvention, Type>;
+
+    struct Slot {
+        Type w, x, y, z;
+        uint64_t cell; // Empty if unused
+        uint32_t id;
+    };
+
+    static constexpr uint64_t Empty = ~uint64_t(0);
+    static constexpr uint32_t None = ~uint32_t(0);
+
+    /**
+     * Constructors, over capacity slots, a power of two of at least 4, cleared. The tolerance is a rotation angle [rad] within [0, pi].
+     */
+    RotationHashSet(Slot* slots, size_t capacity, const Type& tolerance);
+
+    /**
+     * Inserts q unless a rotation within the tolerance is present.
+     * Returns the id of the present rotation or of q, ids are consecutive from 0 in insertion order,
+     * or None if the set is full.
+     */
+    uint32_t insert(const QuaternionType& q);
+
+    /**
+     * Inserts every quaternion of the batch in order, ids must hold q.size() elements.
+     * Returns the number of rotations newly inserted.
+     */
+    size_t insert(const QuaternionBatch<QuaternionConvention, const Type>& q, uint32_t* ids);
+
+    /**
+     * Returns the id of a rotation within the tolerance of q, or None.
+     */
+    uint32_t find(const QuaternionType& q) const;
+    inline bool contains(const QuaternionType& q) const { return find(q) != None; }
+
+    /**
+     * Removes every rotation.
+     */
+    void clear();
+
+    /**
+     * Accessors
+     */
+    inline size_t size() const { return _size; }
+    inline size_t capacity() const { return _capacity; }
+    inline Type tolerance() const { return _tolerance; }
+
+private:
+    struct Key {
+        Type c[4];        // quaternion, w x y z
+        uint64_t cell;    // packed 16 bit lattice indices
+        int neighbour[4]; // -1, 0 or +1, the adjacent index the ball reaches
+    };
+
+    inline Key key(const Type& w, const Type& x, const Type& y, const Type& z) const;
+    uint32_t probe(const Key& k) const;
+    uint32_t find(const Key& k) const; // also probes -q near w = 0
+    inline size_t hash(uint64_t cell) const;
+
+    Slot* _slots;
+    size_t _capacity;
+    size_t _size{0};
+    Type _tolerance;
+    Type _radius;  // chordal distance of the tolerance
+    Type _spacing; // lattice spacing
+};
+
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RotationHashSetf = RotationHashSet<QuaternionConvention, float>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RotationHashSetd = RotationHashSet<QuaternionConvention, double>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RotationHashSetld = RotationHashSet<QuaternionConvention, long double>;
+
+#include "impl/RotationHashSet_impl.hpp"
+} // namespace tinyso3
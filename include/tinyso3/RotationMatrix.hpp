@@ -65,6 +65,26 @@ class RotationMatrix : public SquareMatrix<3, Type> {
     static RotationMatrix RotatePrincipalAxis(const Type& angle);
     static RotationMatrix Exp(const SquareMatrix<3, Type>& exp);
 
+    /**
+     * Jacobians of the exponential map at the rotation vector phi, with theta = |phi| and K = phi^,
+     *
+     * Jr = I - (1 - cos(theta)) / theta^2 * K + (theta - sin(theta)) / theta^3 * K^2, Exp(phi + d) ~ Exp(phi) * Exp(Jr * d)
+     * Jl = I + (1 - cos(theta)) / theta^2 * K + (theta - sin(theta)) / theta^3 * K^2, Exp(phi + d) ~ Exp(Jl * d) * Exp(phi)
+     * Jr^(-1) = I + K / 2 + (1 / theta^2 - (1 + cos(theta)) / (2 * theta * sin(theta))) * K^2
+     * Jl^(-1) = I - K / 2 + (1 / theta^2 - (1 + cos(theta)) / (2 * theta * sin(theta))) * K^2
+     *
+     * Small angles are handled by Taylor expansions. The inverses are singular at theta = 2 * pi.
+     */
+    static SquareMatrix<3, Type> RightJacobian(const Vector3<Type>& phi);
+    static SquareMatrix<3, Type> LeftJacobian(const Vector3<Type>& phi);
+    static SquareMatrix<3, Type> RightJacobianInverse(const Vector3<Type>& phi);
+    static SquareMatrix<3, Type> LeftJacobianInverse(const Vector3<Type>& phi);
+
+    /**
+     * Exp, also returning the right jacobian Jr(phi) from the same sin, cos evaluation.
+     */
+    static RotationMatrix ExpWithJacobian(const SquareMatrix<3, Type>& exp, SquareMatrix<3, Type>& right_jacobian);
+
     /**
      * Normalizes the rotation matrix.
      * 
@@ -85,6 +105,17 @@ class RotationMatrix : public SquareMatrix<3, Type> {
      */
     SquareMatrix<3, Type> log() const;
 
+    /**
+     * log, also returning the inverse right jacobian Jr^(-1)(phi) of the result phi = log().vee().
+     */
+    SquareMatrix<3, Type> logWithJacobian(SquareMatrix<3, Type>& right_jacobian_inverse) const;
+
+    /**
+     * Adjoint of the rotation, R * Exp(phi) * R^T = Exp(Ad * phi) for the ACTIVE rotation R.
+     * ACTIVE returns itself and PASSIVE returns its transpose.
+     */
+    SquareMatrix<3, Type> adjoint() const;
+
     /**
      * Returns the power of the rotation matrix.
      */
@@ -100,6 +131,15 @@ class RotationMatrix : public SquareMatrix<3, Type> {
 
     using SquareMatrix<3, Type>::Identity;
     using SquareMatrix<3, Type>::Null;
+
+private:
+    /**
+     * Coefficients shared by Exp, log and the jacobians, for theta2 = theta^2,
+     * a = sin(theta) / theta, b = (1 - cos(theta)) / theta^2, c = (theta - sin(theta)) / theta^3.
+     */
+    static inline void Coefficients(const Type& theta2, Type& a, Type& b, Type& c);
+    // 1 / theta^2 - (1 + cos(theta)) / (2 * theta * sin(theta)), from a and b.
+    static inline Type InverseCoefficient(const Type& theta2, const Type& a, const Type& b);
 };
 
 template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
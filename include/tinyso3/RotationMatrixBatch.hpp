@@ -0,0 +1,89 @@
+/**
+ * @file RotationMatrixBatch.hpp
+ *
+ * A non-owning structure of arrays view over N rotation matrices.
+ *
+ * Each of the 9 elements is stored in a separate array owned by the user, elements[3 * r + c][i] = R_i(r, c).
+ * Type may be const qualified for read only views, e.g. RotationMatrixBatch<ACTIVE, const float>,
+ * or a storage only type (Half, BFloat16), converted to float on access.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "RotationMatrix.hpp"
+
+namespace tinyso3 {
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class RotationMatrixBatch {
+public:
+    using ValueType = compute_type_t<remove_const_t<Type>>;
+    using RotationMatrixType = RotationMatrix<RotationMatrixConvention, ValueType>;
+
+    /**
+     * Constructors
+     */
+    RotationMatrixBatch(Type* const elements[9], size_t size) :
+    _size(size) {
+        for(size_t k = 0; k < 9; k++) {
+            _elements[k] = elements[k];
+        }
+    }
+
+    // A mutable view converts to a read only view.
+    template<typename Other, enable_if_t<(is_same<const Other, Type>::value && !is_same<Other, Type>::value), int> = 0>
+    RotationMatrixBatch(const RotationMatrixBatch<RotationMatrixConvention, Other>& other) :
+    _size(other.size()) {
+        for(size_t k = 0; k < 9; k++) {
+            _elements[k] = other.element(k / 3, k % 3);
+        }
+    }
+
+    /**
+     * Element access
+     */
+    inline RotationMatrixType operator[](size_t i) const {
+        SquareMatrix<3, ValueType> R;
+        for(size_t k = 0; k < 9; k++) {
+            R(k / 3, k % 3) = _elements[k][i];
+        }
+        return RotationMatrixType{R};
+    }
+
+    template<typename T = Type, enable_if_t<(is_same<T, remove_const_t<T>>::value), int> = 0>
+    inline void set(size_t i, const RotationMatrixType& R) const {
+        for(size_t k = 0; k < 9; k++) {
+            _elements[k][i] = R(k / 3, k % 3);
+        }
+    }
+
+    /**
+     * View over the size elements from offset, e.g. a chunk of a batch processed by one thread.
+     */
+    inline RotationMatrixBatch slice(size_t offset, size_t size) const {
+        Type* elements[9];
+        for(size_t k = 0; k < 9; k++) {
+            elements[k] = _elements[k] + offset;
+        }
+        return RotationMatrixBatch{elements, size};
+    }
+
+    /**
+     * Accessors
+     */
+    inline Type* element(size_t r, size_t c) const { return _elements[3 * r + c]; }
+    inline size_t size() const { return _size; }
+
+private:
+    Type* _elements[9];
+    size_t _size;
+};
+
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationMatrixBatchf = RotationMatrixBatch<RotationMatrixConvention, float>;
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationMatrixBatchd = RotationMatrixBatch<RotationMatrixConvention, double>;
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationMatrixBatchld = RotationMatrixBatch<RotationMatrixConvention, long double>;
+} // namespace tinyso3
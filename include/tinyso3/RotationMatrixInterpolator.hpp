@@ -0,0 +1,69 @@
+/**
+ * @file RotationMatrixInterpolator.hpp
+ *
+ * Interpolator between two fixed rotation matrices.
+ *
+ * RotationMatrix::interpolate() recomputes the relative rotation, its logarithm
+ * and the exponential on every call. When the same pair of endpoints is evaluated
+ * for many t, the axis and angle of the relative rotation are cached once,
+ * so that each evaluation costs one sin/cos pair, a closed form Rodrigues update and one 3x3 product.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "RotationMatrix.hpp"
+
+namespace tinyso3 {
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION,
+         typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class RotationMatrixInterpolator {
+public:
+    using RotationMatrixType = RotationMatrix<RotationMatrixConvention, Type>;
+
+    /**
+     * Constructors
+     *
+     * ACTIVE : R(t) = R1 * Exp(t * log(R1^(T) * R2))
+     * PASSIVE : R(t) = Exp(t * log(R2 * R1^(T))) * R1
+     */
+    RotationMatrixInterpolator(const RotationMatrixType& from, const RotationMatrixType& to);
+
+    /**
+     * Evaluates the interpolated rotation at t, t = 0 returns from and t = 1 returns to.
+     */
+    RotationMatrixType operator()(const Type& t) const;
+
+    /**
+     * Evaluates count interpolated rotations, out[i] = (*this)(t[i]).
+     */
+    void operator()(const Type* t, RotationMatrixType* out, size_t count) const;
+
+    /**
+     * Accessors to the cached relative rotation.
+     */
+    inline const Vector3<Type>& axis() const { return _axis; }
+    inline const Type& angle() const { return _angle; }
+
+private:
+    inline void evaluate(const Type& t, RotationMatrixType& out) const;
+
+    RotationMatrixType _from;
+    Vector3<Type> _axis;
+    Type _angle;
+
+    // K = hat(axis), K2 = K * K, stored to make Rodrigues formula I + sin * K + (1 - cos) * K2.
+    SquareMatrix<3, Type> _K;
+    SquareMatrix<3, Type> _K2;
+};
+
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationMatrixInterpolatorf = RotationMatrixInterpolator<RotationMatrixConvention, float>;
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationMatrixInterpolatord = RotationMatrixInterpolator<RotationMatrixConvention, double>;
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationMatrixInterpolatorld = RotationMatrixInterpolator<RotationMatrixConvention, long double>;
+
+#include "impl/RotationMatrixInterpolator_impl.hpp"
+} // namespace tinyso3
@@ -0,0 +1,80 @@
+/**
+ * @file RotationPreintegration.hpp
+ *
+ * Gyroscope preintegration on SO(3) between two keyframes (Forster et al., 2017).
+ *
+ * For measurements w_k with the bias b held fixed during integration, phi_k = (w_k - b) * dt_k and
+ *
+ * dR_(k+1)    = dR_k * Exp(phi_k)
+ * J_(k+1)     = Exp(phi_k)^T * J_k - Jr(phi_k) * dt_k
+ * Sigma_(k+1) = Exp(phi_k)^T * Sigma_k * Exp(phi_k) + Jr(phi_k) * (sigma^2 / dt_k) * Jr(phi_k)^T * dt_k^2
+ *
+ * where J is the first-order Jacobian of dR with respect to the bias, and Sigma is the covariance of the
+ * right perturbation of dR for a gyroscope noise density sigma [rad / s / sqrt(Hz)].
+ * A new bias estimate b' is applied without re-integration, dR(b') = dR * Exp(J * (b' - b)).
+ *
+ * Internally dR is an ACTIVE rotation, PASSIVE accessors return its transpose.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "RotationMatrix.hpp"
+#include "AngularVelocity.hpp"
+
+namespace tinyso3 {
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class RotationPreintegration {
+public:
+    using RotationMatrixType = RotationMatrix<RotationMatrixConvention, Type>;
+
+    /**
+     * Constructors
+     */
+    RotationPreintegration(const Vector3<Type>& bias, const Type& noise_density);
+
+    /**
+     * Integrates a body(local) frame gyroscope measurement held over dt.
+     */
+    void integrate(const AngularVelocity<Type>& measurement, const Type& dt);
+
+    /**
+     * Preintegrated rotation at the linearization bias, and first-order corrected to another bias.
+     */
+    RotationMatrixType deltaRotation() const;
+    RotationMatrixType deltaRotation(const Vector3<Type>& bias) const;
+
+    /**
+     * Restarts the integration with a new linearization bias.
+     */
+    void reset(const Vector3<Type>& bias);
+
+    /**
+     * Accessors
+     */
+    inline const SquareMatrix<3, Type>& biasJacobian() const { return _bias_jacobian; }
+    inline const SquareMatrix<3, Type>& covariance() const { return _covariance; }
+    inline const Vector3<Type>& bias() const { return _bias; }
+    inline const Type& deltaTime() const { return _delta_time; }
+    inline const Type& noiseDensity() const { return _noise_density; }
+
+private:
+    Vector3<Type> _bias;
+    Type _noise_density;
+
+    SquareMatrix<3, Type> _delta_rotation; // ACTIVE
+    SquareMatrix<3, Type> _bias_jacobian;
+    SquareMatrix<3, Type> _covariance;
+    Type _delta_time;
+};
+
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationPreintegrationf = RotationPreintegration<RotationMatrixConvention, float>;
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationPreintegrationd = RotationPreintegration<RotationMatrixConvention, double>;
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationPreintegrationld = RotationPreintegration<RotationMatrixConvention, long double>;
+
+#include "impl/RotationPreintegration_impl.hpp"
+} // namespace tinyso3
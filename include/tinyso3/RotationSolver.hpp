@@ -0,0 +1,95 @@
+/**
+ * @file RotationSolver.hpp
+ *
+ * Nonlinear least squares over a single rotation, min_R sum_i |r_i(R)|^2, with Gauss-Newton or Levenberg-Marquardt.
+ *
+ * Residual blocks r_i are 3 dimensional and provided by a user problem,
+ *
+ * struct Problem {
+ *     size_t size() const; // number of residual blocks
+ *     // Evaluates the blocks [begin, end) at R, jacobians may be nullptr when only residuals are needed.
+ *     void operator()(const RotationMatrixType& R, size_t begin, size_t end, Vector3<Type>* residuals, SquareMatrix<3, Type>* jacobians) const;
+ * };
+ *
+ * Jacobians are taken with respect to the perturbation d of the retraction, the same as Quaternion::boxplus,
+ * ACTIVE : R * Exp(d^), PASSIVE : Exp(-d^) * R
+ *
+ * Blocks are evaluated BatchSize at a time into fixed size buffers and accumulated into the 3x3 normal equations,
+ * (J^T J + lambda * max(diag(J^T J), min_diagonal)) d = -J^T r, so that solving never allocates.
+ * Gauss-Newton adds min_diagonal * I instead, so that rank deficient problems, e.g. a single vector observation
+ * which leaves the rotation about it unobserved, take no step along the unobserved directions.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "RotationMatrix.hpp"
+
+namespace tinyso3 {
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE, size_t BatchSize = 16>
+class RotationSolver {
+    static_assert(BatchSize > 0, "BatchSize must be positive.");
+
+public:
+    using RotationMatrixType = RotationMatrix<RotationMatrixConvention, Type>;
+
+    struct Options {
+        Optimization method{Optimization::LEVENBERG_MARQUARDT};
+        size_t max_iterations{50};
+        Type step_tolerance{epsilon<Type>()};     // converged when |d| is below
+        Type gradient_tolerance{epsilon<Type>()}; // converged when |J^T r| is below
+        Type initial_lambda{Type(1e-4)};
+        Type min_diagonal{Type(1e-6)};            // lower bound of the diagonal of J^T J in the normal equations
+    };
+
+    struct Statistics {
+        size_t iterations;        // solver iterations, including rejected steps
+        size_t evaluations;       // residual block evaluations
+        size_t rejected_steps;    // steps increasing the cost or not finite, Gauss-Newton stops at the first
+        Type initial_cost;        // 1/2 sum |r_i|^2 at the initial guess
+        Type final_cost;
+        Type lambda;              // final damping
+        bool converged;
+    };
+
+    /**
+     * Constructors
+     */
+    RotationSolver() = default;
+    RotationSolver(const Options& options) :
+    _options(options) {}
+
+    /**
+     * Solves from the initial guess and returns the estimated rotation.
+     */
+    template<typename Problem>
+    RotationMatrixType solve(const Problem& problem, const RotationMatrixType& initial);
+
+    /**
+     * Accessors
+     */
+    inline const Options& options() const { return _options; }
+    inline const Statistics& statistics() const { return _statistics; }
+
+private:
+    // Accumulates the normal equations at R, and returns the cost.
+    template<typename Problem>
+    Type linearize(const Problem& problem, const RotationMatrixType& R, SquareMatrix<3, Type>& hessian, Vector3<Type>& gradient);
+    template<typename Problem>
+    Type cost(const Problem& problem, const RotationMatrixType& R);
+    static RotationMatrixType retract(const RotationMatrixType& R, const Vector3<Type>& delta);
+
+    Options _options{};
+    Statistics _statistics{};
+};
+
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationSolverf = RotationSolver<RotationMatrixConvention, float>;
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationSolverd = RotationSolver<RotationMatrixConvention, double>;
+template<typename RotationMatrixConvention = TINYSO3_DEFAULT_ROTATION_MATRIX_CONVENTION>
+using RotationSolverld = RotationSolver<RotationMatrixConvention, long double>;
+
+#include "impl/RotationSolver_impl.hpp"
+} // namespace tinyso3
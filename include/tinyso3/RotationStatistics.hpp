@@ -0,0 +1,85 @@
+/**
+ * @file RotationStatistics.hpp
+ *
+ * Mean and covariance of a batch of rotations, bitwise reproducible for any partition over threads.
+ *
+ * The chordal L2 mean minimizes sum_i |R - R_i|_F^2, and equals the geodesic mean to second order for clustered rotations.
+ * It is U diag(1, 1, det(U V^T)) V^T from the singular value decomposition sum_i R_i = U S V^T,
+ * the nearest rotation, not reflection, to the sum even when det(sum_i R_i) < 0.
+ * A rank deficient sum has many means. For rank one, the mean rotating least from the right to the left singular vector is returned,
+ * and the identity for a zero sum. Singular values below sqrt(machine epsilon) times the largest, or times the count, count as zero.
+ * The covariance is taken in the tangent space of a mean, (1 / n) sum_i phi_i phi_i^T, phi_i = q_i [-] mean (Quaternion::boxminus).
+ *
+ * Sums are MatrixSum over leaves of LeafSize rotations combined by a ReductionTree, so the results depend on the data only.
+ * Parallel callers compute the leaf sums on any threads and combine them with ReductionTree::Combine,
+ *
+ * using Statistics = RotationStatistics<HAMILTON, double>;
+ * pool.parallelReduce(q.size(), Statistics::SumType{},
+ *                     [&](size_t begin, size_t end) { return Statistics::RotationSum(q, begin, end); },
+ *                     [](Statistics::SumType a, const Statistics::SumType& b) { a.merge(b); return a; },
+ *                     Statistics::LeafSize, Chunking::DETERMINISTIC); // the same as Statistics::RotationSum(q)
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "RotationMatrix.hpp"
+#include "EigenSolver.hpp"
+#include "Reduction.hpp"
+
+namespace tinyso3 {
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE, typename Summation = KAHAN, size_t Leaf = 256>
+class RotationStatistics {
+    static_assert(Leaf > 0, "Leaf must be positive.");
+
+public:
+    using QuaternionType = Quaternion<QuaternionConvention, Type>;
+    using BatchType = QuaternionBatch<QuaternionConvention, const Type>;
+    using SumType = MatrixSum<3, 3, Type, Summation>;
+
+    static constexpr size_t LeafSize = Leaf;
+
+    /**
+     * Sum of the rotation matrices, of every rotation along the tree, or of [begin, end) as one leaf.
+     */
+    static SumType RotationSum(const BatchType& q);
+    static SumType RotationSum(const BatchType& q, size_t begin, size_t end);
+
+    /**
+     * Sum of phi_i phi_i^T, phi_i = q_i [-] mean, of every rotation along the tree, or of [begin, end) as one leaf.
+     */
+    static SumType ScatterSum(const BatchType& q, const QuaternionType& mean);
+    static SumType ScatterSum(const BatchType& q, const QuaternionType& mean, size_t begin, size_t end);
+
+    /**
+     * Chordal L2 mean, from the batch or from its RotationSum.
+     */
+    static QuaternionType ChordalMean(const BatchType& q);
+    static QuaternionType ChordalMean(const SumType& rotation_sum);
+
+    /**
+     * Tangent space covariance about mean, from the batch or from its ScatterSum.
+     */
+    static SquareMatrix<3, Type> Covariance(const BatchType& q, const QuaternionType& mean);
+    static SquareMatrix<3, Type> Covariance(const SumType& scatter_sum);
+
+private:
+    // Rotation R maximizing trace(R^T M).
+    static SquareMatrix<3, Type> Project(const SquareMatrix<3, Type>& M);
+
+    template<typename Leaves>
+    static SumType reduce(size_t size, Leaves&& leaves);
+};
+
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Summation = KAHAN>
+using RotationStatisticsf = RotationStatistics<QuaternionConvention, float, Summation>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Summation = KAHAN>
+using RotationStatisticsd = RotationStatistics<QuaternionConvention, double, Summation>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Summation = KAHAN>
+using RotationStatisticsld = RotationStatistics<QuaternionConvention, long double, Summation>;
+
+#include "impl/RotationStatistics_impl.hpp"
+} // namespace tinyso3
@@ -0,0 +1,123 @@
+/**
+ * @file RotationTree.hpp
+ *
+ * Vantage point tree over a set of rotations, for k nearest neighbor and radius queries.
+ *
+ * Rotations are compared with the chordal distance between unit quaternions with q and -q identified,
+ * d = sqrt(2 - 2 |p . q|) = 2 sin(angle / 4), a metric monotonic in the rotation angle, evaluated without acos.
+ * Query results report the rotation angle [rad].
+ *
+ * The tree is stored in caller provided nodes, one per rotation, in depth first order,
+ * each node holding its rotation, the index of the rotation in the input and the median distance splitting its subtree.
+ * A node's inner subtree (distance <= threshold) follows it directly, its outer subtree (distance >= threshold) after that,
+ * so queries walk memory mostly forward. Nodes hold no pointers and may be stored and mapped again.
+ *
+ * The construction is a sequence of independent subtree builds, which may run on separate threads,
+ *
+ * RotationTree<HAMILTON, float> tree{nodes, count};
+ * RotationTree<HAMILTON, float>::Subtree subtrees[16];
+ * const size_t n = tree.buildTop(points, 4, subtrees); // first 4 levels, at most 16 subtrees left
+ * // tree.buildSubtree(subtrees[i]) for i in [0, n), on any thread
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+
+namespace tinyso3 {
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION, typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class RotationTree {
+public:
+    using QuaternionType = Quaternion<QuaternionConvention, Type>;
+
+    struct Node {
+        Type w, x, y, z;
+        Type threshold;  // chordal distance splitting the inner and outer subtrees
+        uint32_t index;  // position of the rotation in the input
+        uint32_t inner;  // nodes in the inner subtree
+    };
+
+    struct Subtree {
+        uint32_t begin, end; // range of nodes
+    };
+
+    struct Neighbor {
+        uint32_t index;
+        Type angle; // rotation angle [rad] to the query
+    };
+
+    /**
+     * Constructors, over size nodes, either to build or already built.
+     */
+    RotationTree(Node* nodes, size_t size) :
+    _nodes(nodes), _size(size) {}
+
+    /**
+     * Builds the tree of the unit quaternions, points.size() must equal size().
+     */
+    void build(const QuaternionBatch<QuaternionConvention, const Type>& points);
+
+    /**
+     * Builds the first levels of the tree, and writes the at most 2^levels subtrees left to build.
+     * Subtrees are disjoint, and may be built in any order or concurrently. The tree is complete when all are built.
+     */
+    size_t buildTop(const QuaternionBatch<QuaternionConvention, const Type>& points, size_t levels, Subtree* subtrees);
+    void buildSubtree(const Subtree& subtree);
+
+    /**
+     * Writes the min(k, size()) nearest rotations to q, closest first, returns their number.
+     */
+    size_t nearest(const QuaternionType& q, size_t k, Neighbor* neighbors) const;
+
+    /**
+     * Nearest rotations of every query, neighbors must hold queries.size() * k elements, k at most size().
+     */
+    void nearest(const QuaternionBatch<QuaternionConvention, const Type>& queries, size_t k, Neighbor* neighbors) const;
+
+    /**
+     * Finds the rotations within angle [rad] of q, in no particular order.
+     * Returns their number, of which the first capacity are written.
+     */
+    size_t radius(const QuaternionType& q, const Type& angle, Neighbor* neighbors, size_t capacity) const;
+
+    /**
+     * Accessors
+     */
+    inline const Node* nodes() const { return _nodes; }
+    inline size_t size() const { return _size; }
+
+private:
+    struct Query {
+        Type w, x, y, z;
+    };
+
+    void split(uint32_t begin, uint32_t end, size_t levels, Subtree* subtrees, size_t& count);
+    void select(uint32_t begin, uint32_t nth, uint32_t end);
+    void searchNearest(uint32_t begin, uint32_t end, const Query& q, size_t k, Neighbor* heap, size_t& count) const;
+    void searchRadius(uint32_t begin, uint32_t end, const Query& q, const Type& radius, Neighbor* neighbors, size_t capacity, size_t& count) const;
+
+    static inline Query query(const QuaternionType& q) { return Query{q.w(), q.x(), q.y(), q.z()}; }
+    static inline Type distance(const Query& q, const Node& node);
+    static inline Type chordal(const Type& angle);
+    static inline Type rotationAngle(const Type& chordal);
+    static inline void siftUp(Neighbor* heap, size_t i);
+    static inline void siftDown(Neighbor* heap, size_t size, size_t i);
+
+    Node* _nodes;
+    size_t _size;
+};
+
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RotationTreef = RotationTree<QuaternionConvention, float>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RotationTreed = RotationTree<QuaternionConvention, double>;
+template<typename QuaternionConvention = TINYSO3_DEFAULT_QUATERNION_CONVENTION>
+using RotationTreeld = RotationTree<QuaternionConvention, long double>;
+
+#include "impl/RotationTree_impl.hpp"
+} // namespace tinyso3
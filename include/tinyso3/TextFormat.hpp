@@ -0,0 +1,109 @@
+/**
+ * @file TextFormat.hpp
+ *
+ * Allocation-free, locale-independent conversion between floating point values and decimal text.
+ *
+ * Format writes the shortest digits that parse back to the same value (Grisu2, Loitsch 2010),
+ * which are the shortest possible in the vast majority of cases and always round trip.
+ * Output is plain decimal for exponents in [-6, 21), otherwise scientific, e.g. 0.125, 1e-07, 1.2345e+30.
+ * Not a number and infinities are written as nan, inf and -inf.
+ *
+ * Parse reads [+-]digits[.digits][(e|E)[+-]digits], inf, infinity and nan (case insensitive), correctly rounded.
+ * Inputs of at most 19 significant digits whose value is exactly representable after a single multiplication or
+ * division by a power of ten take a fast path (Clinger 1990). Others are multiplied by a cached power of ten within
+ * 64 bits while tracking the error bound, and only when that bound straddles a rounding boundary are they converted
+ * exactly with a bounded decimal buffer.
+ * The decimal point is always '.', regardless of the C locale.
+ *
+ * Type must be float or double.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "Matrix.hpp"
+
+namespace tinyso3 {
+template<typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class TextFormat {
+    static_assert(is_same<Type, float>::value || is_same<Type, double>::value, "Type must be float or double.");
+
+public:
+    /**
+     * Maximum characters written by Format for a single value, without a terminating null character.
+     */
+    static constexpr size_t MaxLength = 32;
+
+    /**
+     * Writes the shortest round trip text of the value, returns the number of characters written.
+     * Matrices are written row major, quaternions in their storage order, values separated by the separator.
+     * out must hold MaxLength characters per value.
+     */
+    static size_t Format(const Type& value, char* out);
+    template<size_t M, size_t N>
+    static size_t Format(const Matrix<M, N, Type>& matrix, char* out, char separator = ',');
+
+    /**
+     * Parses a value at cursor, advancing cursor past it.
+     * Returns false, leaving cursor and value unchanged, if [cursor, end) does not begin with a number.
+     * Matrices are read row major with the values separated by the separator and optional spaces.
+     */
+    static bool Parse(const char*& cursor, const char* end, Type& value);
+    template<size_t M, size_t N>
+    static bool Parse(const char*& cursor, const char* end, Matrix<M, N, Type>& matrix, char separator = ',');
+
+private:
+    using Bits = conditional_t<is_same<Type, double>::value, uint64_t, uint32_t>;
+    static constexpr int SignificandBits = is_same<Type, double>::value ? 52 : 23;
+    static constexpr int ExponentBits = is_same<Type, double>::value ? 11 : 8;
+    static constexpr int ExponentBias = (1 << (ExponentBits - 1)) - 1;
+    static constexpr int FastPathExponent = is_same<Type, double>::value ? 22 : 10; // 10^e is exact
+    static constexpr uint64_t FastPathSignificand = uint64_t(1) << (SignificandBits + 1);
+
+    // Unnormalized binary floating point f * 2^e.
+    struct DiyFp {
+        uint64_t f;
+        int e;
+    };
+
+    static inline DiyFp multiply(const DiyFp& a, const DiyFp& b);
+    static inline DiyFp normalize(DiyFp x);
+    static inline DiyFp cachedPower(int e, int& k);
+    static inline DiyFp cachedPower(size_t index); // 10^(-348 + 8 * index)
+    static inline void round(char* digits, size_t length, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t distance);
+    static void grisu2(const Type& value, char* digits, size_t& length, int& k);
+    static size_t prettify(char* out, size_t length, int k);
+
+    // Conversion within 64 bits, fails when the error bound straddles a rounding boundary.
+    static bool approximate(uint64_t mantissa, int digits, int exponent, bool truncated, Type& value);
+
+    // Exact conversion of a decimal text, the slow path of Parse.
+    struct Decimal {
+        static constexpr int Capacity = 800; // enough for the exact value of any double halfway point
+        unsigned char digits[Capacity];      // 0 to 9, most significant first
+        int count;                           // digits used
+        int point;                           // position of the decimal point relative to digits
+        bool truncated;                      // nonzero digits beyond Capacity were dropped
+
+        void shift(int k); // multiply by 2^k
+        void leftShift(int k);
+        void rightShift(int k);
+        void trim();
+        uint64_t roundedInteger() const;
+        Bits bits();
+    };
+
+    static inline Type fromBits(Bits bits);
+    static inline Bits toBits(const Type& value);
+    static inline bool match(const char* cursor, const char* end, const char* word);
+};
+
+using TextFormatf = TextFormat<float>;
+using TextFormatd = TextFormat<double>;
+
+#include "impl/TextFormat_impl.hpp"
+} // namespace tinyso3
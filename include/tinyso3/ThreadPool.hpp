@@ -0,0 +1,123 @@
+/**
+ * @file ThreadPool.hpp
+ *
+ * Work stealing thread pool, with parallel loops and reductions over index ranges, e.g. of batch views.
+ *
+ * Unlike the rest of the library this header depends on the C++ standard library threads and allocates,
+ * and is not included by tinyso3.hpp.
+ *
+ * A range [0, size) is cut into chunks of grain indices, spread evenly over the threads of the pool,
+ * the calling thread included. A thread runs the chunks of its own range from the front,
+ * and once done steals the back half of the remaining chunks of another, so uneven chunks are balanced.
+ *
+ * With Chunking::DYNAMIC the default grain gives each thread about 8 chunks, and a reduction combines
+ * one partial result per thread, which depends on the schedule for floating point results.
+ * With Chunking::DETERMINISTIC the default grain depends on the size only (at most 256 chunks),
+ * and a reduction combines the partial result of each chunk pairwise in chunk order,
+ * so results are identical for any number of threads and run to run.
+ *
+ * ThreadPool pool{4};
+ * const QuaternionBatch<HAMILTON, const float> q{w, x, y, z, count};
+ * pool.parallelFor(count, [&](size_t begin, size_t end) {
+ *     RotationGrid<64, HAMILTON, float>::Quantize(q.slice(begin, end - begin), cells + begin);
+ * });
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace tinyso3 {
+enum class Chunking {
+    DYNAMIC,
+    DETERMINISTIC
+};
+
+class ThreadPool {
+public:
+    /**
+     * Constructors, with threads participating in each loop, the calling thread included,
+     * the hardware concurrency if 0. The pool starts threads - 1 workers, waiting for loops.
+     */
+    explicit ThreadPool(size_t threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Calls function(chunk, thread) for every chunk in [0, chunks), fewer than 2^32, returns when all are done.
+     * thread in [0, size()) identifies the calling thread, 0 is the thread calling run.
+     * Loops are run one at a time, from one thread, and function must not throw.
+     */
+    template<typename Function>
+    void run(size_t chunks, Function&& function);
+
+    /**
+     * Calls function(begin, end) for consecutive chunks covering [0, size), of grain indices, or the default of chunking if 0.
+     */
+    template<typename Function>
+    void parallelFor(size_t size, Function&& function, size_t grain = 0, Chunking chunking = Chunking::DYNAMIC);
+
+    /**
+     * Reduces [0, size), map(begin, end) returns the partial result of a chunk, combine(a, b) joins two partial results,
+     * associatively, identity being neutral.
+     */
+    template<typename Type, typename Map, typename Combine>
+    Type parallelReduce(size_t size, const Type& identity, Map&& map, Combine&& combine, size_t grain = 0, Chunking chunking = Chunking::DETERMINISTIC);
+
+    /**
+     * Indices per chunk of a loop over [0, size), grain if not 0.
+     */
+    size_t chunkSize(size_t size, size_t grain, Chunking chunking) const;
+
+    /**
+     * Accessors
+     */
+    inline size_t size() const { return _size; }
+
+private:
+    using Invoke = void (*)(void* context, size_t chunk, size_t thread);
+
+    // Chunks [begin, end) left to a thread, packed in one word so that the owner and thieves update it atomically.
+    struct Range {
+        std::atomic<uint64_t> bounds;
+        char padding[64 - sizeof(std::atomic<uint64_t>)]; // one cache line per thread
+    };
+
+    static inline uint64_t pack(uint64_t begin, uint64_t end) { return begin | end << 32; }
+
+    void dispatch(size_t chunks, Invoke invoke, void* context);
+    void loop(size_t thread);
+    void work(size_t thread);
+    bool pop(size_t thread, size_t& chunk);
+    bool steal(size_t thread);
+
+    size_t _size;
+    std::unique_ptr<Range[]> _ranges;
+    std::vector<std::thread> _workers;
+
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _done;
+    uint64_t _generation{0}; // loops started, guarded by _mutex
+    size_t _busy{0};         // workers still in the current loop, guarded by _mutex
+    bool _stop{false};
+
+    Invoke _invoke{nullptr};
+    void* _context{nullptr};
+    std::atomic<size_t> _remaining{0}; // chunks of the current loop not yet done
+};
+
+#include "impl/ThreadPool_impl.hpp"
+} // namespace tinyso3
@@ -0,0 +1,69 @@
+/**
+ * @file Vector3Batch.hpp
+ *
+ * A non-owning structure of arrays view over N 3D vectors.
+ *
+ * Components are stored in three separate arrays x[N], y[N], z[N], owned by the user.
+ * Type may be const qualified for read only views, e.g. Vector3Batch<const float>,
+ * or a storage only type (Half, BFloat16), converted to float on access.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "Vector3.hpp"
+
+namespace tinyso3 {
+template<typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class Vector3Batch {
+public:
+    using ValueType = compute_type_t<remove_const_t<Type>>;
+
+    /**
+     * Constructors
+     */
+    Vector3Batch(Type* x, Type* y, Type* z, size_t size) :
+    _x(x), _y(y), _z(z), _size(size) {}
+
+    // A mutable view converts to a read only view.
+    template<typename Other, enable_if_t<(is_same<const Other, Type>::value && !is_same<Other, Type>::value), int> = 0>
+    Vector3Batch(const Vector3Batch<Other>& other) :
+    _x(other.x()), _y(other.y()), _z(other.z()), _size(other.size()) {}
+
+    /**
+     * Element access
+     */
+    inline Vector3<ValueType> operator[](size_t i) const { return Vector3<ValueType>{_x[i], _y[i], _z[i]}; }
+
+    template<typename T = Type, enable_if_t<(is_same<T, remove_const_t<T>>::value), int> = 0>
+    inline void set(size_t i, const Vector3<ValueType>& v) const {
+        _x[i] = v.x();
+        _y[i] = v.y();
+        _z[i] = v.z();
+    }
+
+    /**
+     * View over the size elements from offset, e.g. a chunk of a batch processed by one thread.
+     */
+    inline Vector3Batch slice(size_t offset, size_t size) const { return Vector3Batch{_x + offset, _y + offset, _z + offset, size}; }
+
+    /**
+     * Accessors
+     */
+    inline Type* x() const { return _x; }
+    inline Type* y() const { return _y; }
+    inline Type* z() const { return _z; }
+    inline size_t size() const { return _size; }
+
+private:
+    Type* _x;
+    Type* _y;
+    Type* _z;
+    size_t _size;
+};
+
+using Vector3Batchf = Vector3Batch<float>;
+using Vector3Batchd = Vector3Batch<double>;
+using Vector3Batchld = Vector3Batch<long double>;
+} // namespace tinyso3
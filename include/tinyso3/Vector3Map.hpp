@@ -0,0 +1,82 @@
+/**
+ * @file Vector3Map.hpp
+ *
+ * A non-owning 3D vector view over external memory.
+ *
+ * Component i is data[i * stride], e.g. stride 3 walks one column of a row major 3x3 buffer.
+ * Type may be const qualified for read only views, e.g. Vector3Map<const float>.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include "MatrixMap.hpp"
+#include "Vector3.hpp"
+#include "SquareMatrix.hpp"
+
+namespace tinyso3 {
+template<typename Type = TINYSO3_DEFAULT_FLOATING_POINT_TYPE>
+class Vector3Map : public MatrixMap<3, 1, Type> {
+public:
+    using typename MatrixMap<3, 1, Type>::ValueType;
+    using VectorType = Vector3<ValueType>;
+
+    /**
+     * Constructors
+     */
+    Vector3Map(Type* data, size_t stride = 1) :
+    MatrixMap<3, 1, Type>(data, stride, 1) {}
+
+    // A mutable view converts to a read only view.
+    template<typename Other, enable_if_t<(is_same<const Other, Type>::value && !is_same<Other, Type>::value), int> = 0>
+    Vector3Map(const Vector3Map<Other>& other) :
+    MatrixMap<3, 1, Type>(other) {}
+
+    /**
+     * Assignment, writes through the view.
+     */
+    using MatrixMap<3, 1, Type>::operator=;
+
+    /**
+     * Accessors
+     */
+    inline Type& operator()(size_t i) const { return this->_data[i * this->_row_stride]; }
+    inline Type& x() const { return (*this)(0); }
+    inline Type& y() const { return (*this)(1); }
+    inline Type& z() const { return (*this)(2); }
+    inline size_t stride() const { return this->_row_stride; }
+
+    /**
+     * Copy to an owning vector
+     */
+    inline VectorType vector() const { return VectorType{x(), y(), z()}; }
+    inline operator VectorType() const { return vector(); }
+
+    /**
+     * Vector3 Group Operations
+     */
+    inline VectorType operator+(ValueType scalar) const { return vector() + scalar; }
+    inline VectorType operator-(ValueType scalar) const { return vector() - scalar; }
+    inline VectorType operator*(ValueType scalar) const { return vector() * scalar; }
+    inline VectorType operator/(ValueType scalar) const { return vector() / scalar; }
+    inline VectorType operator-() const { return -vector(); }
+    inline VectorType operator+(const VectorType& other) const { return vector() + other; }
+    inline VectorType operator-(const VectorType& other) const { return vector() - other; }
+
+    inline friend VectorType operator+(ValueType lhs, const Vector3Map& rhs) { return rhs + lhs; }
+    inline friend VectorType operator-(ValueType lhs, const Vector3Map& rhs) { return -rhs + lhs; }
+    inline friend VectorType operator*(ValueType lhs, const Vector3Map& rhs) { return rhs * lhs; }
+
+    inline ValueType dot(const VectorType& other) const { return vector().dot(other); }
+    inline VectorType cross(const VectorType& other) const { return vector().cross(other); }
+    inline ValueType norm() const { return vector().norm(); }
+    inline ValueType squaredNorm() const { return vector().squaredNorm(); }
+    inline VectorType unit() const { return vector().unit(); }
+    inline SquareMatrix<3, ValueType> hat() const { return vector().hat(); }
+};
+
+using Vector3Mapf = Vector3Map<float>;
+using Vector3Mapd = Vector3Map<double>;
+using Vector3Mapld = Vector3Map<long double>;
+} // namespace tinyso3
@@ -144,4 +144,87 @@ struct is_quaternion_convention<HAMILTON> : true_type {};
 template<>
 struct is_quaternion_convention<JPL> : true_type {};
 
+/**
+ * Interpolation between two timestamped samples.
+ * HERMITE uses the angular velocities of both samples as tangents.
+ */
+enum class Interpolation {
+    SLERP,
+    NLERP,
+    HERMITE
+};
+
+/**
+ * Nonlinear least squares methods.
+ * LEVENBERG_MARQUARDT damps the normal equations and rejects steps increasing the cost.
+ */
+enum class Optimization {
+    GAUSS_NEWTON,
+    LEVENBERG_MARQUARDT
+};
+
+/**
+ * Attitude propagation schemes from angular velocity samples.
+ * EXPONENTIAL holds the mean angular velocity over a step, RK4 integrates the quaternion ODE,
+ * MAGNUS4 is the 4th-order Magnus expansion including the coning correction.
+ */
+enum class AttitudeIntegration {
+    EXPONENTIAL,
+    RK4,
+    MAGNUS4
+};
+
+using EXPONENTIAL = integral_constant<AttitudeIntegration, AttitudeIntegration::EXPONENTIAL>;
+using RK4 = integral_constant<AttitudeIntegration, AttitudeIntegration::RK4>;
+using MAGNUS4 = integral_constant<AttitudeIntegration, AttitudeIntegration::MAGNUS4>;
+
+template<typename T>
+struct is_attitude_integration : false_type {};
+template<>
+struct is_attitude_integration<EXPONENTIAL> : true_type {};
+template<>
+struct is_attitude_integration<RK4> : true_type {};
+template<>
+struct is_attitude_integration<MAGNUS4> : true_type {};
+
+/**
+ * Rigid body rotational dynamics schemes.
+ * SPLITTING composes the exact flows about each principal axis (explicit, symplectic),
+ * MIDPOINT is the implicit midpoint rule, conserving the kinetic energy and |angular momentum| of the free body.
+ */
+enum class RigidBodyIntegration {
+    SPLITTING,
+    MIDPOINT
+};
+
+using SPLITTING = integral_constant<RigidBodyIntegration, RigidBodyIntegration::SPLITTING>;
+using MIDPOINT = integral_constant<RigidBodyIntegration, RigidBodyIntegration::MIDPOINT>;
+
+template<typename T>
+struct is_rigid_body_integration : false_type {};
+template<>
+struct is_rigid_body_integration<SPLITTING> : true_type {};
+template<>
+struct is_rigid_body_integration<MIDPOINT> : true_type {};
+
+/**
+ * Summation of floating point values.
+ * NAIVE adds to a running sum, KAHAN also carries the rounding error of each addition (Neumaier's variant),
+ * for a total error independent of the number of values.
+ */
+enum class Summation {
+    NAIVE,
+    KAHAN
+};
+
+using NAIVE = integral_constant<Summation, Summation::NAIVE>;
+using KAHAN = integral_constant<Summation, Summation::KAHAN>;
+
+template<typename T>
+struct is_summation : false_type {};
+template<>
+struct is_summation<NAIVE> : true_type {};
+template<>
+struct is_summation<KAHAN> : true_type {};
+
 }; // namespace tinyso3
\ No newline at end of file
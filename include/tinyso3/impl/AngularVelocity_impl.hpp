@@ -13,27 +13,13 @@
 template<typename Type>
 template<typename EulerConvention, typename EulerSequence>
 AngularVelocity<Type>::AngularVelocity(const Euler<EulerConvention, EulerSequence, Type>& euler, const EulerRate<EulerConvention, EulerSequence, Type>& euler_rate) {
-    if(is_same<EulerConvention, INTRINSIC>::value) {
-        const RotationMatrix<PASSIVE, Type> principal_3 =
-          RotationMatrix<PASSIVE, Type>::template RotatePrincipalAxis<integral_constant<PrincipalAxis, EulerSequence::Axis3>>(euler(2));
-        const RotationMatrix<PASSIVE, Type> principal_2 =
-          RotationMatrix<PASSIVE, Type>::template RotatePrincipalAxis<integral_constant<PrincipalAxis, EulerSequence::Axis2>>(euler(1));
+    (*this) = EulerRate<EulerConvention, EulerSequence, Type>::KinematicMatrix(euler) * euler_rate;
+}
 
-        SquareMatrix<3, Type> temp{};
-        temp.template setCol<0>((principal_3 * principal_2).template col<0>());
-        temp.template setCol<1>(principal_3.template col<1>());
-        temp.template setCol<2>(Matrix<3, 1, Type>{Type(0), Type(0), Type(1)});
-        (*this) = temp * euler_rate;
-    } else if(is_same<EulerConvention, EXTRINSIC>::value) {
-        const RotationMatrix<PASSIVE, Type> principal_1 =
-          RotationMatrix<PASSIVE, Type>::template RotatePrincipalAxis<integral_constant<PrincipalAxis, EulerSequence::Axis1>>(euler(0));
-        const RotationMatrix<PASSIVE, Type> principal_2 =
-          RotationMatrix<PASSIVE, Type>::template RotatePrincipalAxis<integral_constant<PrincipalAxis, EulerSequence::Axis2>>(euler(1));
-
-        SquareMatrix<3, Type> temp{};
-        temp.template setCol<0>(Matrix<3, 1, Type>{Type(1), Type(0), Type(0)});
-        temp.template setCol<1>(principal_1.template col<1>());
-        temp.template setCol<2>((principal_1 * principal_2).template col<2>());
-        (*this) = temp * euler_rate;
+template<typename Type>
+template<typename EulerConvention, typename EulerSequence>
+void AngularVelocity<Type>::FromEulerRates(const Euler<EulerConvention, EulerSequence, Type>* euler, const EulerRate<EulerConvention, EulerSequence, Type>* euler_rate, AngularVelocity* angular_velocity, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        angular_velocity[i] = AngularVelocity{euler[i], euler_rate[i]};
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,106 @@
+/**
+ * @file AttitudeIntegrator_impl.hpp
+ *
+ * Attitude propagation from body(local) frame angular velocity samples.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename AttitudeIntegrationScheme, typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, Type>::step(const QuaternionType& q, const AngularVelocity<Type>& w0, const AngularVelocity<Type>& w1, const Type& dt) const {
+    const Vector3<Type> wm = (w0 + w1) / Type(2);
+    return renormalize(integrate(Scheme{}, q, w0, wm, w1, dt));
+}
+
+template<typename AttitudeIntegrationScheme, typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, Type>::step(const QuaternionType& q, const AngularVelocity<Type>& w0, const AngularVelocity<Type>& wm, const AngularVelocity<Type>& w1, const Type& dt) const {
+    return renormalize(integrate(Scheme{}, q, w0, wm, w1, dt));
+}
+
+template<typename AttitudeIntegrationScheme, typename QuaternionConvention, typename Type>
+void AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, Type>::step(const QuaternionBatch<QuaternionConvention, Type>& q, const Vector3Batch<const Type>& w0, const Vector3Batch<const Type>& w1, const Type& dt) const {
+    assert(q.size() == w0.size() && q.size() == w1.size());
+
+    for(size_t i = 0; i < q.size(); i++) {
+        const Vector3<Type> a = w0[i];
+        const Vector3<Type> b = w1[i];
+        q.set(i, renormalize(integrate(Scheme{}, q[i], a, (a + b) / Type(2), b, dt)));
+    }
+}
+
+template<typename AttitudeIntegrationScheme, typename QuaternionConvention, typename Type>
+void AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, Type>::step(const QuaternionBatch<QuaternionConvention, Type>& q, const Vector3Batch<const Type>& w0, const Vector3Batch<const Type>& wm, const Vector3Batch<const Type>& w1, const Type& dt) const {
+    assert(q.size() == w0.size() && q.size() == wm.size() && q.size() == w1.size());
+
+    for(size_t i = 0; i < q.size(); i++) {
+        q.set(i, renormalize(integrate(Scheme{}, q[i], w0[i], wm[i], w1[i], dt)));
+    }
+}
+
+template<typename AttitudeIntegrationScheme, typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, Type>::renormalize(const QuaternionType& q) const {
+    const Type n2 = q.dot(q);
+    if(fabs(Type(1) - n2) <= _tolerance) {
+        return q;
+    }
+
+    // One Newton step towards |q| = 1, the residual becomes (1 - |q|^2)^2 order.
+    return QuaternionType{Vector<4, Type>{q} * ((Type(3) - n2) / Type(2))};
+}
+
+template<typename AttitudeIntegrationScheme, typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, Type>::integrate(EXPONENTIAL, const QuaternionType& q, const Vector3<Type>& w0, const Vector3<Type>& wm, const Vector3<Type>& w1, const Type& dt) const {
+    return q.boxplus((w0 + wm * Type(4) + w1) * (dt / Type(6)));
+}
+
+template<typename AttitudeIntegrationScheme, typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, Type>::integrate(RK4, const QuaternionType& q, const Vector3<Type>& w0, const Vector3<Type>& wm, const Vector3<Type>& w1, const Type& dt) const {
+    const Type half = dt / Type(2);
+    const QuaternionType k1 = derivative(q, w0);
+    const QuaternionType k2 = derivative(add(q, k1, half), wm);
+    const QuaternionType k3 = derivative(add(q, k2, half), wm);
+    const QuaternionType k4 = derivative(add(q, k3, dt), w1);
+
+    const Vector<4, Type> sum = Vector<4, Type>{k1} + Vector<4, Type>{k2} * Type(2) + Vector<4, Type>{k3} * Type(2) + Vector<4, Type>{k4};
+    return QuaternionType{Vector<4, Type>{q} + sum * (dt / Type(6))};
+}
+
+template<typename AttitudeIntegrationScheme, typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, Type>::integrate(MAGNUS4, const QuaternionType& q, const Vector3<Type>& w0, const Vector3<Type>& wm, const Vector3<Type>& w1, const Type& dt) const {
+    // Quadratic Lagrange interpolation at the Gauss points tau = 1/2 -+ sqrt(3)/6,
+    // l0 = 2(tau - 1/2)(tau - 1), lm = -4 tau (tau - 1), l1 = 2 tau (tau - 1/2).
+    const Type sqrt3 = sqrt(Type(3));
+    const Type l0 = (Type(1) + sqrt3) / Type(6);
+    const Type lm = Type(2) / Type(3);
+    const Type l1 = (Type(1) - sqrt3) / Type(6);
+
+    const Vector3<Type> wg1 = w0 * l0 + wm * lm + w1 * l1;
+    const Vector3<Type> wg2 = w0 * l1 + wm * lm + w1 * l0;
+    const Vector3<Type> phi = (wg1 + wg2) * (dt / Type(2)) + wg1.cross(wg2) * (sqrt3 / Type(12) * dt * dt);
+    return q.boxplus(phi);
+}
+
+template<typename AttitudeIntegrationScheme, typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, Type>::derivative(const QuaternionType& q, const Vector3<Type>& w) {
+    // HAMILTON : dq = q * (0, w / 2), JPL : dq = (-w / 2, 0) * q
+    const Type s = is_same<QuaternionConvention, HAMILTON>::value ? Type(0.5) : Type(-0.5);
+
+    QuaternionType omega;
+    omega.w() = Type(0);
+    omega.x() = w.x() * s;
+    omega.y() = w.y() * s;
+    omega.z() = w.z() * s;
+
+    if(is_same<QuaternionConvention, HAMILTON>::value) {
+        return q * omega;
+    }
+
+    return omega * q;
+}
+
+template<typename AttitudeIntegrationScheme, typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> AttitudeIntegrator<AttitudeIntegrationScheme, QuaternionConvention, Type>::add(const QuaternionType& q, const QuaternionType& k, const Type& s) {
+    return QuaternionType{Vector<4, Type>{q} + Vector<4, Type>{k} * s};
+}
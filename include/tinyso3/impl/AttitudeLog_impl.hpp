@@ -0,0 +1,271 @@
+/**
+ * @file AttitudeLog_impl.hpp
+ *
+ * A versioned, chunked, columnar binary format for timestamped attitudes.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+inline AttitudeLogReader::AttitudeLogReader(const void* data, size_t size) :
+_data(static_cast<const unsigned char*>(data)), _size(size), _header(nullptr), _footer(nullptr), _index(nullptr), _valid(false) {
+    assert(reinterpret_cast<uintptr_t>(data) % 8 == 0);
+
+    if(size < sizeof(AttitudeLogHeader) + sizeof(AttitudeLogFooter)) {
+        return;
+    }
+
+    _header = reinterpret_cast<const AttitudeLogHeader*>(_data);
+    _footer = reinterpret_cast<const AttitudeLogFooter*>(_data + size - sizeof(AttitudeLogFooter));
+
+    if(!equal(_header->magic, "TSO3LOG", 8) || !equal(_footer->magic, "TSO3END", 8) ||
+       _header->version != AttitudeLogVersion || _header->byte_order != AttitudeLogByteOrder ||
+       (_header->components != 4 && _header->components != 9)) {
+        return;
+    }
+
+    // Bounds are checked by subtraction and division only, sizes read from the log may be close to 2^64.
+    const uint64_t index_offset = _footer->index_offset;
+    const uint64_t index_end = size - sizeof(AttitudeLogFooter);
+    if(index_offset % 8 != 0 || index_offset < sizeof(AttitudeLogHeader) || index_offset > index_end ||
+       _footer->chunks > (index_end - index_offset) / sizeof(AttitudeLogIndexEntry) ||
+       _footer->chunks * sizeof(AttitudeLogIndexEntry) != index_end - index_offset) {
+        return;
+    }
+    _index = reinterpret_cast<const AttitudeLogIndexEntry*>(_data + index_offset);
+
+    // Every chunk lies between the header and the index, with a matching chunk header.
+    const uint64_t record_size = sizeof(double) + static_cast<uint64_t>(_header->components) * _header->scalar_size;
+    uint64_t records = 0;
+    for(uint64_t i = 0; i < _footer->chunks; i++) {
+        const AttitudeLogIndexEntry& entry = _index[i];
+        if(entry.offset % 8 != 0 || entry.offset < sizeof(AttitudeLogHeader) || entry.offset > index_offset ||
+           index_offset - entry.offset < sizeof(AttitudeLogChunkHeader)) {
+            return;
+        }
+
+        const AttitudeLogChunkHeader* chunk = reinterpret_cast<const AttitudeLogChunkHeader*>(_data + entry.offset);
+        if(chunk->magic != AttitudeLogChunkMagic || chunk->count != entry.count || chunk->size < sizeof(AttitudeLogChunkHeader) ||
+           chunk->size > index_offset - entry.offset || entry.count > (chunk->size - sizeof(AttitudeLogChunkHeader)) / record_size ||
+           entry.count > _footer->records - records) {
+            return;
+        }
+        records += entry.count;
+    }
+
+    _valid = records == _footer->records;
+}
+
+template<typename Convention, typename Type>
+bool AttitudeLogReader::holds() const {
+    return _valid && _header->convention == attitude_log_convention<Convention>::value && _header->scalar_size == sizeof(Type) &&
+           _header->components == (is_quaternion_convention<Convention>::value ? 4u : 9u);
+}
+
+inline size_t AttitudeLogReader::find(double t) const {
+    size_t lower = 0;
+    size_t upper = chunks();
+    while(lower < upper) {
+        const size_t middle = lower + (upper - lower) / 2;
+        if(_index[middle].last < t) {
+            lower = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+    return lower;
+}
+
+inline const double* AttitudeLogReader::timestamps(size_t chunk) const {
+    assert(chunk < chunks());
+    return reinterpret_cast<const double*>(_data + _index[chunk].offset + sizeof(AttitudeLogChunkHeader));
+}
+
+template<typename QuaternionConvention, typename Type, enable_if_t<(is_quaternion_convention<QuaternionConvention>::value), int>>
+QuaternionBatch<QuaternionConvention, const Type> AttitudeLogReader::quaternions(size_t chunk) const {
+    assert((holds<QuaternionConvention, Type>()));
+    return QuaternionBatch<QuaternionConvention, const Type>{column<Type>(chunk, 0), column<Type>(chunk, 1), column<Type>(chunk, 2), column<Type>(chunk, 3), static_cast<size_t>(_index[chunk].count)};
+}
+
+template<typename RotationMatrixConvention, typename Type, enable_if_t<(is_rotation_matrix_convention<RotationMatrixConvention>::value), int>>
+RotationMatrixBatch<RotationMatrixConvention, const Type> AttitudeLogReader::rotationMatrices(size_t chunk) const {
+    assert((holds<RotationMatrixConvention, Type>()));
+    const Type* elements[9];
+    for(size_t k = 0; k < 9; k++) {
+        elements[k] = column<Type>(chunk, k);
+    }
+    return RotationMatrixBatch<RotationMatrixConvention, const Type>{elements, static_cast<size_t>(_index[chunk].count)};
+}
+
+template<typename Type>
+const Type* AttitudeLogReader::column(size_t chunk, size_t component) const {
+    assert(chunk < chunks());
+    const size_t count = static_cast<size_t>(_index[chunk].count);
+    return reinterpret_cast<const Type*>(_data + _index[chunk].offset + sizeof(AttitudeLogChunkHeader) + count * sizeof(double) + component * count * sizeof(Type));
+}
+
+inline bool AttitudeLogReader::equal(const char* a, const char* b, size_t n) {
+    for(size_t i = 0; i < n; i++) {
+        if(a[i] != b[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::AttitudeLogWriter(const Sink& sink, AttitudeLogIndexEntry* index, size_t index_capacity) :
+_sink(sink), _index(index), _index_capacity(index_capacity) {}
+
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+bool AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::append(double timestamp, const ValueType& value) {
+    if(_closed || _chunks == _index_capacity) {
+        return false;
+    }
+    assert(_count == 0 || timestamp >= _timestamps[_count - 1]);
+
+    Type out[Components];
+    components(value, out, integral_constant<bool, IsQuaternion>{});
+    _timestamps[_count] = timestamp;
+    for(size_t k = 0; k < Components; k++) {
+        _columns[k][_count] = out[k];
+    }
+
+    _count++;
+    return _count < ChunkSize || flush();
+}
+
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+bool AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::append(const double* timestamps, const BatchType& values) {
+    if(_closed || _chunks == _index_capacity) {
+        return false;
+    }
+
+    size_t i = 0;
+    while(i < values.size()) {
+        const size_t n = values.size() - i < ChunkSize - _count ? values.size() - i : ChunkSize - _count;
+        for(size_t j = 0; j < n; j++) {
+            _timestamps[_count + j] = timestamps[i + j];
+        }
+        for(size_t k = 0; k < Components; k++) {
+            const Type* source = column(values, k, integral_constant<bool, IsQuaternion>{}) + i;
+            for(size_t j = 0; j < n; j++) {
+                _columns[k][_count + j] = source[j];
+            }
+        }
+
+        _count += n;
+        i += n;
+        if(_count == ChunkSize && (!flush() || (i < values.size() && _chunks == _index_capacity))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+bool AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::flush() {
+    if(_closed) {
+        return false;
+    }
+
+    if(_offset == 0) {
+        AttitudeLogHeader header{{'T', 'S', 'O', '3', 'L', 'O', 'G', '\0'}, AttitudeLogVersion, AttitudeLogByteOrder, attitude_log_convention<Convention>::value, sizeof(Type), Components, 0};
+        if(!write(&header, sizeof(header))) {
+            return false;
+        }
+    }
+
+    if(_count == 0) {
+        return true;
+    }
+    if(_chunks == _index_capacity) {
+        return false;
+    }
+
+    const uint64_t payload = sizeof(AttitudeLogChunkHeader) + _count * (sizeof(double) + Components * sizeof(Type));
+    const uint64_t padding = (8 - payload % 8) % 8;
+    const AttitudeLogChunkHeader chunk{AttitudeLogChunkMagic, static_cast<uint32_t>(_count), payload + padding};
+    _index[_chunks] = AttitudeLogIndexEntry{_offset, _count, _timestamps[0], _timestamps[_count - 1]};
+
+    const unsigned char zeros[8] = {};
+    if(!write(&chunk, sizeof(chunk)) || !write(_timestamps, _count * sizeof(double))) {
+        return false;
+    }
+    for(size_t k = 0; k < Components; k++) {
+        if(!write(_columns[k], _count * sizeof(Type))) {
+            return false;
+        }
+    }
+    if(!write(zeros, static_cast<size_t>(padding))) {
+        return false;
+    }
+
+    _chunks++;
+    _records += _count;
+    _count = 0;
+    return true;
+}
+
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+bool AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::close() {
+    if(!flush()) {
+        return false;
+    }
+
+    const AttitudeLogFooter footer{_offset, _chunks, _records, {'T', 'S', 'O', '3', 'E', 'N', 'D', '\0'}};
+    if(!write(_index, _chunks * sizeof(AttitudeLogIndexEntry)) || !write(&footer, sizeof(footer))) {
+        return false;
+    }
+
+    _closed = true;
+    return true;
+}
+
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+bool AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::write(const void* data, size_t size) {
+    if(size == 0) {
+        return true;
+    }
+    if(!_sink(data, size)) {
+        return false;
+    }
+    _offset += size;
+    return true;
+}
+
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+template<typename Value>
+void AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::components(const Value& value, Type* out, true_type) {
+    out[0] = value.w();
+    out[1] = value.x();
+    out[2] = value.y();
+    out[3] = value.z();
+}
+
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+template<typename Value>
+void AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::components(const Value& value, Type* out, false_type) {
+    for(size_t k = 0; k < 9; k++) {
+        out[k] = value(k / 3, k % 3);
+    }
+}
+
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+template<typename Batch>
+const Type* AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::column(const Batch& batch, size_t component, true_type) {
+    const Type* columns[4] = {batch.w(), batch.x(), batch.y(), batch.z()};
+    return columns[component];
+}
+
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+template<typename Batch>
+const Type* AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::column(const Batch& batch, size_t component, false_type) {
+    return batch.element(component / 3, component % 3);
+}
+
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+constexpr bool AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::IsQuaternion;
+template<typename Convention, typename Type, typename Sink, size_t ChunkSize>
+constexpr size_t AttitudeLogWriter<Convention, Type, Sink, ChunkSize>::Components;
@@ -0,0 +1,167 @@
+/**
+ * @file AttitudeRingBuffer_impl.hpp
+ *
+ * Lock-free ring buffer of timestamped attitude samples, written by one producer and interpolated by any number of readers.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename QuaternionConvention, typename Type>
+constexpr size_t AttitudeRingBuffer<QuaternionConvention, Type>::Busy;
+template<typename QuaternionConvention, typename Type>
+constexpr size_t AttitudeRingBuffer<QuaternionConvention, Type>::Words;
+template<typename QuaternionConvention, typename Type>
+constexpr size_t AttitudeRingBuffer<QuaternionConvention, Type>::TimeWords;
+
+template<typename QuaternionConvention, typename Type>
+AttitudeRingBuffer<QuaternionConvention, Type>::AttitudeRingBuffer(Slot* slots, size_t capacity, Interpolation interpolation) :
+_slots(slots), _capacity(capacity), _interpolation(interpolation) {
+    assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+    for(size_t i = 0; i < capacity; i++) {
+        _slots[i].sequence = 0;
+    }
+}
+
+template<typename QuaternionConvention, typename Type>
+bool AttitudeRingBuffer<QuaternionConvention, Type>::push(const Sample& sample) {
+    const size_t head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+    if(head > 0 && !(sample.time > _last_time)) {
+        return false;
+    }
+
+    size_t words[Words] = {};
+    memcpy(words, &sample, sizeof(Sample));
+
+    // Mark the slot busy before overwriting it, publish it with its new index after.
+    Slot& slot = _slots[head & (_capacity - 1)];
+    __atomic_store_n(&slot.sequence, Busy, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    for(size_t k = 0; k < Words; k++) {
+        __atomic_store_n(&slot.words[k], words[k], __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&slot.sequence, head + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&_head, head + 1, __ATOMIC_RELEASE);
+    _last_time = sample.time;
+    return true;
+}
+
+template<typename QuaternionConvention, typename Type>
+bool AttitudeRingBuffer<QuaternionConvention, Type>::at(const Type& time, QuaternionType& quaternion) const {
+    // Each retry follows an overwrite by the producer, which has then moved on.
+    for(;;) {
+        const size_t head = pushed();
+        if(head == 0) {
+            return false;
+        }
+
+        Sample newest;
+        if(!read(head - 1, newest)) {
+            continue;
+        }
+        if(time > newest.time) {
+            return false;
+        }
+        if(!(time < newest.time)) {
+            quaternion = newest.quaternion;
+            return true;
+        }
+
+        // The last sample at or before time, in [oldest, head - 1).
+        size_t lower = head > _capacity ? head - _capacity : 0;
+        size_t upper = head - 1;
+        Type lower_time;
+        if(!readTime(lower, lower_time)) {
+            continue;
+        }
+        if(time < lower_time) {
+            return false;
+        }
+
+        bool overwritten = false;
+        while(upper - lower > 1 && !overwritten) {
+            const size_t middle = lower + (upper - lower) / 2;
+            Type middle_time;
+            overwritten = !readTime(middle, middle_time);
+            if(middle_time <= time) {
+                lower = middle;
+            } else {
+                upper = middle;
+            }
+        }
+
+        Sample from, to;
+        if(overwritten || !read(lower, from) || !read(lower + 1, to)) {
+            continue;
+        }
+        quaternion = interpolate(from, to, time);
+        return true;
+    }
+}
+
+template<typename QuaternionConvention, typename Type>
+bool AttitudeRingBuffer<QuaternionConvention, Type>::latest(Sample& sample) const {
+    for(;;) {
+        const size_t head = pushed();
+        if(head == 0) {
+            return false;
+        }
+        if(read(head - 1, sample)) {
+            return true;
+        }
+    }
+}
+
+template<typename QuaternionConvention, typename Type>
+bool AttitudeRingBuffer<QuaternionConvention, Type>::read(size_t i, Sample& sample) const {
+    const Slot& slot = _slots[i & (_capacity - 1)];
+    if(__atomic_load_n(&slot.sequence, __ATOMIC_ACQUIRE) != i + 1) {
+        return false;
+    }
+    size_t words[Words];
+    for(size_t k = 0; k < Words; k++) {
+        words[k] = __atomic_load_n(&slot.words[k], __ATOMIC_RELAXED);
+    }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if(__atomic_load_n(&slot.sequence, __ATOMIC_RELAXED) != i + 1) {
+        return false;
+    }
+    memcpy(&sample, words, sizeof(Sample));
+    return true;
+}
+
+template<typename QuaternionConvention, typename Type>
+bool AttitudeRingBuffer<QuaternionConvention, Type>::readTime(size_t i, Type& time) const {
+    const Slot& slot = _slots[i & (_capacity - 1)];
+    time = Type(0);
+    if(__atomic_load_n(&slot.sequence, __ATOMIC_ACQUIRE) != i + 1) {
+        return false;
+    }
+    size_t words[TimeWords];
+    for(size_t k = 0; k < TimeWords; k++) {
+        words[k] = __atomic_load_n(&slot.words[k], __ATOMIC_RELAXED);
+    }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if(__atomic_load_n(&slot.sequence, __ATOMIC_RELAXED) != i + 1) {
+        return false;
+    }
+    memcpy(&time, words, sizeof(Type));
+    return true;
+}
+
+template<typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> AttitudeRingBuffer<QuaternionConvention, Type>::interpolate(const Sample& from, const Sample& to, const Type& time) const {
+    const Type duration = to.time - from.time;
+    const Type u = clamp((time - from.time) / duration, Type(0), Type(1));
+
+    if(_interpolation == Interpolation::SLERP) {
+        return from.quaternion.boxplus(to.quaternion.boxminus(from.quaternion) * u);
+    } else if(_interpolation == Interpolation::NLERP) {
+        const Type sign = from.quaternion.dot(to.quaternion) < Type(0) ? Type(-1) : Type(1);
+        const Vector<4, Type> blend = Vector<4, Type>{from.quaternion} * (Type(1) - u) + Vector<4, Type>{to.quaternion} * (sign * u);
+        return QuaternionType{blend}.unit();
+    }
+
+    return QuaternionHermite<QuaternionConvention, Type>{from.quaternion, from.angular_velocity, to.quaternion, to.angular_velocity, duration}(u);
+}
@@ -11,19 +11,8 @@
 
 template<typename Type>
 template<typename Convention>
-AxisAngle<Type>::AxisAngle(const RotationMatrix<Convention, Type>& dcm) {
-    const Type theta = acos(clamp((dcm.trace() - Type(1)) / Type(2), Type(-1), Type(1)));
-    if(theta < epsilon<Type>()) {
-        (*this) = Vector3<Type>{Type(0), Type(0), Type(0)};
-        return;
-    }
-
-    if(is_same<Convention, ACTIVE>::value) {
-        (*this) = (theta / (Type(2) * sin(theta)) * (dcm - dcm.T())).vee();
-    } else {
-        (*this) = (theta / (Type(2) * sin(theta)) * (dcm.T() - dcm)).vee();
-    }
-};
+AxisAngle<Type>::AxisAngle(const RotationMatrix<Convention, Type>& dcm) :
+AxisAngle(typename RotationMatrix<Convention, Type>::QuaternionAlias{dcm}){}; // (R - R^T) / (2 * sin(theta)) is unstable near pi
 
 template<typename Type>
 template<typename EulerConvention, typename EulerSequence>
@@ -33,17 +22,18 @@ AxisAngle(RotationMatrix<ACTIVE, Type>{euler}){};
 template<typename Type>
 template<typename QuaternionConvention>
 AxisAngle<Type>::AxisAngle(const Quaternion<QuaternionConvention, Type>& quaternion) {
-    const Type angle = Type(2) * acos(quaternion.w());
-
-    if(fabs(Type(1) - quaternion.w() * quaternion.w()) < epsilon<Type>()) {
-        (*this) = Vector3<Type>{Type(0), Type(0), Type(0)};
+    // q and -q are the same rotation, the angle is kept in [0, pi].
+    const Type sign = quaternion.w() < Type(0) ? Type(-1) : Type(1);
+    const Vector3<Type> xyz = Vector3<Type>{quaternion.x(), quaternion.y(), quaternion.z()} * sign;
+    const Type w = quaternion.w() * sign;
+    const Type s = xyz.norm();
+
+    // angle = 2 * atan2(s, w), accurate for small angles unlike 2 * acos(w).
+    const Type scale = s < epsilon<Type>() ? Type(2) / w : Type(2) * atan2(s, w) / s;
+    if(is_same<QuaternionConvention, HAMILTON>::value) {
+        (*this) = xyz * scale;
     } else {
-        const Type acos2 = sqrt(Type(1) - quaternion.w() * quaternion.w());
-        if(is_same<QuaternionConvention, HAMILTON>::value) {
-            (*this) = Vector3<Type>{quaternion.x(), quaternion.y(), quaternion.z()} / acos2 * angle;
-        } else if(is_same<QuaternionConvention, JPL>::value) {
-            (*this) = Vector3<Type>{-quaternion.x(), -quaternion.y(), -quaternion.z()} / acos2 * angle;
-        }
+        (*this) = xyz * -scale;
     }
 }
 
@@ -0,0 +1,37 @@
+/**
+ * @file BFloat16_impl.hpp
+ *
+ * bfloat16 storage type, the upper half of a float, converted to and from float for computation.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+inline void BFloat16::Widen(const BFloat16* in, float* out, size_t n) {
+    for(size_t i = 0; i < n; i++) {
+        out[i] = widen(in[i]._bits);
+    }
+}
+
+inline void BFloat16::Narrow(const float* in, BFloat16* out, size_t n) {
+    for(size_t i = 0; i < n; i++) {
+        out[i]._bits = narrow(in[i]);
+    }
+}
+
+inline uint16_t BFloat16::narrow(float value) {
+    uint32_t f;
+    memcpy(&f, &value, sizeof(f));
+    // Round to nearest even on the 16 dropped bits, nan kept quiet rather than rounded into infinity.
+    const uint32_t rounded = (f + 0x7FFFu + ((f >> 16) & 1u)) >> 16;
+    const uint32_t nan = (f >> 16) | 0x40u;
+    return static_cast<uint16_t>((f & 0x7FFFFFFFu) > 0x7F800000u ? nan : rounded);
+}
+
+inline float BFloat16::widen(uint16_t bits) {
+    const uint32_t f = static_cast<uint32_t>(bits) << 16;
+    float value;
+    memcpy(&value, &f, sizeof(value));
+    return value;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file ConingAccumulator_impl.hpp
+ *
+ * Coning and sculling compensation for strapdown integration of high rate IMU increments.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename Type>
+ConingAccumulator<Type>::ConingAccumulator() {
+    reset();
+}
+
+template<typename Type>
+void ConingAccumulator<Type>::reset() {
+    _alpha = Vector3<Type>{};
+    _beta = Vector3<Type>{};
+    _nu = Vector3<Type>{};
+    _gamma = Vector3<Type>{};
+    _prev_delta_angle = Vector3<Type>{};
+    _prev_delta_velocity = Vector3<Type>{};
+    _count = 0;
+}
+
+template<typename Type>
+void ConingAccumulator<Type>::push(const Vector3<Type>& delta_angle) {
+    _beta += (_alpha + _prev_delta_angle / Type(6)).cross(delta_angle) / Type(2);
+    _alpha += delta_angle;
+    _prev_delta_angle = delta_angle;
+    _count++;
+}
+
+template<typename Type>
+void ConingAccumulator<Type>::push(const Vector3<Type>& delta_angle, const Vector3<Type>& delta_velocity) {
+    const Vector3<Type> alpha_bar = _alpha + _prev_delta_angle / Type(6);
+    const Vector3<Type> nu_bar = _nu + _prev_delta_velocity / Type(6);
+
+    _beta += alpha_bar.cross(delta_angle) / Type(2);
+    _gamma += (alpha_bar.cross(delta_velocity) + nu_bar.cross(delta_angle)) / Type(2);
+    _alpha += delta_angle;
+    _nu += delta_velocity;
+    _prev_delta_angle = delta_angle;
+    _prev_delta_velocity = delta_velocity;
+    _count++;
+}
+
+template<typename Type>
+template<typename QuaternionConvention>
+Quaternion<QuaternionConvention, Type> ConingAccumulator<Type>::quaternion() const {
+    // HAMILTON : Exp(phi / 2), JPL : Exp(-phi / 2)
+    const Type half = is_same<QuaternionConvention, HAMILTON>::value ? Type(2) : Type(-2);
+    return Quaternion<QuaternionConvention, Type>::Exp(rotationVector() / half);
+}
+
+template<typename Type>
+template<typename RotationMatrixConvention>
+RotationMatrix<RotationMatrixConvention, Type> ConingAccumulator<Type>::rotationMatrix() const {
+    // ACTIVE : Exp(phi^), PASSIVE : Exp(-phi^)
+    const Vector3<Type> phi = rotationVector();
+    return RotationMatrix<RotationMatrixConvention, Type>::Exp(is_same<RotationMatrixConvention, ACTIVE>::value ? phi.hat() : (-phi).hat());
+}
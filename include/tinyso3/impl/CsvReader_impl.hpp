@@ -0,0 +1,106 @@
+/**
+ * @file CsvReader_impl.hpp
+ *
+ * Streaming CSV tokenizer, filling batches and arrays of rotations directly, without allocation.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename Type>
+template<typename QuaternionConvention>
+size_t CsvReader<Type>::read(const char* data, size_t size, const QuaternionBatch<QuaternionConvention, Type>& batch, double* timestamps, bool last) {
+    return parse<Vector<4, Type>>(data, size, batch, batch.size(), timestamps, last);
+}
+
+template<typename Type>
+size_t CsvReader<Type>::read(const char* data, size_t size, const Vector3Batch<Type>& batch, double* timestamps, bool last) {
+    return parse<Vector<3, Type>>(data, size, batch, batch.size(), timestamps, last);
+}
+
+template<typename Type>
+template<typename RotationMatrixConvention>
+size_t CsvReader<Type>::read(const char* data, size_t size, const RotationMatrixBatch<RotationMatrixConvention, Type>& batch, double* timestamps, bool last) {
+    return parse<SquareMatrix<3, Type>>(data, size, batch, batch.size(), timestamps, last);
+}
+
+template<typename Type>
+template<typename Value>
+size_t CsvReader<Type>::read(const char* data, size_t size, Value* values, size_t capacity, double* timestamps, bool last) {
+    return parse<decltype(parsed(static_cast<const Value*>(nullptr)))>(data, size, values, capacity, timestamps, last);
+}
+
+template<typename Type>
+template<typename Parsed, typename Target>
+size_t CsvReader<Type>::parse(const char* data, size_t size, const Target& target, size_t capacity, double* timestamps, bool last) {
+    _records = 0;
+    _failed = false;
+
+    const char* p = data;
+    const char* const end = data + size;
+    while(p < end && _records < capacity) {
+        const char* eol = static_cast<const char*>(memchr(p, '\n', static_cast<size_t>(end - p)));
+        if(eol == nullptr && !last) {
+            break; // incomplete line
+        }
+        eol = eol == nullptr ? end : eol;
+        const char* line_end = eol > p && eol[-1] == '\r' ? eol - 1 : eol;
+
+        if(!skip(p, line_end)) {
+            const char* cursor = p;
+            double timestamp = 0.0;
+            Parsed value;
+
+            spaces(cursor, line_end);
+            bool valid = timestamps == nullptr || TextFormat<double>::Parse(cursor, line_end, timestamp);
+            if(valid && timestamps != nullptr) {
+                spaces(cursor, line_end);
+                valid = cursor < line_end && *cursor++ == _separator;
+            }
+            valid = valid && TextFormat<Type>::Parse(cursor, line_end, value, _separator);
+            if(valid) {
+                spaces(cursor, line_end);
+            }
+            if(!valid || cursor != line_end) {
+                _failed = true;
+                break;
+            }
+
+            store(target, _records, value);
+            if(timestamps != nullptr) {
+                timestamps[_records] = timestamp;
+            }
+            _records++;
+        }
+
+        _line++;
+        p = eol == end ? end : eol + 1;
+    }
+
+    return static_cast<size_t>(p - data);
+}
+
+template<typename Type>
+bool CsvReader<Type>::skip(const char* cursor, const char* end) const {
+    spaces(cursor, end);
+    if(cursor == end || *cursor == '#') {
+        return true;
+    }
+
+    const char c = static_cast<char>(*cursor | 0x20);
+    if(c < 'a' || c > 'z') {
+        return false;
+    }
+    // Header, unless the line begins with inf or nan.
+    const bool inf = end - cursor >= 3 && c == 'i' && (cursor[1] | 0x20) == 'n' && (cursor[2] | 0x20) == 'f';
+    const bool nan = end - cursor >= 3 && c == 'n' && (cursor[1] | 0x20) == 'a' && (cursor[2] | 0x20) == 'n';
+    return !inf && !nan;
+}
+
+template<typename Type>
+void CsvReader<Type>::spaces(const char*& cursor, const char* end) const {
+    while(cursor < end && (*cursor == ' ' || *cursor == '\t') && *cursor != _separator) {
+        cursor++;
+    }
+}
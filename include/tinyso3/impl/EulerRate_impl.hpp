@@ -11,76 +11,78 @@
 
 template<typename EulerConvention, typename EulerSequence, typename Type>
 template<typename RotationMatrixConvention>
-EulerRate<EulerConvention, EulerSequence, Type>::EulerRate(const RotationMatrix<RotationMatrixConvention, Type>& dcm, const AngularVelocity<Type>& angular_velocity) {
-    const Euler<EulerConvention, EulerSequence, Type> euler{dcm};
+EulerRate<EulerConvention, EulerSequence, Type>::EulerRate(const RotationMatrix<RotationMatrixConvention, Type>& dcm, const AngularVelocity<Type>& angular_velocity) :
+EulerRate(Euler<EulerConvention, EulerSequence, Type>{dcm}, angular_velocity) {}
 
-    if(is_same<EulerConvention, INTRINSIC>::value) {
-        const RotationMatrix<PASSIVE, Type> principal_3 =
-          RotationMatrix<PASSIVE, Type>::template RotatePrincipalAxis<integral_constant<PrincipalAxis, EulerSequence::Axis3>>(euler(2));
-        const RotationMatrix<PASSIVE, Type> principal_2 =
-          RotationMatrix<PASSIVE, Type>::template RotatePrincipalAxis<integral_constant<PrincipalAxis, EulerSequence::Axis2>>(euler(1));
-
-        SquareMatrix<3, Type> temp{};
-        temp.template setCol<0>((principal_3 * principal_2).template col<0>());
-        temp.template setCol<1>(principal_3.template col<1>());
-        temp.template setCol<2>(Matrix<3, 1, Type>{Type(0), Type(0), Type(1)});
-
-        // Implement slightly optimized inverse,
-        // [a b 0] ^ (-1)  [d/(ad-bc)       b/(bc-ad)       0 ]
-        // [c d 0]       = [c/(bc-ad)       a/(ad-bc)       0 ]
-        // [e f 1]         [(de-cf)/(bc-ad) (be-af)/(ad-bc) 1 ]
-        [](SquareMatrix<3, Type>& matrix) {
-            const Type a = matrix(0, 0);
-            const Type b = matrix(0, 1);
-            const Type c = matrix(1, 0);
-            const Type d = matrix(1, 1);
-            const Type e = matrix(2, 0);
-            const Type f = matrix(2, 1);
+template<typename EulerConvention, typename EulerSequence, typename Type>
+EulerRate<EulerConvention, EulerSequence, Type>::EulerRate(const Euler<EulerConvention, EulerSequence, Type>& euler, const AngularVelocity<Type>& angular_velocity) {
+    (*this) = InverseKinematicMatrix(euler) * angular_velocity;
+}
 
-            const Type ad_bc = a * d - b * c;
-            const Type bc_ad = b * c - a * d;
-            matrix(0, 0) = d / ad_bc;
-            matrix(0, 1) = b / bc_ad;
-            matrix(1, 0) = c / bc_ad;
-            matrix(1, 1) = a / ad_bc;
-            matrix(2, 0) = (d * e - c * f) / bc_ad;
-            matrix(2, 1) = (b * e - a * f) / ad_bc;
-        }(temp);
+template<typename EulerConvention, typename EulerSequence, typename Type>
+SquareMatrix<3, Type> EulerRate<EulerConvention, EulerSequence, Type>::KinematicMatrix(const Euler<EulerConvention, EulerSequence, Type>& euler) {
+    Vector3<Type> e1{}, e2{}, e3{};
+    e1(static_cast<size_t>(EulerSequence::Axis1)) = Type(1);
+    e2(static_cast<size_t>(EulerSequence::Axis2)) = Type(1);
+    e3(static_cast<size_t>(EulerSequence::Axis3)) = Type(1);
 
-        (*this) = temp * angular_velocity;
+    SquareMatrix<3, Type> kinematic{};
+    if(is_same<EulerConvention, INTRINSIC>::value) {
+        // w = R3 * R2 * e1 * rate1 + R3 * e2 * rate2 + e3 * rate3 (PASSIVE principal rotations)
+        const Type c2 = cos(euler(1)), s2 = sin(euler(1));
+        const Type c3 = cos(euler(2)), s3 = sin(euler(2));
+        kinematic.setCol(0, RotatePassive(EulerSequence::Axis3, c3, s3, RotatePassive(EulerSequence::Axis2, c2, s2, e1)));
+        kinematic.setCol(1, RotatePassive(EulerSequence::Axis3, c3, s3, e2));
+        kinematic.setCol(2, e3);
     } else if(is_same<EulerConvention, EXTRINSIC>::value) {
-        const RotationMatrix<PASSIVE, Type> principal_1 =
-          RotationMatrix<PASSIVE, Type>::template RotatePrincipalAxis<integral_constant<PrincipalAxis, EulerSequence::Axis1>>(euler(0));
-        const RotationMatrix<PASSIVE, Type> principal_2 =
-          RotationMatrix<PASSIVE, Type>::template RotatePrincipalAxis<integral_constant<PrincipalAxis, EulerSequence::Axis2>>(euler(1));
+        // w = e1 * rate1 + R1 * e2 * rate2 + R1 * R2 * e3 * rate3 (PASSIVE principal rotations)
+        const Type c1 = cos(euler(0)), s1 = sin(euler(0));
+        const Type c2 = cos(euler(1)), s2 = sin(euler(1));
+        kinematic.setCol(0, e1);
+        kinematic.setCol(1, RotatePassive(EulerSequence::Axis1, c1, s1, e2));
+        kinematic.setCol(2, RotatePassive(EulerSequence::Axis1, c1, s1, RotatePassive(EulerSequence::Axis2, c2, s2, e3)));
+    }
 
-        SquareMatrix<3, Type> temp{};
-        temp.template setCol<0>(Matrix<3, 1, Type>{Type(1), Type(0), Type(0)});
-        temp.template setCol<1>(principal_1.template col<1>());
-        temp.template setCol<2>((principal_1 * principal_2).template col<2>());
+    return kinematic;
+}
 
-        // Implement slightly optimized inverse,
-        // [1 a b] ^ (-1)  [1 (be-af)/(cf-de) (bc-ad)/(de-cf)]
-        // [0 c d]       = [0       f/(cf-de)       d/(de-cf)]
-        // [0 e f]         [0       e/(de-cf)       c/(cf-de)]
-        [](SquareMatrix<3, Type>& matrix) {
-            const Type a = matrix(0, 1);
-            const Type b = matrix(0, 2);
-            const Type c = matrix(1, 1);
-            const Type d = matrix(1, 2);
-            const Type e = matrix(2, 1);
-            const Type f = matrix(2, 2);
+template<typename EulerConvention, typename EulerSequence, typename Type>
+SquareMatrix<3, Type> EulerRate<EulerConvention, EulerSequence, Type>::InverseKinematicMatrix(const Euler<EulerConvention, EulerSequence, Type>& euler) {
+    const SquareMatrix<3, Type> kinematic = KinematicMatrix(euler);
+    const Vector3<Type> c0 = kinematic.template col<0>();
+    const Vector3<Type> c1 = kinematic.template col<1>();
+    const Vector3<Type> c2 = kinematic.template col<2>();
+
+    // Rows of the inverse are the cross products of the columns, divided by the determinant.
+    const Vector3<Type> r0 = c1.cross(c2);
+    const Vector3<Type> r1 = c2.cross(c0);
+    const Vector3<Type> r2 = c0.cross(c1);
+    const Type det = c0.dot(r0);
 
-            const Type cf_de = c * f - d * e;
-            const Type de_cf = d * e - c * f;
-            matrix(0, 1) = (b * e - a * f) / cf_de;
-            matrix(0, 2) = (b * c - a * d) / de_cf;
-            matrix(1, 1) = f / cf_de;
-            matrix(1, 2) = d / de_cf;
-            matrix(2, 1) = e / de_cf;
-            matrix(2, 2) = c / cf_de;
-        }(temp);
+    SquareMatrix<3, Type> inverse{};
+    inverse.setRow(0, r0.T() / det);
+    inverse.setRow(1, r1.T() / det);
+    inverse.setRow(2, r2.T() / det);
+    return inverse;
+}
 
-        (*this) = temp * angular_velocity;
+template<typename EulerConvention, typename EulerSequence, typename Type>
+void EulerRate<EulerConvention, EulerSequence, Type>::FromAngularVelocities(const Euler<EulerConvention, EulerSequence, Type>* euler, const AngularVelocity<Type>* angular_velocity, EulerRate* euler_rate, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        euler_rate[i] = EulerRate{euler[i], angular_velocity[i]};
     }
-}
\ No newline at end of file
+}
+
+template<typename EulerConvention, typename EulerSequence, typename Type>
+Vector3<Type> EulerRate<EulerConvention, EulerSequence, Type>::RotatePassive(PrincipalAxis axis, const Type& c, const Type& s, const Vector3<Type>& v) {
+    // For the axis k and the following axes m, n : v_m' = c * v_m + s * v_n, v_n' = -s * v_m + c * v_n
+    const size_t k = static_cast<size_t>(axis);
+    const size_t m = (k + 1) % 3;
+    const size_t n = (k + 2) % 3;
+
+    Vector3<Type> rotated;
+    rotated(k) = v(k);
+    rotated(m) = c * v(m) + s * v(n);
+    rotated(n) = -s * v(m) + c * v(n);
+    return rotated;
+}
@@ -49,10 +49,6 @@
 
 #pragma once
 
-template<typename EulerConvention, typename EulerSequence, typename Type>
-Euler<EulerConvention, EulerSequence, Type>::Euler(const Euler& other) :
-Vector3<Type>(other){};
-
 template<typename EulerConvention, typename EulerSequence, typename Type>
 template<typename RotationMatrixConvention>
 Euler<EulerConvention, EulerSequence, Type>::Euler(const RotationMatrix<RotationMatrixConvention, Type>& dcm) {
@@ -68,21 +64,21 @@ Euler<EulerConvention, EulerSequence, Type>::Euler(const RotationMatrix<Rotation
     if(IS_DEFAULT_SEQUENCE) {
         if(AXIS_FIRST == AXIS_THIRD) { // Proper Euler angles
             data[2][0] = atan2(dcm(AXIS_FIRST, AXIS_SECOND), SIGN * dcm(AXIS_FIRST, AXIS_LEFT));
-            data[1][0] = acos(dcm(AXIS_FIRST, AXIS_FIRST));
+            data[1][0] = acos(clamp(dcm(AXIS_FIRST, AXIS_FIRST), Type(-1), Type(1)));
             data[0][0] = atan2(dcm(AXIS_SECOND, AXIS_FIRST), -SIGN * dcm(AXIS_LEFT, AXIS_FIRST));
         } else { // Tait-Bryan angles
             data[2][0] = atan2(-SIGN * dcm(AXIS_FIRST, AXIS_SECOND), dcm(AXIS_FIRST, AXIS_FIRST));
-            data[1][0] = SIGN * asin(dcm(AXIS_FIRST, AXIS_THIRD));
+            data[1][0] = SIGN * asin(clamp(dcm(AXIS_FIRST, AXIS_THIRD), Type(-1), Type(1)));
             data[0][0] = atan2(-SIGN * dcm(AXIS_SECOND, AXIS_THIRD), dcm(AXIS_THIRD, AXIS_THIRD));
         }
     } else {
         if(AXIS_FIRST == AXIS_THIRD) { // Proper Euler angles
             data[2][0] = atan2(dcm(AXIS_SECOND, AXIS_FIRST), SIGN * dcm(AXIS_LEFT, AXIS_FIRST));
-            data[1][0] = acos(dcm(AXIS_FIRST, AXIS_FIRST));
+            data[1][0] = acos(clamp(dcm(AXIS_FIRST, AXIS_FIRST), Type(-1), Type(1)));
             data[0][0] = atan2(dcm(AXIS_FIRST, AXIS_SECOND), -SIGN * dcm(AXIS_FIRST, AXIS_LEFT));
         } else { // Tait-Bryan angles
             data[2][0] = atan2(-SIGN * dcm(AXIS_SECOND, AXIS_FIRST), dcm(AXIS_FIRST, AXIS_FIRST));
-            data[1][0] = SIGN * asin(dcm(AXIS_THIRD, AXIS_FIRST));
+            data[1][0] = SIGN * asin(clamp(dcm(AXIS_THIRD, AXIS_FIRST), Type(-1), Type(1)));
             data[0][0] = atan2(-SIGN * dcm(AXIS_THIRD, AXIS_SECOND), dcm(AXIS_THIRD, AXIS_THIRD));
         }
     }
@@ -90,14 +86,17 @@ Euler<EulerConvention, EulerSequence, Type>::Euler(const RotationMatrix<Rotation
     /**
      * In case of gimbal lock.
      */
+    bool gimbal_lock = false;
     if(AXIS_FIRST == AXIS_THIRD) { // Proper Euler angles
         if(fabs(data[1][0]) < epsilon<Type>()) {
+            gimbal_lock = true;
             data[0][0] = Type(0);
             data[2][0] = IS_DEFAULT_SEQUENCE ?
                            atan2(-SIGN * dcm(AXIS_SECOND, AXIS_LEFT), dcm(AXIS_SECOND, AXIS_SECOND)) :
                            atan2(-SIGN * dcm(AXIS_LEFT, AXIS_SECOND), dcm(AXIS_SECOND, AXIS_SECOND));
 
         } else if(fabs(data[1][0] - Type(M_PI)) < epsilon<Type>()) {
+            gimbal_lock = true;
             data[0][0] = Type(0);
             data[2][0] = IS_DEFAULT_SEQUENCE ?
                            atan2(-SIGN * dcm(AXIS_SECOND, AXIS_LEFT), dcm(AXIS_SECOND, AXIS_SECOND)) :
@@ -105,17 +104,36 @@ Euler<EulerConvention, EulerSequence, Type>::Euler(const RotationMatrix<Rotation
         }
     } else { // Tait-Bryan angles
         if(fabs(data[1][0] - Type(M_PI_2)) < epsilon<Type>()) {
+            gimbal_lock = true;
             data[0][0] = Type(0);
             data[2][0] = IS_DEFAULT_SEQUENCE ?
                            atan2(dcm(AXIS_THIRD, AXIS_SECOND), -SIGN * dcm(AXIS_THIRD, AXIS_FIRST)) :
                            atan2(dcm(AXIS_SECOND, AXIS_THIRD), -SIGN * dcm(AXIS_FIRST, AXIS_THIRD));
         } else if(fabs(data[1][0] + Type(M_PI_2)) < epsilon<Type>()) {
+            gimbal_lock = true;
             data[0][0] = Type(0);
             data[2][0] = IS_DEFAULT_SEQUENCE ?
                            atan2(-dcm(AXIS_THIRD, AXIS_SECOND), SIGN * dcm(AXIS_THIRD, AXIS_FIRST)) :
                            atan2(-dcm(AXIS_SECOND, AXIS_THIRD), SIGN * dcm(AXIS_FIRST, AXIS_THIRD));
         }
     }
+
+    /**
+     * The extraction above recovers the angles of the inverse rotation for extrinsic sequences, (a, b, c) -> (-a, -b, -c).
+     * Proper Euler angles keep the second angle in [0, pi] with the equivalent (pi - a, b, pi - c).
+     */
+    if(is_same<EulerConvention, EXTRINSIC>::value) {
+        if(AXIS_FIRST != AXIS_THIRD || gimbal_lock) {
+            data[0][0] = -data[0][0];
+            data[2][0] = -data[2][0];
+            data[1][0] = AXIS_FIRST != AXIS_THIRD ? -data[1][0] : data[1][0];
+        } else {
+            data[0][0] = Type(M_PI) - data[0][0];
+            data[2][0] = Type(M_PI) - data[2][0];
+            data[0][0] = data[0][0] > Type(M_PI) ? data[0][0] - Type(2 * M_PI) : data[0][0];
+            data[2][0] = data[2][0] > Type(M_PI) ? data[2][0] - Type(2 * M_PI) : data[2][0];
+        }
+    }
 };
 
 template<typename EulerConvention, typename EulerSequence, typename Type>
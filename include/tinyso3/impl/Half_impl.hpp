@@ -0,0 +1,80 @@
+/**
+ * @file Half_impl.hpp
+ *
+ * IEEE 754 binary16 storage type, converted to and from float for computation.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+inline void Half::Widen(const Half* in, float* out, size_t n) {
+    size_t i = 0;
+#if defined(__F16C__)
+    for(; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+    }
+#endif
+    for(; i < n; i++) {
+        out[i] = widen(in[i]._bits);
+    }
+}
+
+inline void Half::Narrow(const float* in, Half* out, size_t n) {
+    size_t i = 0;
+#if defined(__F16C__)
+    for(; i + 8 <= n; i += 8) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+#endif
+    for(; i < n; i++) {
+        out[i]._bits = narrow(in[i]);
+    }
+}
+
+inline uint16_t Half::narrow(float value) {
+    // Branch free, so that array loops vectorize, each case computed and the applicable one selected.
+    uint32_t f;
+    memcpy(&f, &value, sizeof(f));
+    const uint32_t magnitude = f & 0x7FFFFFFFu;
+
+    // Normal, rebias the exponent from 127 to 15 and round the 13 dropped bits to nearest even.
+    const uint32_t normal = (magnitude - 0x37FFF001u + ((magnitude >> 13) & 1u)) >> 13;
+
+    // Subnormal, adding 0.5 aligns the significand in units of 2^-24, rounded to nearest even by the float addition.
+    float aligned;
+    memcpy(&aligned, &magnitude, sizeof(aligned));
+    aligned += 0.5f;
+    uint32_t subnormal;
+    memcpy(&subnormal, &aligned, sizeof(subnormal));
+    subnormal -= 0x3F000000u;
+
+    // At least 65520 rounds to infinity, nan stays quiet keeping the upper payload bits.
+    const uint32_t special = magnitude > 0x7F800000u ? 0x7E00u | ((magnitude >> 13) & 0x3FFu) : 0x7C00u;
+
+    const uint32_t isSubnormal = 0u - static_cast<uint32_t>(magnitude < 0x38800000u);
+    const uint32_t isSpecial = 0u - static_cast<uint32_t>(magnitude >= 0x477FF000u);
+    const uint32_t h = (special & isSpecial) | (subnormal & isSubnormal) | (normal & ~(isSpecial | isSubnormal));
+    return static_cast<uint16_t>(((f >> 16) & 0x8000u) | h);
+}
+
+inline float Half::widen(uint16_t bits) {
+    // Branch free, so that array loops vectorize: shift the exponent and significand into place and rebias,
+    // infinity and nan get the float maximum exponent, subnormals are normalized by a float subtraction.
+    const uint32_t shifted = (bits & 0x7FFFu) << 13;
+    const uint32_t exponent = shifted & 0x0F800000u;
+    const uint32_t normal = shifted + (112u << 23) + ((0u - static_cast<uint32_t>(exponent == 0x0F800000u)) & (112u << 23));
+    const uint32_t biased = shifted + (113u << 23); // subnormal significand * 2^-14 plus 2^-14
+
+    float subnormal;
+    memcpy(&subnormal, &biased, sizeof(subnormal));
+    subnormal -= 6.103515625e-5f;
+    uint32_t magnitude;
+    memcpy(&magnitude, &subnormal, sizeof(magnitude));
+
+    const uint32_t zero = 0u - static_cast<uint32_t>(exponent == 0);
+    const uint32_t f = (magnitude & zero) | (normal & ~zero) | ((bits & 0x8000u) << 16);
+    float value;
+    memcpy(&value, &f, sizeof(value));
+    return value;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file LatestAttitude_impl.hpp
+ *
+ * Latest value of a rotation, published by one writer and read by any number of threads without locks.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename T, size_t Buffers>
+constexpr size_t LatestAttitude<T, Buffers>::Words;
+
+template<typename T, size_t Buffers>
+LatestAttitude<T, Buffers>::LatestAttitude(const T& initial) {
+    for(size_t b = 0; b < Buffers; b++) {
+        _cells[b].version = 0;
+    }
+    store(initial);
+}
+
+template<typename T, size_t Buffers>
+void LatestAttitude<T, Buffers>::store(const T& value) {
+    size_t words[Words] = {};
+    memcpy(words, &value, sizeof(T));
+
+    // Mark the cell as being written, fill it, then publish its version.
+    const size_t version = __atomic_load_n(&_version, __ATOMIC_RELAXED) + 1;
+    Cell& cell = _cells[version % Buffers];
+    __atomic_store_n(&cell.version, size_t(0), __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    for(size_t k = 0; k < Words; k++) {
+        __atomic_store_n(&cell.words[k], words[k], __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&cell.version, version, __ATOMIC_RELEASE);
+    __atomic_store_n(&_version, version, __ATOMIC_RELEASE);
+}
+
+template<typename T, size_t Buffers>
+T LatestAttitude<T, Buffers>::load() const {
+    T value;
+    while(!tryLoad(value)) {
+    }
+    return value;
+}
+
+template<typename T, size_t Buffers>
+bool LatestAttitude<T, Buffers>::tryLoad(T& value, size_t* version) const {
+    const size_t published = __atomic_load_n(&_version, __ATOMIC_ACQUIRE);
+    const Cell& cell = _cells[published % Buffers];
+    if(__atomic_load_n(&cell.version, __ATOMIC_ACQUIRE) != published) {
+        return false;
+    }
+
+    size_t words[Words];
+    for(size_t k = 0; k < Words; k++) {
+        words[k] = __atomic_load_n(&cell.words[k], __ATOMIC_RELAXED);
+    }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if(__atomic_load_n(&cell.version, __ATOMIC_RELAXED) != published) {
+        return false;
+    }
+
+    memcpy(&value, words, sizeof(T));
+    if(version) {
+        *version = published;
+    }
+    return true;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file MatrixMap_impl.hpp
+ *
+ * A non-owning MxN matrix view over external memory.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<size_t M, size_t N, typename Type>
+MatrixMap<M, N, Type>& MatrixMap<M, N, Type>::operator=(const MatrixMap& other) {
+    return *this = other.matrix();
+}
+
+template<size_t M, size_t N, typename Type>
+MatrixMap<M, N, Type>& MatrixMap<M, N, Type>::operator=(const MatrixType& other) {
+    static_assert(is_same<Type, ValueType>::value, "Cannot write through a read only view.");
+
+    for(size_t i = 0; i < M; i++) {
+        for(size_t j = 0; j < N; j++) {
+            (*this)(i, j) = other(i, j);
+        }
+    }
+    return *this;
+}
+
+template<size_t M, size_t N, typename Type>
+MatrixMap<M, N, Type>& MatrixMap<M, N, Type>::operator=(const ValueType& value) {
+    static_assert(is_same<Type, ValueType>::value, "Cannot write through a read only view.");
+
+    for(size_t i = 0; i < M; i++) {
+        for(size_t j = 0; j < N; j++) {
+            (*this)(i, j) = value;
+        }
+    }
+    return *this;
+}
+
+template<size_t M, size_t N, typename Type>
+Matrix<M, N, remove_const_t<Type>> MatrixMap<M, N, Type>::matrix() const {
+    MatrixType m;
+    for(size_t i = 0; i < M; i++) {
+        for(size_t j = 0; j < N; j++) {
+            m(i, j) = (*this)(i, j);
+        }
+    }
+    return m;
+}
@@ -22,13 +22,6 @@ Matrix<M, N, Type>::Matrix(const Type data_[M][N]) {
             data[i][j] = data_[i][j];
 }
 
-template<size_t M, size_t N, typename Type>
-Matrix<M, N, Type>::Matrix(const Matrix& other) {
-    for(size_t i = 0; i < M; i++)
-        for(size_t j = 0; j < N; j++)
-            data[i][j] = other.data[i][j];
-}
-
 template<size_t M, size_t N, typename Type>
 Matrix<M, N, Type>::Matrix(const Type& value) {
     for(size_t i = 0; i < M; i++)
@@ -45,17 +38,6 @@ Matrix<M, N, Type>::Matrix(const U& u, const V& v, const Args&... args) {
     initializer<1, V, Args...>(v, args...);
 }
 
-template<size_t M, size_t N, typename Type>
-Matrix<M, N, Type>& Matrix<M, N, Type>::operator=(const Matrix& other) {
-    if(this != &other) {
-        for(size_t i = 0; i < M; i++)
-            for(size_t j = 0; j < N; j++)
-                data[i][j] = other.data[i][j];
-    }
-
-    return *this;
-}
-
 template<size_t M, size_t N, typename Type>
 Matrix<M, N, Type>& Matrix<M, N, Type>::operator=(const Type& value) {
     for(size_t i = 0; i < M; i++)
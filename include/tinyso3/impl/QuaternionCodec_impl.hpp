@@ -0,0 +1,135 @@
+/**
+ * @file QuaternionCodec_impl.hpp
+ *
+ * "Smallest three" compression of unit quaternions into 32, 48 or 64 bits.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+constexpr size_t QuaternionCodec<Bits, QuaternionConvention, Type>::ComponentBits;
+template<size_t Bits, typename QuaternionConvention, typename Type>
+constexpr size_t QuaternionCodec<Bits, QuaternionConvention, Type>::Bytes;
+template<size_t Bits, typename QuaternionConvention, typename Type>
+constexpr typename QuaternionCodec<Bits, QuaternionConvention, Type>::Code QuaternionCodec<Bits, QuaternionConvention, Type>::Levels;
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+typename QuaternionCodec<Bits, QuaternionConvention, Type>::Code QuaternionCodec<Bits, QuaternionConvention, Type>::Encode(const QuaternionType& q) {
+    return encode(q.w(), q.x(), q.y(), q.z());
+}
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> QuaternionCodec<Bits, QuaternionConvention, Type>::Decode(const Code& code) {
+    QuaternionType q;
+    decode(code, q.w(), q.x(), q.y(), q.z());
+    return q;
+}
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+void QuaternionCodec<Bits, QuaternionConvention, Type>::Encode(const QuaternionBatch<QuaternionConvention, const Type>& q, Code* codes) {
+    const Type* w = q.w();
+    const Type* x = q.x();
+    const Type* y = q.y();
+    const Type* z = q.z();
+
+    for(size_t i = 0; i < q.size(); i++) {
+        codes[i] = encode(w[i], x[i], y[i], z[i]);
+    }
+}
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+void QuaternionCodec<Bits, QuaternionConvention, Type>::Decode(const Code* codes, const QuaternionBatch<QuaternionConvention, Type>& q) {
+    Type* w = q.w();
+    Type* x = q.x();
+    Type* y = q.y();
+    Type* z = q.z();
+
+    for(size_t i = 0; i < q.size(); i++) {
+        decode(codes[i], w[i], x[i], y[i], z[i]);
+    }
+}
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+void QuaternionCodec<Bits, QuaternionConvention, Type>::Store(const Code& code, unsigned char* bytes) {
+    for(size_t i = 0; i < Bytes; i++) {
+        bytes[i] = static_cast<unsigned char>((code >> (i * 8)) & Code(0xFF));
+    }
+}
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+typename QuaternionCodec<Bits, QuaternionConvention, Type>::Code QuaternionCodec<Bits, QuaternionConvention, Type>::Load(const unsigned char* bytes) {
+    Code code = 0;
+    for(size_t i = 0; i < Bytes; i++) {
+        code |= Code(bytes[i]) << (i * 8);
+    }
+    return code;
+}
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+Type QuaternionCodec<Bits, QuaternionConvention, Type>::MaxAngularError() {
+    return Type(2) * sqrt(Type(3)) * sqrt(Type(2)) / Type(Levels);
+}
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+typename QuaternionCodec<Bits, QuaternionConvention, Type>::Code QuaternionCodec<Bits, QuaternionConvention, Type>::encode(const Type& w, const Type& x, const Type& y, const Type& z) {
+    const Type aw = fabs(w);
+    const Type ax = fabs(x);
+    const Type ay = fabs(y);
+    const Type az = fabs(z);
+
+    // Index of the largest magnitude, ties resolved towards w.
+    const Type mwx = ax > aw ? ax : aw;
+    const Type myz = az > ay ? az : ay;
+    const Code iwx = ax > aw ? Code(1) : Code(0);
+    const Code iyz = az > ay ? Code(3) : Code(2);
+    const Code index = myz > mwx ? iyz : iwx;
+
+    // The remaining components in w, x, y, z order, with the sign making the dropped one positive.
+    const Type a = index == 0 ? x : w;
+    const Type b = index <= 1 ? y : x;
+    const Type c = index <= 2 ? z : y;
+    const Type largest = index == 0 ? w : (index == 1 ? x : (index == 2 ? y : z));
+    const Type sign = largest < Type(0) ? Type(-1) : Type(1);
+
+    return quantize(a * sign) | (quantize(b * sign) << ComponentBits) | (quantize(c * sign) << (2 * ComponentBits)) | (index << (3 * ComponentBits));
+}
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+void QuaternionCodec<Bits, QuaternionConvention, Type>::decode(const Code& code, Type& w, Type& x, Type& y, Type& z) {
+    const Type a = dequantize(code & Levels);
+    const Type b = dequantize((code >> ComponentBits) & Levels);
+    const Type c = dequantize((code >> (2 * ComponentBits)) & Levels);
+    const Code index = (code >> (3 * ComponentBits)) & Code(3);
+    const Type remainder = Type(1) - a * a - b * b - c * c;
+    const Type largest = sqrt(remainder > Type(0) ? remainder : Type(0));
+
+    const Type qw = index == 0 ? largest : a;
+    const Type qx = index == 0 ? a : (index == 1 ? largest : b);
+    const Type qy = index <= 1 ? b : (index == 2 ? largest : c);
+    const Type qz = index <= 2 ? c : largest;
+
+    // Canonical, w >= 0
+    const Type sign = qw < Type(0) ? Type(-1) : Type(1);
+    w = qw * sign;
+    x = qx * sign;
+    y = qy * sign;
+    z = qz * sign;
+}
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+typename QuaternionCodec<Bits, QuaternionConvention, Type>::Code QuaternionCodec<Bits, QuaternionConvention, Type>::quantize(const Type& value) {
+    // [-1/sqrt(2), 1/sqrt(2)] -> [0, Levels], rounded to the nearest level.
+    const Type sqrt1_2 = Type(0.707106781186547524400844362104849039L);
+    const Type scaled = (value / sqrt1_2 + Type(1)) * (Type(Levels) / Type(2)) + Type(0.5);
+    // Plain comparisons and a signed conversion (levels fit in 20 bits) keep the batch loops vectorizable.
+    const Type clamped = scaled < Type(0) ? Type(0) : (scaled > Type(Levels) ? Type(Levels) : scaled);
+    return static_cast<Code>(static_cast<int32_t>(clamped));
+}
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+Type QuaternionCodec<Bits, QuaternionConvention, Type>::dequantize(const Code& level) {
+    const Type sqrt1_2 = Type(0.707106781186547524400844362104849039L);
+    return (Type(static_cast<int32_t>(level)) * (Type(2) / Type(Levels)) - Type(1)) * sqrt1_2;
+}
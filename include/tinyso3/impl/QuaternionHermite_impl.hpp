@@ -0,0 +1,85 @@
+/**
+ * @file QuaternionHermite_impl.hpp
+ *
+ * Cubic Hermite interpolation on SO(3) from quaternion and angular velocity endpoints.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename QuaternionConvention, typename Type>
+QuaternionHermite<QuaternionConvention, Type>::QuaternionHermite(const QuaternionType& from, const AngularVelocity<Type>& from_angular_velocity,
+                                                                 const QuaternionType& to, const AngularVelocity<Type>& to_angular_velocity,
+                                                                 const Type& duration) :
+_from(from), _duration(duration) {
+    // Control points c0 = from, c1 = from [+] phi1, c2 = to [+] (-phi3), c3 = to
+    const Vector3<Type> phi1 = from_angular_velocity * (duration / Type(3));
+    const Vector3<Type> phi3 = to_angular_velocity * (duration / Type(3));
+    const Vector3<Type> phi2 = to.boxplus(-phi3).boxminus(from.boxplus(phi1));
+    const Vector3<Type> phi[3] = {phi1, phi2, phi3};
+
+    for(size_t i = 0; i < 3; i++) {
+        _angle[i] = phi[i].norm();
+        _axis[i] = _angle[i] > Type(0) ? phi[i] / _angle[i] : phi[i];
+    }
+}
+
+template<typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> QuaternionHermite<QuaternionConvention, Type>::increment(size_t i, const Type& b) const {
+    const Type half = _angle[i] * b / Type(2);
+    const Type s = is_same<QuaternionConvention, HAMILTON>::value ? sin(half) : -sin(half);
+
+    QuaternionType q;
+    q.w() = cos(half);
+    q.x() = _axis[i].x() * s;
+    q.y() = _axis[i].y() * s;
+    q.z() = _axis[i].z() * s;
+    return q;
+}
+
+template<typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> QuaternionHermite<QuaternionConvention, Type>::operator()(const Type& u) const {
+    const Type v = Type(1) - u;
+    const Type b1 = Type(1) - v * v * v;
+    const Type b2 = u * u * (Type(3) - Type(2) * u);
+    const Type b3 = u * u * u;
+
+    // HAMILTON : q0 * E1 * E2 * E3, JPL : E3 * E2 * E1 * q0
+    if(is_same<QuaternionConvention, HAMILTON>::value) {
+        return _from * increment(0, b1) * increment(1, b2) * increment(2, b3);
+    } else if(is_same<QuaternionConvention, JPL>::value) {
+        return increment(2, b3) * increment(1, b2) * increment(0, b1) * _from;
+    }
+
+    return QuaternionType{}; // Cannot reach here, but to avoid warning
+}
+
+template<typename QuaternionConvention, typename Type>
+void QuaternionHermite<QuaternionConvention, Type>::operator()(const Type* u, QuaternionType* out, size_t count) const {
+    for(size_t i = 0; i < count; i++) {
+        out[i] = (*this)(u[i]);
+    }
+}
+
+template<typename QuaternionConvention, typename Type>
+AngularVelocity<Type> QuaternionHermite<QuaternionConvention, Type>::angularVelocity(const Type& u) const {
+    const Type v = Type(1) - u;
+    const Type db1 = Type(3) * v * v;
+    const Type db2 = Type(6) * u * v;
+    const Type db3 = Type(3) * u * u;
+    const Type b2 = u * u * (Type(3) - Type(2) * u);
+    const Type b3 = u * u * u;
+
+    // w = E3^(-1) * (E2^(-1) * phi1 * db1 + phi2 * db2) + phi3 * db3, divided by the duration.
+    const Vector3<Type> w2 = rotate(_axis[0] * (_angle[0] * db1), _axis[1], -_angle[1] * b2) + _axis[1] * (_angle[1] * db2);
+    const Vector3<Type> w3 = rotate(w2, _axis[2], -_angle[2] * b3) + _axis[2] * (_angle[2] * db3);
+    return w3 / _duration;
+}
+
+template<typename QuaternionConvention, typename Type>
+Vector3<Type> QuaternionHermite<QuaternionConvention, Type>::rotate(const Vector3<Type>& v, const Vector3<Type>& axis, const Type& angle) {
+    const Type c = cos(angle);
+    const Type s = sin(angle);
+    return v * c + axis.cross(v) * s + axis * (axis.dot(v) * (Type(1) - c));
+}
@@ -0,0 +1,93 @@
+/**
+ * @file QuaternionResampler_impl.hpp
+ *
+ * A streaming resampler from irregularly timestamped quaternion samples to a fixed output rate.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename QuaternionConvention, typename Type>
+QuaternionResampler<QuaternionConvention, Type>::QuaternionResampler(const Type& rate, const Type& max_gap, Interpolation interpolation) :
+_rate(rate), _max_gap(max_gap), _interpolation(interpolation) {
+    assert(rate > Type(0));
+    reset();
+}
+
+template<typename QuaternionConvention, typename Type>
+void QuaternionResampler<QuaternionConvention, Type>::reset() {
+    _has_previous = false;
+    _tick = 0;
+    _statistics = Statistics{0, 0, 0, 0, Type(0), Type(0)};
+}
+
+template<typename QuaternionConvention, typename Type>
+template<typename Sink>
+size_t QuaternionResampler<QuaternionConvention, Type>::push(const Sample& sample, Sink&& sink) {
+    if(!_has_previous) {
+        _previous = sample;
+        _has_previous = true;
+        _tick = firstTickFrom(sample.time);
+        _statistics.input_count = 1;
+        _statistics.first_time = sample.time;
+        _statistics.last_time = sample.time;
+        return 0;
+    }
+
+    if(!(sample.time > _previous.time)) {
+        _statistics.rejected_count++;
+        return 0;
+    }
+
+    _statistics.input_count++;
+    _statistics.last_time = sample.time;
+
+    const Type dt = sample.time - _previous.time;
+    if(dt > _max_gap) {
+        _statistics.gap_count++;
+        _previous = sample;
+        _tick = firstTickFrom(sample.time);
+        return 0;
+    }
+
+    prepare(sample);
+
+    size_t count = 0;
+    for(Type time = tickTime(); time <= sample.time; time = tickTime()) {
+        const Type u = clamp((time - _previous.time) / dt, Type(0), Type(1));
+        sink(time, evaluate(sample, u));
+        _tick++;
+        count++;
+    }
+
+    _statistics.output_count += count;
+    _previous = sample;
+    return count;
+}
+
+template<typename QuaternionConvention, typename Type>
+void QuaternionResampler<QuaternionConvention, Type>::prepare(const Sample& to) {
+    if(_interpolation == Interpolation::SLERP) {
+        _phi = to.quaternion.boxminus(_previous.quaternion);
+    } else if(_interpolation == Interpolation::HERMITE) {
+        _hermite = QuaternionHermite<QuaternionConvention, Type>{_previous.quaternion, _previous.angular_velocity,
+                                                                 to.quaternion, to.angular_velocity,
+                                                                 to.time - _previous.time};
+    }
+}
+
+template<typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> QuaternionResampler<QuaternionConvention, Type>::evaluate(const Sample& to, const Type& u) const {
+    const QuaternionType& from = _previous.quaternion;
+
+    if(_interpolation == Interpolation::SLERP) {
+        return from.boxplus(_phi * u);
+    } else if(_interpolation == Interpolation::NLERP) {
+        const Type sign = from.dot(to.quaternion) < Type(0) ? Type(-1) : Type(1);
+        const Vector<4, Type> blend = Vector<4, Type>{from} * (Type(1) - u) + Vector<4, Type>{to.quaternion} * (sign * u);
+        return QuaternionType{blend}.unit();
+    }
+
+    return _hermite(u);
+}
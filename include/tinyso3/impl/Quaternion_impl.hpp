@@ -107,6 +107,45 @@ Quaternion<QuaternionConvention, Type> Quaternion<QuaternionConvention, Type>::p
     return Quaternion<QuaternionConvention, Type>::Exp((log() * t));
 }
 
+template<typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> Quaternion<QuaternionConvention, Type>::boxplus(const Vector3<Type>& phi) const {
+    if(is_same<QuaternionConvention, HAMILTON>::value) {
+        return (*this) * Exp(phi / Type(2));
+    } else if(is_same<QuaternionConvention, JPL>::value) {
+        return Exp(phi / Type(-2)) * (*this);
+    }
+
+    return Quaternion<QuaternionConvention, Type>{}; // Cannot reach here, but to avoid warning
+}
+
+template<typename QuaternionConvention, typename Type>
+Vector3<Type> Quaternion<QuaternionConvention, Type>::boxminus(const Quaternion<QuaternionConvention, Type>& other) const {
+    // HAMILTON : Exp(phi / 2) = other^(*) * q
+    // JPL : Exp(-phi / 2) = q * other^(*)
+    const Quaternion<QuaternionConvention, Type> delta = is_same<QuaternionConvention, HAMILTON>::value ?
+                                                           (other.conjugate() * (*this)).canonicalize() :
+                                                           ((*this) * other.conjugate()).canonicalize();
+    const Vector3<Type> xyz = delta.Im();
+    const Type n = xyz.norm();
+    const Type sign = is_same<QuaternionConvention, HAMILTON>::value ? Type(2) : Type(-2);
+
+    // atan2 is used instead of acos, as it stays accurate for small angles and |w| slightly above 1.
+    if(n < tinyso3::epsilon<Type>()) {
+        return xyz * sign;
+    }
+
+    return xyz * (sign * atan2(n, delta.w()) / n);
+}
+
+template<typename QuaternionConvention, typename Type>
+SquareMatrix<3, Type> Quaternion<QuaternionConvention, Type>::adjoint() const {
+    SquareMatrix<3, Type> ad;
+    ad.setCol(0, (*this) * Vector3<Type>{Type(1), Type(0), Type(0)});
+    ad.setCol(1, (*this) * Vector3<Type>{Type(0), Type(1), Type(0)});
+    ad.setCol(2, (*this) * Vector3<Type>{Type(0), Type(0), Type(1)});
+    return ad;
+}
+
 template<typename QuaternionConvention, typename Type>
 Vector3<Type> Quaternion<QuaternionConvention, Type>::operator*(const Vector3<Type>& other_vec) const {
     return ((*this) * Quaternion<QuaternionConvention, Type>{other_vec} * conjugate()).Im();
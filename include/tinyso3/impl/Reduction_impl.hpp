@@ -0,0 +1,95 @@
+/**
+ * @file Reduction_impl.hpp
+ *
+ * Deterministic sums of matrices, vectors and quaternions, with optional compensated summation.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<size_t M, size_t N, typename Type, typename Summation>
+void MatrixSum<M, N, Type, Summation>::add(const MatrixType& value) {
+    for(size_t i = 0; i < M; i++) {
+        for(size_t j = 0; j < N; j++) {
+            accumulate(_sum(i, j), _compensation(i, j), value(i, j));
+        }
+    }
+    _count++;
+}
+
+template<size_t M, size_t N, typename Type, typename Summation>
+void MatrixSum<M, N, Type, Summation>::merge(const MatrixSum& other) {
+    for(size_t i = 0; i < M; i++) {
+        for(size_t j = 0; j < N; j++) {
+            accumulate(_sum(i, j), _compensation(i, j), other._sum(i, j));
+            _compensation(i, j) += other._compensation(i, j);
+        }
+    }
+    _count += other._count;
+}
+
+template<size_t M, size_t N, typename Type, typename Summation>
+Matrix<M, N, Type> MatrixSum<M, N, Type, Summation>::value() const {
+    return _sum + _compensation;
+}
+
+template<size_t M, size_t N, typename Type, typename Summation>
+void MatrixSum<M, N, Type, Summation>::accumulate(Type& sum, Type& compensation, const Type& value) {
+    if(is_same<Summation, NAIVE>::value) {
+        sum += value;
+        return;
+    }
+
+    // Neumaier: the rounding error of sum + value is recovered exactly from the larger operand.
+    const Type t = sum + value;
+    compensation += fabs(sum) >= fabs(value) ? (sum - t) + value : (value - t) + sum;
+    sum = t;
+}
+
+template<typename Accumulator>
+constexpr size_t ReductionTree<Accumulator>::Depth;
+
+template<typename Accumulator>
+void ReductionTree<Accumulator>::push(const Accumulator& leaf) {
+    _subtrees[_size] = leaf;
+    _leaves[_size] = 1;
+    _size++;
+
+    // Two subtrees of the same size form the next level, as the pairs of Combine.
+    while(_size > 1 && _leaves[_size - 2] == _leaves[_size - 1]) {
+        _subtrees[_size - 2].merge(_subtrees[_size - 1]);
+        _leaves[_size - 2] *= 2;
+        _size--;
+    }
+}
+
+template<typename Accumulator>
+Accumulator ReductionTree<Accumulator>::result() const {
+    if(_size == 0) {
+        return Accumulator{};
+    }
+
+    // Incomplete subtrees join from the right, the smaller into the larger before it.
+    Accumulator result = _subtrees[_size - 1];
+    for(size_t k = _size - 1; k > 0; k--) {
+        Accumulator left = _subtrees[k - 1];
+        left.merge(result);
+        result = left;
+    }
+    return result;
+}
+
+template<typename Accumulator>
+Accumulator ReductionTree<Accumulator>::Combine(Accumulator* leaves, size_t count) {
+    if(count == 0) {
+        return Accumulator{};
+    }
+
+    for(size_t width = 1; width < count; width *= 2) {
+        for(size_t i = 0; i + width < count; i += 2 * width) {
+            leaves[i].merge(leaves[i + width]);
+        }
+    }
+    return leaves[0];
+}
@@ -0,0 +1,154 @@
+/**
+ * @file RigidBodyDynamics_impl.hpp
+ *
+ * Rotational dynamics of a rigid body, Euler's equations together with the attitude.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename RigidBodyIntegrationScheme, typename QuaternionConvention, typename Type>
+RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, Type>::RigidBodyDynamics(const SquareMatrix<3, Type>& inertia, const Type& tolerance, size_t max_iterations) :
+_inertia(inertia), _tolerance(tolerance), _max_iterations(max_iterations) {
+    const array<EigenPair<Type>, 3> eigenpairs = EigenSolver<Type>{}(inertia);
+    for(size_t i = 0; i < 3; i++) {
+        assert(eigenpairs[i].first > Type(0));
+        _moments(i) = eigenpairs[i].first;
+        _axes.setCol(i, eigenpairs[i].second);
+    }
+}
+
+template<typename RigidBodyIntegrationScheme, typename QuaternionConvention, typename Type>
+void RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, Type>::step(QuaternionType& q, AngularVelocity<Type>& w, const Type& dt) const {
+    step(q, w, Vector3<Type>{}, dt);
+}
+
+template<typename RigidBodyIntegrationScheme, typename QuaternionConvention, typename Type>
+void RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, Type>::step(QuaternionType& q, AngularVelocity<Type>& w, const Vector3<Type>& torque, const Type& dt) const {
+    const SquareMatrix<3, Type> axes_T = _axes.T();
+    const Vector3<Type> w_p = axes_T * w;
+
+    Vector3<Type> m{w_p(0) * _moments(0), w_p(1) * _moments(1), w_p(2) * _moments(2)};
+    advance(Scheme{}, q, m, axes_T * torque, dt);
+
+    w = _axes * Vector3<Type>{m(0) / _moments(0), m(1) / _moments(1), m(2) / _moments(2)};
+    q = renormalize(q);
+}
+
+template<typename RigidBodyIntegrationScheme, typename QuaternionConvention, typename Type>
+void RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, Type>::step(const QuaternionBatch<QuaternionConvention, Type>& q, const Vector3Batch<Type>& w, const Type& dt) const {
+    assert(q.size() == w.size());
+
+    for(size_t i = 0; i < q.size(); i++) {
+        QuaternionType qi = q[i];
+        AngularVelocity<Type> wi = w[i];
+        step(qi, wi, Vector3<Type>{}, dt);
+        q.set(i, qi);
+        w.set(i, wi);
+    }
+}
+
+template<typename RigidBodyIntegrationScheme, typename QuaternionConvention, typename Type>
+void RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, Type>::step(const QuaternionBatch<QuaternionConvention, Type>& q, const Vector3Batch<Type>& w, const Vector3Batch<const Type>& torque, const Type& dt) const {
+    assert(q.size() == w.size() && q.size() == torque.size());
+
+    for(size_t i = 0; i < q.size(); i++) {
+        QuaternionType qi = q[i];
+        AngularVelocity<Type> wi = w[i];
+        step(qi, wi, torque[i], dt);
+        q.set(i, qi);
+        w.set(i, wi);
+    }
+}
+
+template<typename RigidBodyIntegrationScheme, typename QuaternionConvention, typename Type>
+void RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, Type>::advance(SPLITTING, QuaternionType& q, Vector3<Type>& m, const Vector3<Type>& torque, const Type& dt) const {
+    const Type half = dt / Type(2);
+
+    m += torque * half;
+    rotate(0, q, m, half);
+    rotate(1, q, m, half);
+    rotate(2, q, m, dt);
+    rotate(1, q, m, half);
+    rotate(0, q, m, half);
+    m += torque * half;
+}
+
+template<typename RigidBodyIntegrationScheme, typename QuaternionConvention, typename Type>
+void RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, Type>::advance(MIDPOINT, QuaternionType& q, Vector3<Type>& m, const Vector3<Type>& torque, const Type& dt) const {
+    const Type half = dt / Type(2);
+    m += torque * half;
+
+    // m1 = m0 + dt * (m_mid x w_mid), m_mid = (m0 + m1) / 2
+    const Vector3<Type> m0 = m;
+    const Type tolerance = _tolerance * m0.abs().max();
+    Vector3<Type> w_mid;
+    for(size_t iteration = 0; iteration < _max_iterations; iteration++) {
+        const Vector3<Type> m_mid = (m0 + m) / Type(2);
+        w_mid = Vector3<Type>{m_mid(0) / _moments(0), m_mid(1) / _moments(1), m_mid(2) / _moments(2)};
+
+        const Vector3<Type> next = m0 + m_mid.cross(w_mid) * dt;
+        const Type change = (next - m).abs().max();
+        m = next;
+        if(change <= tolerance) {
+            break;
+        }
+    }
+
+    const Vector3<Type> phi = _axes * (w_mid * dt);
+    const Type angle = phi.norm();
+    // sin(angle / 2) / angle
+    const Type scale = angle < epsilon<Type>() ? Type(0.5) - angle * angle / Type(48) : sin(angle / Type(2)) / angle;
+    increment(q, cos(angle / Type(2)), phi * scale);
+
+    m += torque * half;
+}
+
+template<typename RigidBodyIntegrationScheme, typename QuaternionConvention, typename Type>
+void RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, Type>::rotate(size_t i, QuaternionType& q, Vector3<Type>& m, const Type& dt) const {
+    const size_t j = (i + 1) % 3;
+    const size_t k = (i + 2) % 3;
+
+    const Type angle = dt * m(i) / _moments(i);
+    const Type c = cos(angle / Type(2));
+    const Type s = sin(angle / Type(2));
+
+    // dm/dt = m x (w_i * e_i) rotates m by -angle about e_i.
+    const Type C = c * c - s * s;
+    const Type S = Type(2) * s * c;
+    const Type mj = m(j);
+    const Type mk = m(k);
+    m(j) = C * mj + S * mk;
+    m(k) = C * mk - S * mj;
+
+    increment(q, c, Vector3<Type>{_axes(0, i), _axes(1, i), _axes(2, i)} * s);
+}
+
+template<typename RigidBodyIntegrationScheme, typename QuaternionConvention, typename Type>
+void RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, Type>::increment(QuaternionType& q, const Type& c, const Vector3<Type>& s_axis) {
+    // HAMILTON : q * Exp(phi / 2), JPL : Exp(-phi / 2) * q
+    const Type sign = is_same<QuaternionConvention, HAMILTON>::value ? Type(1) : Type(-1);
+
+    QuaternionType delta;
+    delta.w() = c;
+    delta.x() = s_axis.x() * sign;
+    delta.y() = s_axis.y() * sign;
+    delta.z() = s_axis.z() * sign;
+
+    if(is_same<QuaternionConvention, HAMILTON>::value) {
+        q = q * delta;
+    } else {
+        q = delta * q;
+    }
+}
+
+template<typename RigidBodyIntegrationScheme, typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> RigidBodyDynamics<RigidBodyIntegrationScheme, QuaternionConvention, Type>::renormalize(const QuaternionType& q) {
+    const Type n2 = q.dot(q);
+    if(fabs(Type(1) - n2) <= epsilon<Type>()) {
+        return q;
+    }
+
+    return QuaternionType{Vector<4, Type>{q} * ((Type(3) - n2) / Type(2))};
+}
@@ -0,0 +1,140 @@
+/**
+ * @file RotationGrid_impl.hpp
+ *
+ * Discretization of SO(3) into Size = 4 * Resolution^3 cells, with constant time quantization.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<size_t Resolution, typename QuaternionConvention, typename Type>
+constexpr size_t RotationGrid<Resolution, QuaternionConvention, Type>::Size;
+template<size_t Resolution, typename QuaternionConvention, typename Type>
+constexpr size_t RotationGrid<Resolution, QuaternionConvention, Type>::MaxNeighbors;
+
+template<size_t Resolution, typename QuaternionConvention, typename Type>
+typename RotationGrid<Resolution, QuaternionConvention, Type>::Cell RotationGrid<Resolution, QuaternionConvention, Type>::Quantize(const QuaternionType& q) {
+    return quantize(q.w(), q.x(), q.y(), q.z());
+}
+
+template<size_t Resolution, typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> RotationGrid<Resolution, QuaternionConvention, Type>::CellCenter(const Cell& cell) {
+    QuaternionType q;
+    center(cell, q.w(), q.x(), q.y(), q.z());
+    return q;
+}
+
+template<size_t Resolution, typename QuaternionConvention, typename Type>
+void RotationGrid<Resolution, QuaternionConvention, Type>::Quantize(const QuaternionBatch<QuaternionConvention, const Type>& q, Cell* cells) {
+    const Type* w = q.w();
+    const Type* x = q.x();
+    const Type* y = q.y();
+    const Type* z = q.z();
+
+    for(size_t i = 0; i < q.size(); i++) {
+        cells[i] = quantize(w[i], x[i], y[i], z[i]);
+    }
+}
+
+template<size_t Resolution, typename QuaternionConvention, typename Type>
+void RotationGrid<Resolution, QuaternionConvention, Type>::CellCenter(const Cell* cells, const QuaternionBatch<QuaternionConvention, Type>& q) {
+    Type* w = q.w();
+    Type* x = q.x();
+    Type* y = q.y();
+    Type* z = q.z();
+
+    for(size_t i = 0; i < q.size(); i++) {
+        center(cells[i], w[i], x[i], y[i], z[i]);
+    }
+}
+
+template<size_t Resolution, typename QuaternionConvention, typename Type>
+size_t RotationGrid<Resolution, QuaternionConvention, Type>::Neighbors(const Cell& cell, Cell* neighbors) {
+    const int r = static_cast<int>(Resolution);
+    const size_t facet = cell / (Resolution * Resolution * Resolution);
+    const int i0 = static_cast<int>(cell / (Resolution * Resolution) % Resolution);
+    const int i1 = static_cast<int>(cell / Resolution % Resolution);
+    const int i2 = static_cast<int>(cell % Resolution);
+
+    size_t count = 0;
+    for(int d = 0; d < 27; d++) {
+        const int index[3] = {i0 + d / 9 - 1, i1 + d / 3 % 3 - 1, i2 + d % 3 - 1};
+        if(d == 13) {
+            continue; // the cell itself
+        }
+
+        Cell neighbor;
+        if(index[0] >= 0 && index[0] < r && index[1] >= 0 && index[1] < r && index[2] >= 0 && index[2] < r) {
+            neighbor = static_cast<Cell>(((facet * Resolution + size_t(index[0])) * Resolution + size_t(index[1])) * Resolution + size_t(index[2]));
+        } else {
+            // Beyond the facet, the cell containing the continued center.
+            Type c[4];
+            point(facet, index, c);
+            neighbor = quantize(c[0], c[1], c[2], c[3]);
+        }
+
+        bool found = neighbor == cell;
+        for(size_t k = 0; k < count && !found; k++) {
+            found = neighbors[k] == neighbor;
+        }
+        if(!found) {
+            neighbors[count++] = neighbor;
+        }
+    }
+    return count;
+}
+
+template<size_t Resolution, typename QuaternionConvention, typename Type>
+Type RotationGrid<Resolution, QuaternionConvention, Type>::MaxAngularError() {
+    return sqrt(Type(3)) * Type(M_PI) / (Type(2) * Type(Resolution));
+}
+
+template<size_t Resolution, typename QuaternionConvention, typename Type>
+typename RotationGrid<Resolution, QuaternionConvention, Type>::Cell RotationGrid<Resolution, QuaternionConvention, Type>::quantize(const Type& w, const Type& x, const Type& y, const Type& z) {
+    const Type c[4] = {w, x, y, z};
+    size_t facet = 0;
+    for(size_t k = 1; k < 4; k++) {
+        facet = fabs(c[k]) > fabs(c[facet]) ? k : facet;
+    }
+
+    // The ratios are independent of the sign of q.
+    const Type scale = Type(1) / c[facet];
+    const Type step = Type(M_PI_2) / Type(Resolution);
+    size_t cell = facet;
+    for(size_t k = 0; k < 4; k++) {
+        if(k == facet) {
+            continue;
+        }
+        const Type a = atan(c[k] * scale) + Type(M_PI_4);
+        const Type level = floor(a / step);
+        const size_t index = level <= Type(0) ? 0 : (level >= Type(Resolution - 1) ? Resolution - 1 : static_cast<size_t>(level));
+        cell = cell * Resolution + index;
+    }
+    return static_cast<Cell>(cell);
+}
+
+template<size_t Resolution, typename QuaternionConvention, typename Type>
+void RotationGrid<Resolution, QuaternionConvention, Type>::center(const Cell& cell, Type& w, Type& x, Type& y, Type& z) {
+    const int index[3] = {static_cast<int>(cell / (Resolution * Resolution) % Resolution),
+                          static_cast<int>(cell / Resolution % Resolution),
+                          static_cast<int>(cell % Resolution)};
+    Type c[4];
+    point(cell / (Resolution * Resolution * Resolution), index, c);
+
+    const Type sign = c[0] < Type(0) ? Type(-1) : Type(1);
+    const Type scale = sign / sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2] + c[3] * c[3]);
+    w = c[0] * scale;
+    x = c[1] * scale;
+    y = c[2] * scale;
+    z = c[3] * scale;
+}
+
+template<size_t Resolution, typename QuaternionConvention, typename Type>
+void RotationGrid<Resolution, QuaternionConvention, Type>::point(size_t facet, const int (&index)[3], Type (&c)[4]) {
+    const Type step = Type(M_PI_2) / Type(Resolution);
+    size_t j = 0;
+    for(size_t k = 0; k < 4; k++) {
+        c[k] = k == facet ? Type(1) : tan((Type(index[j++]) + Type(0.5)) * step - Type(M_PI_4));
+    }
+}
@@ -0,0 +1,139 @@
+/**
+ * @file RotationHashSet_impl.hpp
+ *
+ * Set of rotations deduplicated within a tolerance angle, by open addressing in caller provided slots.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename QuaternionConvention, typename Type>
+constexpr uint64_t RotationHashSet<QuaternionConvention, Type>::Empty;
+template<typename QuaternionConvention, typename Type>
+constexpr uint32_t RotationHashSet<QuaternionConvention, Type>::None;
+
+template<typename QuaternionConvention, typename Type>
+RotationHashSet<QuaternionConvention, Type>::RotationHashSet(Slot* slots, size_t capacity, const Type& tolerance) :
+_slots(slots), _capacity(capacity), _tolerance(tolerance) {
+    assert(capacity >= 4 && (capacity & (capacity - 1)) == 0);
+    const Type angle = tolerance < Type(0) ? Type(0) : (tolerance > Type(M_PI) ? Type(M_PI) : tolerance);
+    _radius = Type(2) * sin(angle / Type(4));
+    _spacing = Type(4) * _radius > Type(2) / Type(65000) ? Type(4) * _radius : Type(2) / Type(65000);
+    clear();
+}
+
+template<typename QuaternionConvention, typename Type>
+uint32_t RotationHashSet<QuaternionConvention, Type>::insert(const QuaternionType& q) {
+    const Type sign = q.w() < Type(0) ? Type(-1) : Type(1);
+    const Key k = key(sign * q.w(), sign * q.x(), sign * q.y(), sign * q.z());
+    const uint32_t found = find(k);
+    if(found != None) {
+        return found;
+    }
+    // At least one slot stays empty, which ends every probe.
+    if(_size >= _capacity - (_capacity / 4 > 0 ? _capacity / 4 : 1)) {
+        return None;
+    }
+
+    size_t i = hash(k.cell);
+    while(_slots[i].cell != Empty) {
+        i = (i + 1) & (_capacity - 1);
+    }
+    _slots[i] = Slot{k.c[0], k.c[1], k.c[2], k.c[3], k.cell, static_cast<uint32_t>(_size)};
+    return static_cast<uint32_t>(_size++);
+}
+
+template<typename QuaternionConvention, typename Type>
+size_t RotationHashSet<QuaternionConvention, Type>::insert(const QuaternionBatch<QuaternionConvention, const Type>& q, uint32_t* ids) {
+    const size_t before = _size;
+    for(size_t i = 0; i < q.size(); i++) {
+        ids[i] = insert(q[i]);
+    }
+    return _size - before;
+}
+
+template<typename QuaternionConvention, typename Type>
+uint32_t RotationHashSet<QuaternionConvention, Type>::find(const QuaternionType& q) const {
+    const Type sign = q.w() < Type(0) ? Type(-1) : Type(1);
+    return find(key(sign * q.w(), sign * q.x(), sign * q.y(), sign * q.z()));
+}
+
+template<typename QuaternionConvention, typename Type>
+void RotationHashSet<QuaternionConvention, Type>::clear() {
+    for(size_t i = 0; i < _capacity; i++) {
+        _slots[i].cell = Empty;
+    }
+    _size = 0;
+}
+
+template<typename QuaternionConvention, typename Type>
+typename RotationHashSet<QuaternionConvention, Type>::Key RotationHashSet<QuaternionConvention, Type>::key(const Type& w, const Type& x, const Type& y, const Type& z) const {
+    Key k{{w, x, y, z}, 0, {0, 0, 0, 0}};
+    for(size_t i = 0; i < 4; i++) {
+        const Type t = (k.c[i] + Type(1)) / _spacing;
+        const Type level = floor(t);
+        const uint64_t index = level <= Type(0) ? 0 : (level >= Type(65534) ? 65534 : static_cast<uint64_t>(level));
+        const Type offset = (t - Type(index)) * _spacing; // distance above the lower boundary of the cell
+
+        k.neighbour[i] = offset <= _radius && index > 0 ? -1 : (_spacing - offset <= _radius && index < 65534 ? 1 : 0);
+        k.cell |= index << (16 * i);
+    }
+    return k;
+}
+
+template<typename QuaternionConvention, typename Type>
+uint32_t RotationHashSet<QuaternionConvention, Type>::probe(const Key& k) const {
+    const Type radius2 = _radius * _radius;
+
+    // The cell, and every combination of the adjacent cells the ball reaches.
+    for(unsigned mask = 0; mask < 16; mask++) {
+        uint64_t cell = k.cell;
+        bool reached = true;
+        for(unsigned i = 0; i < 4 && reached; i++) {
+            if(mask & (1u << i)) {
+                reached = k.neighbour[i] != 0;
+                cell += static_cast<uint64_t>(static_cast<int64_t>(k.neighbour[i])) << (16 * i);
+            }
+        }
+        if(!reached) {
+            continue;
+        }
+
+        for(size_t i = hash(cell); _slots[i].cell != Empty; i = (i + 1) & (_capacity - 1)) {
+            const Slot& slot = _slots[i];
+            if(slot.cell != cell) {
+                continue;
+            }
+            const Type dw = slot.w - k.c[0], dx = slot.x - k.c[1], dy = slot.y - k.c[2], dz = slot.z - k.c[3];
+            const Type sw = slot.w + k.c[0], sx = slot.x + k.c[1], sy = slot.y + k.c[2], sz = slot.z + k.c[3];
+            const Type minus = dw * dw + dx * dx + dy * dy + dz * dz;
+            const Type plus = sw * sw + sx * sx + sy * sy + sz * sz;
+            if((minus < plus ? minus : plus) <= radius2) {
+                return slot.id;
+            }
+        }
+    }
+    return None;
+}
+
+template<typename QuaternionConvention, typename Type>
+uint32_t RotationHashSet<QuaternionConvention, Type>::find(const Key& k) const {
+    const uint32_t found = probe(k);
+    if(found != None || k.c[0] > _radius) {
+        return found;
+    }
+    // Near w = 0 the canonical quaternion of a duplicate may have the opposite sign.
+    return probe(key(-k.c[0], -k.c[1], -k.c[2], -k.c[3]));
+}
+
+template<typename QuaternionConvention, typename Type>
+size_t RotationHashSet<QuaternionConvention, Type>::hash(uint64_t cell) const {
+    // splitmix64 finalizer
+    cell ^= cell >> 30;
+    cell *= 0xbf58476d1ce4e5b9u;
+    cell ^= cell >> 27;
+    cell *= 0x94d049bb133111ebu;
+    cell ^= cell >> 31;
+    return cell & (_capacity - 1);
+}
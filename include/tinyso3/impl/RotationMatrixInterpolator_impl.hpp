@@ -0,0 +1,89 @@
+/**
+ * @file RotationMatrixInterpolator_impl.hpp
+ *
+ * Interpolator between two fixed rotation matrices.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename RotationMatrixConvention, typename Type>
+RotationMatrixInterpolator<RotationMatrixConvention, Type>::RotationMatrixInterpolator(const RotationMatrixType& from, const RotationMatrixType& to) :
+_from(from), _axis{Type(0), Type(0), Type(0)}, _angle(Type(0)), _K(Type(0)), _K2(Type(0)) {
+    const SquareMatrix<3, Type> relative = is_same<RotationMatrixConvention, ACTIVE>::value ? from.T() * to : to * from.T();
+
+    const Type cos_angle = clamp((relative.trace() - Type(1)) / Type(2), Type(-1), Type(1));
+    _angle = acos(cos_angle);
+
+    if(_angle < epsilon<Type>()) {
+        _angle = Type(0);
+        return;
+    }
+
+    const SquareMatrix<3, Type> relative_T = relative.T();
+    const Vector3<Type> antisymmetric = (relative - relative_T).vee();
+
+    if(cos_angle >= Type(0)) {
+        _axis = antisymmetric / (Type(2) * sin(_angle));
+    } else {
+        // Close to pi, sin(angle) vanishes and the antisymmetric part loses precision.
+        // The symmetric part satisfies (R + R^T) / 2 = cos * I + (1 - cos) * axis * axis^T instead.
+        const SquareMatrix<3, Type> outer = ((relative + relative_T) / Type(2) - SquareMatrix<3, Type>::Identity() * cos_angle) / (Type(1) - cos_angle);
+
+        size_t i = 0;
+        if(outer(1, 1) > outer(i, i)) {
+            i = 1;
+        }
+        if(outer(2, 2) > outer(i, i)) {
+            i = 2;
+        }
+
+        _axis = Vector3<Type>{outer.col(i)} / sqrt(outer(i, i));
+
+        if(_axis.dot(antisymmetric) < Type(0)) {
+            _axis = -_axis;
+        }
+    }
+
+    _axis.normalize();
+    _K = _axis.hat();
+    _K2 = _K * _K;
+}
+
+template<typename RotationMatrixConvention, typename Type>
+RotationMatrix<RotationMatrixConvention, Type> RotationMatrixInterpolator<RotationMatrixConvention, Type>::operator()(const Type& t) const {
+    RotationMatrixType result;
+    evaluate(t, result);
+    return result;
+}
+
+template<typename RotationMatrixConvention, typename Type>
+void RotationMatrixInterpolator<RotationMatrixConvention, Type>::operator()(const Type* t, RotationMatrixType* out, size_t count) const {
+    for(size_t i = 0; i < count; i++) {
+        evaluate(t[i], out[i]);
+    }
+}
+
+template<typename RotationMatrixConvention, typename Type>
+void RotationMatrixInterpolator<RotationMatrixConvention, Type>::evaluate(const Type& t, RotationMatrixType& out) const {
+    const Type theta = t * _angle;
+    const Type s = sin(theta);
+    const Type one_minus_c = Type(1) - cos(theta);
+
+    // Rodrigues formula, Exp(theta * K) = I + sin(theta) * K + (1 - cos(theta)) * K^2
+    SquareMatrix<3, Type> delta;
+    for(size_t i = 0; i < 3; i++)
+        for(size_t j = 0; j < 3; j++)
+            delta(i, j) = s * _K(i, j) + one_minus_c * _K2(i, j);
+
+    delta(0, 0) += Type(1);
+    delta(1, 1) += Type(1);
+    delta(2, 2) += Type(1);
+
+    if(is_same<RotationMatrixConvention, ACTIVE>::value) {
+        out = _from * delta;
+    } else if(is_same<RotationMatrixConvention, PASSIVE>::value) {
+        out = delta * _from;
+    }
+}
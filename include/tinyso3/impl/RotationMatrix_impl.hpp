@@ -59,22 +59,14 @@ RotationMatrix<RotationMatrixConvention, Type>::RotationMatrix(const QuaternionA
     data[1][1] = Type(1) - Type(2) * (qx * qx + qz * qz);
     data[2][2] = Type(1) - Type(2) * (qx * qx + qy * qy);
 
-    if(is_same<typename QuaternionAlias::Convention, HAMILTON>::value) {
-        data[1][0] = Type(2) * (qx * qy + qz * qw);
-        data[0][1] = Type(2) * (qx * qy - qz * qw);
-        data[1][2] = Type(2) * (qy * qz - qx * qw);
-        data[2][1] = Type(2) * (qy * qz + qx * qw);
-        data[2][0] = Type(2) * (qx * qz - qy * qw);
-        data[0][2] = Type(2) * (qx * qz + qy * qw);
-
-    } else if(is_same<typename QuaternionAlias::Convention, JPL>::value) {
-        data[0][1] = Type(2) * (qx * qy + qz * qw);
-        data[1][0] = Type(2) * (qx * qy - qz * qw);
-        data[2][1] = Type(2) * (qy * qz - qx * qw);
-        data[1][2] = Type(2) * (qy * qz + qx * qw);
-        data[0][2] = Type(2) * (qx * qz - qy * qw);
-        data[2][0] = Type(2) * (qx * qz + qy * qw);
-    }
+    // The same elements for both conventions, a JPL quaternion stores the rotation of its PASSIVE matrix,
+    // consistent with Quaternion(const RotationMatrixAlias&) and RotatePrincipalAxis.
+    data[1][0] = Type(2) * (qx * qy + qz * qw);
+    data[0][1] = Type(2) * (qx * qy - qz * qw);
+    data[1][2] = Type(2) * (qy * qz - qx * qw);
+    data[2][1] = Type(2) * (qy * qz + qx * qw);
+    data[2][0] = Type(2) * (qx * qz - qy * qw);
+    data[0][2] = Type(2) * (qx * qz + qy * qw);
 }
 
 template<typename RotationMatrixConvention, typename Type>
@@ -105,7 +97,30 @@ RotationMatrix<RotationMatrixConvention, Type> RotationMatrix<RotationMatrixConv
 template<typename RotationMatrixConvention, typename Type>
 SquareMatrix<3, Type> RotationMatrix<RotationMatrixConvention, Type>::log() const {
     const Type theta = acos(clamp((this->trace() - Type(1)) / Type(2), Type(-1), Type(1)));
-    return theta < epsilon<Type>() ? Null() : theta / (Type(2) * sin(theta)) * (*this - this->T());
+    // theta / (2 * sin(theta)) ~ 1 / 2 + theta^2 / 12 for small angles.
+    const Type scale = theta < epsilon<Type>() ? Type(0.5) + theta * theta / Type(12) : theta / (Type(2) * sin(theta));
+    return scale * (*this - this->T());
+}
+
+template<typename RotationMatrixConvention, typename Type>
+SquareMatrix<3, Type> RotationMatrix<RotationMatrixConvention, Type>::logWithJacobian(SquareMatrix<3, Type>& right_jacobian_inverse) const {
+    const SquareMatrix<3, Type> K = log();
+    const Vector3<Type> phi = K.vee();
+    const Type theta2 = phi.dot(phi);
+
+    Type a, b, c;
+    Coefficients(theta2, a, b, c);
+    right_jacobian_inverse = SquareMatrix<3, Type>::Identity() + K * Type(0.5) + K * K * InverseCoefficient(theta2, a, b);
+    return K;
+}
+
+template<typename RotationMatrixConvention, typename Type>
+SquareMatrix<3, Type> RotationMatrix<RotationMatrixConvention, Type>::adjoint() const {
+    if(is_same<RotationMatrixConvention, ACTIVE>::value) {
+        return *this;
+    }
+
+    return this->T();
 }
 
 template<typename RotationMatrixConvention, typename Type>
@@ -129,19 +144,86 @@ RotationMatrix<RotationMatrixConvention, Type> RotationMatrix<RotationMatrixConv
 
 template<typename RotationMatrixConvention, typename Type>
 RotationMatrix<RotationMatrixConvention, Type> RotationMatrix<RotationMatrixConvention, Type>::Exp(const SquareMatrix<3, Type>& exp) {
-    Vector3<Type> a = exp.vee();
-    const Type theta = a.norm();
+    const Vector3<Type> phi = exp.vee();
+    const SquareMatrix<3, Type> K = phi.hat();
+
+    Type a, b, c;
+    Coefficients(phi.dot(phi), a, b, c);
+    return Identity() + K * a + K * K * b;
+}
+
+template<typename RotationMatrixConvention, typename Type>
+RotationMatrix<RotationMatrixConvention, Type> RotationMatrix<RotationMatrixConvention, Type>::ExpWithJacobian(const SquareMatrix<3, Type>& exp, SquareMatrix<3, Type>& right_jacobian) {
+    const Vector3<Type> phi = exp.vee();
+    const SquareMatrix<3, Type> K = phi.hat();
+    const SquareMatrix<3, Type> K2 = K * K;
+
+    Type a, b, c;
+    Coefficients(phi.dot(phi), a, b, c);
+    right_jacobian = SquareMatrix<3, Type>::Identity() - K * b + K2 * c;
+    return Identity() + K * a + K2 * b;
+}
+
+template<typename RotationMatrixConvention, typename Type>
+SquareMatrix<3, Type> RotationMatrix<RotationMatrixConvention, Type>::RightJacobian(const Vector3<Type>& phi) {
+    const SquareMatrix<3, Type> K = phi.hat();
 
-    if(theta < epsilon<Type>()) {
-        return Identity();
+    Type a, b, c;
+    Coefficients(phi.dot(phi), a, b, c);
+    return SquareMatrix<3, Type>::Identity() - K * b + K * K * c;
+}
+
+template<typename RotationMatrixConvention, typename Type>
+SquareMatrix<3, Type> RotationMatrix<RotationMatrixConvention, Type>::LeftJacobian(const Vector3<Type>& phi) {
+    return RightJacobian(-phi);
+}
+
+template<typename RotationMatrixConvention, typename Type>
+SquareMatrix<3, Type> RotationMatrix<RotationMatrixConvention, Type>::RightJacobianInverse(const Vector3<Type>& phi) {
+    const SquareMatrix<3, Type> K = phi.hat();
+    const Type theta2 = phi.dot(phi);
+
+    Type a, b, c;
+    Coefficients(theta2, a, b, c);
+    return SquareMatrix<3, Type>::Identity() + K * Type(0.5) + K * K * InverseCoefficient(theta2, a, b);
+}
+
+template<typename RotationMatrixConvention, typename Type>
+SquareMatrix<3, Type> RotationMatrix<RotationMatrixConvention, Type>::LeftJacobianInverse(const Vector3<Type>& phi) {
+    return RightJacobianInverse(-phi);
+}
+
+template<typename RotationMatrixConvention, typename Type>
+void RotationMatrix<RotationMatrixConvention, Type>::Coefficients(const Type& theta2, Type& a, Type& b, Type& c) {
+    if(theta2 < epsilon<Type>()) {
+        // Taylor expansions, truncation errors are of order theta^4.
+        a = Type(1) - theta2 / Type(6);
+        b = Type(0.5) - theta2 / Type(24);
+        c = Type(1) / Type(6) - theta2 / Type(120);
+        return;
     }
 
-    a /= theta;
+    // 1 - cos(theta) = 2 * sin^2(theta / 2) does not cancel for small angles.
+    const Type theta = sqrt(theta2);
+    const Type sh = sin(theta / Type(2));
+    const Type ch = cos(theta / Type(2));
+    const Type s = Type(2) * sh * ch;
+    a = s / theta;
+    b = Type(2) * sh * sh / theta2;
+    c = (theta - s) / (theta2 * theta);
+}
 
-    const Type c = cos(theta);
-    const Type s = sin(theta);
+template<typename RotationMatrixConvention, typename Type>
+Type RotationMatrix<RotationMatrixConvention, Type>::InverseCoefficient(const Type& theta2, const Type& a, const Type& b) {
+    // The closed form cancels to 1 / 12 with an error of machine epsilon / theta^2, the series truncation error is theta^6 / 1209600.
+    // Both are equal at theta^8 = 1209600 * machine epsilon, theta ~ 0.06 in double precision.
+    const Type theta4 = theta2 * theta2;
+    if(theta4 * theta4 < Type(1209600) * machine_epsilon<Type>()) {
+        return Type(1) / Type(12) + theta2 / Type(720) + theta4 / Type(30240);
+    }
 
-    return c * Identity() + (Type(1) - c) * a * a.T() + s * a.hat();
+    // (1 + cos(theta)) / (2 * theta * sin(theta)) = a / (2 * b * theta^2), well defined at theta = pi.
+    return (Type(1) - a / (Type(2) * b)) / theta2;
 }
 
 template<typename RotationMatrixConvention, typename Type>
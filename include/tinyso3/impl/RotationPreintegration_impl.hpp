@@ -0,0 +1,63 @@
+/**
+ * @file RotationPreintegration_impl.hpp
+ *
+ * Gyroscope preintegration on SO(3) between two keyframes.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename RotationMatrixConvention, typename Type>
+RotationPreintegration<RotationMatrixConvention, Type>::RotationPreintegration(const Vector3<Type>& bias, const Type& noise_density) :
+_noise_density(noise_density) {
+    reset(bias);
+}
+
+template<typename RotationMatrixConvention, typename Type>
+void RotationPreintegration<RotationMatrixConvention, Type>::reset(const Vector3<Type>& bias) {
+    _bias = bias;
+    _delta_rotation = SquareMatrix<3, Type>::Identity();
+    _bias_jacobian = SquareMatrix<3, Type>{};
+    _covariance = SquareMatrix<3, Type>{};
+    _delta_time = Type(0);
+}
+
+template<typename RotationMatrixConvention, typename Type>
+void RotationPreintegration<RotationMatrixConvention, Type>::integrate(const AngularVelocity<Type>& measurement, const Type& dt) {
+    assert(dt > Type(0));
+
+    SquareMatrix<3, Type> right_jacobian;
+    const SquareMatrix<3, Type> exp = RotationMatrix<ACTIVE, Type>::ExpWithJacobian(((measurement - _bias) * dt).hat(), right_jacobian);
+
+    const SquareMatrix<3, Type> exp_T = exp.T();
+    const SquareMatrix<3, Type> right_jacobian_T = right_jacobian.T();
+
+    // Discrete noise variance sigma^2 / dt, scaled by dt^2 through B = Jr * dt.
+    const Type noise = _noise_density * _noise_density * dt;
+
+    _covariance = exp_T * _covariance * exp + right_jacobian * right_jacobian_T * noise;
+    _bias_jacobian = exp_T * _bias_jacobian - right_jacobian * dt;
+    _delta_rotation = _delta_rotation * exp;
+    _delta_time += dt;
+}
+
+template<typename RotationMatrixConvention, typename Type>
+RotationMatrix<RotationMatrixConvention, Type> RotationPreintegration<RotationMatrixConvention, Type>::deltaRotation() const {
+    if(is_same<RotationMatrixConvention, ACTIVE>::value) {
+        return _delta_rotation;
+    }
+
+    return _delta_rotation.T();
+}
+
+template<typename RotationMatrixConvention, typename Type>
+RotationMatrix<RotationMatrixConvention, Type> RotationPreintegration<RotationMatrixConvention, Type>::deltaRotation(const Vector3<Type>& bias) const {
+    const Vector3<Type> correction = _bias_jacobian * (bias - _bias);
+    const SquareMatrix<3, Type> corrected = _delta_rotation * RotationMatrix<ACTIVE, Type>::Exp(correction.hat());
+    if(is_same<RotationMatrixConvention, ACTIVE>::value) {
+        return corrected;
+    }
+
+    return corrected.T();
+}
@@ -0,0 +1,132 @@
+/**
+ * @file RotationSolver_impl.hpp
+ *
+ * Nonlinear least squares over a single rotation, with Gauss-Newton or Levenberg-Marquardt.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename RotationMatrixConvention, typename Type, size_t BatchSize>
+template<typename Problem>
+RotationMatrix<RotationMatrixConvention, Type> RotationSolver<RotationMatrixConvention, Type, BatchSize>::solve(const Problem& problem, const RotationMatrixType& initial) {
+    _statistics = Statistics{0, 0, 0, Type(0), Type(0), _options.initial_lambda, false};
+
+    RotationMatrixType R = initial;
+    SquareMatrix<3, Type> hessian;
+    Vector3<Type> gradient;
+    Type current = linearize(problem, R, hessian, gradient);
+    _statistics.initial_cost = current;
+
+    const bool damped = _options.method == Optimization::LEVENBERG_MARQUARDT;
+    Type lambda = _options.initial_lambda;
+
+    for(; _statistics.iterations < _options.max_iterations; _statistics.iterations++) {
+        if(gradient.norm() < _options.gradient_tolerance) {
+            _statistics.converged = true;
+            break;
+        }
+
+        // The diagonal floor keeps the system regular along directions the problem does not observe.
+        SquareMatrix<3, Type> system = hessian;
+        for(size_t i = 0; i < 3; i++) {
+            system(i, i) += damped ? lambda * fmax(hessian(i, i), _options.min_diagonal) : _options.min_diagonal;
+        }
+
+        const Vector3<Type> delta = -(system.inverse() * gradient);
+        if(!delta.isfinite()) {
+            _statistics.rejected_steps++;
+            if(!damped) {
+                break;
+            }
+            lambda *= Type(10);
+            continue;
+        }
+
+        const RotationMatrixType candidate = retract(R, delta);
+
+        if(damped) {
+            const Type candidate_cost = cost(problem, candidate);
+            if(!(candidate_cost < current)) {
+                // Rejected, increase the damping and retry from the same linearization.
+                _statistics.rejected_steps++;
+                lambda *= Type(10);
+                if(delta.norm() < _options.step_tolerance) {
+                    _statistics.converged = true;
+                    break;
+                }
+                continue;
+            }
+            lambda = fmax(lambda / Type(10), epsilon<Type>());
+        }
+
+        R = candidate;
+        current = linearize(problem, R, hessian, gradient);
+
+        if(delta.norm() < _options.step_tolerance) {
+            _statistics.converged = true;
+            break;
+        }
+    }
+
+    _statistics.final_cost = current;
+    _statistics.lambda = lambda;
+    return R;
+}
+
+template<typename RotationMatrixConvention, typename Type, size_t BatchSize>
+template<typename Problem>
+Type RotationSolver<RotationMatrixConvention, Type, BatchSize>::linearize(const Problem& problem, const RotationMatrixType& R, SquareMatrix<3, Type>& hessian, Vector3<Type>& gradient) {
+    Vector3<Type> residuals[BatchSize];
+    SquareMatrix<3, Type> jacobians[BatchSize];
+
+    hessian = SquareMatrix<3, Type>{};
+    gradient = Vector3<Type>{};
+    Type sum = Type(0);
+
+    const size_t size = problem.size();
+    for(size_t begin = 0; begin < size; begin += BatchSize) {
+        const size_t end = begin + BatchSize < size ? begin + BatchSize : size;
+        problem(R, begin, end, residuals, jacobians);
+
+        for(size_t i = 0; i < end - begin; i++) {
+            const SquareMatrix<3, Type> jacobian_T = jacobians[i].T();
+            hessian += jacobian_T * jacobians[i];
+            gradient += jacobian_T * residuals[i];
+            sum += residuals[i].dot(residuals[i]);
+        }
+    }
+
+    _statistics.evaluations += size;
+    return sum / Type(2);
+}
+
+template<typename RotationMatrixConvention, typename Type, size_t BatchSize>
+template<typename Problem>
+Type RotationSolver<RotationMatrixConvention, Type, BatchSize>::cost(const Problem& problem, const RotationMatrixType& R) {
+    Vector3<Type> residuals[BatchSize];
+    Type sum = Type(0);
+
+    const size_t size = problem.size();
+    for(size_t begin = 0; begin < size; begin += BatchSize) {
+        const size_t end = begin + BatchSize < size ? begin + BatchSize : size;
+        problem(R, begin, end, residuals, nullptr);
+
+        for(size_t i = 0; i < end - begin; i++) {
+            sum += residuals[i].dot(residuals[i]);
+        }
+    }
+
+    _statistics.evaluations += size;
+    return sum / Type(2);
+}
+
+template<typename RotationMatrixConvention, typename Type, size_t BatchSize>
+RotationMatrix<RotationMatrixConvention, Type> RotationSolver<RotationMatrixConvention, Type, BatchSize>::retract(const RotationMatrixType& R, const Vector3<Type>& delta) {
+    if(is_same<RotationMatrixConvention, ACTIVE>::value) {
+        return R * RotationMatrixType::Exp(delta.hat());
+    }
+
+    return RotationMatrixType::Exp((-delta).hat()) * R;
+}
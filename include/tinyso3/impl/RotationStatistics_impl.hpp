@@ -0,0 +1,109 @@
+/**
+ * @file RotationStatistics_impl.hpp
+ *
+ * Mean and covariance of a batch of rotations, bitwise reproducible for any partition over threads.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename QuaternionConvention, typename Type, typename Summation, size_t Leaf>
+constexpr size_t RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::LeafSize;
+
+template<typename QuaternionConvention, typename Type, typename Summation, size_t Leaf>
+typename RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::SumType
+RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::RotationSum(const BatchType& q) {
+    return reduce(q.size(), [&](size_t begin, size_t end) { return RotationSum(q, begin, end); });
+}
+
+template<typename QuaternionConvention, typename Type, typename Summation, size_t Leaf>
+typename RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::SumType
+RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::RotationSum(const BatchType& q, size_t begin, size_t end) {
+    // The matrices of q and -q are the same, no sign alignment is needed.
+    SumType sum;
+    for(size_t i = begin; i < end; i++) {
+        sum.add(typename QuaternionType::RotationMatrixAlias{q[i]});
+    }
+    return sum;
+}
+
+template<typename QuaternionConvention, typename Type, typename Summation, size_t Leaf>
+typename RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::SumType
+RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::ScatterSum(const BatchType& q, const QuaternionType& mean) {
+    return reduce(q.size(), [&](size_t begin, size_t end) { return ScatterSum(q, mean, begin, end); });
+}
+
+template<typename QuaternionConvention, typename Type, typename Summation, size_t Leaf>
+typename RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::SumType
+RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::ScatterSum(const BatchType& q, const QuaternionType& mean, size_t begin, size_t end) {
+    SumType sum;
+    for(size_t i = begin; i < end; i++) {
+        const Vector3<Type> phi = q[i].boxminus(mean);
+        sum.add(phi * phi.transpose());
+    }
+    return sum;
+}
+
+template<typename QuaternionConvention, typename Type, typename Summation, size_t Leaf>
+Quaternion<QuaternionConvention, Type> RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::ChordalMean(const BatchType& q) {
+    return ChordalMean(RotationSum(q));
+}
+
+template<typename QuaternionConvention, typename Type, typename Summation, size_t Leaf>
+Quaternion<QuaternionConvention, Type> RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::ChordalMean(const SumType& rotation_sum) {
+    if(rotation_sum.count() == 0) {
+        return QuaternionType::Identity();
+    }
+    return QuaternionType{typename QuaternionType::RotationMatrixAlias{Project(SquareMatrix<3, Type>{rotation_sum.value() / Type(rotation_sum.count())})}};
+}
+
+template<typename QuaternionConvention, typename Type, typename Summation, size_t Leaf>
+SquareMatrix<3, Type> RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::Project(const SquareMatrix<3, Type>& M) {
+    // Right singular vectors and squared singular values, ascending, from M^T M.
+    // Squared singular values below machine epsilon times the largest are lost in M^T M, and treated as zero.
+    const array<EigenPair<Type>, 3> eigenpairs = EigenSolver<Type>{}(SquareMatrix<3, Type>{M.T() * M});
+    if(!(eigenpairs[2].first > machine_epsilon<Type>())) {
+        return SquareMatrix<3, Type>::Identity();
+    }
+
+    const Vector3<Type> v1 = eigenpairs[2].second.unit();
+    const Vector3<Type> u1 = Vector3<Type>{M * v1}.unit();
+    const Vector3<Type> v2 = (eigenpairs[1].second - v1 * v1.dot(eigenpairs[1].second)).unit();
+    Vector3<Type> u2;
+    if(eigenpairs[1].first > machine_epsilon<Type>() * eigenpairs[2].first) {
+        u2 = Vector3<Type>{M * v2};
+    } else {
+        // Rank one, v2 rotated about v1 x u1 by the angle between v1 and u1, or by pi about v2 if they are opposite.
+        const Vector3<Type> w = v1.cross(u1);
+        const Type c = v1.dot(u1);
+        u2 = Type(1) + c > machine_epsilon<Type>() ? Vector3<Type>{v2 * c + w.cross(v2) + w * (w.dot(v2) / (Type(1) + c))} : v2;
+    }
+    u2 = (u2 - u1 * u1.dot(u2)).unit();
+
+    // Completing both bases right handed flips the smallest singular direction when det(M) < 0.
+    return SquareMatrix<3, Type>{u1 * v1.transpose() + u2 * v2.transpose() + u1.cross(u2) * v1.cross(v2).transpose()};
+}
+
+template<typename QuaternionConvention, typename Type, typename Summation, size_t Leaf>
+SquareMatrix<3, Type> RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::Covariance(const BatchType& q, const QuaternionType& mean) {
+    return Covariance(ScatterSum(q, mean));
+}
+
+template<typename QuaternionConvention, typename Type, typename Summation, size_t Leaf>
+SquareMatrix<3, Type> RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::Covariance(const SumType& scatter_sum) {
+    return scatter_sum.count() > 0 ? SquareMatrix<3, Type>{scatter_sum.value() / Type(scatter_sum.count())} : SquareMatrix<3, Type>::Null();
+}
+
+template<typename QuaternionConvention, typename Type, typename Summation, size_t Leaf>
+template<typename Leaves>
+typename RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::SumType
+RotationStatistics<QuaternionConvention, Type, Summation, Leaf>::reduce(size_t size, Leaves&& leaves) {
+    ReductionTree<SumType> tree;
+    for(size_t leaf = 0; leaf < ReductionTree<SumType>::Leaves(size, Leaf); leaf++) {
+        size_t begin, end;
+        ReductionTree<SumType>::Range(leaf, size, Leaf, begin, end);
+        tree.push(leaves(begin, end));
+    }
+    return tree.result();
+}
@@ -0,0 +1,242 @@
+/**
+ * @file RotationTree_impl.hpp
+ *
+ * Vantage point tree over a set of rotations, for k nearest neighbor and radius queries.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename QuaternionConvention, typename Type>
+void RotationTree<QuaternionConvention, Type>::build(const QuaternionBatch<QuaternionConvention, const Type>& points) {
+    buildTop(points, ~size_t(0), nullptr);
+}
+
+template<typename QuaternionConvention, typename Type>
+size_t RotationTree<QuaternionConvention, Type>::buildTop(const QuaternionBatch<QuaternionConvention, const Type>& points, size_t levels, Subtree* subtrees) {
+    const Type* w = points.w();
+    const Type* x = points.x();
+    const Type* y = points.y();
+    const Type* z = points.z();
+
+    for(size_t i = 0; i < _size; i++) {
+        _nodes[i] = Node{w[i], x[i], y[i], z[i], Type(0), static_cast<uint32_t>(i), 0};
+    }
+
+    size_t count = 0;
+    split(0, static_cast<uint32_t>(_size), levels, subtrees, count);
+    return count;
+}
+
+template<typename QuaternionConvention, typename Type>
+void RotationTree<QuaternionConvention, Type>::buildSubtree(const Subtree& subtree) {
+    size_t count = 0;
+    split(subtree.begin, subtree.end, ~size_t(0), nullptr, count);
+}
+
+template<typename QuaternionConvention, typename Type>
+size_t RotationTree<QuaternionConvention, Type>::nearest(const QuaternionType& q, size_t k, Neighbor* neighbors) const {
+    k = k < _size ? k : _size;
+    size_t count = 0;
+    if(k > 0) {
+        searchNearest(0, static_cast<uint32_t>(_size), query(q), k, neighbors, count);
+    }
+
+    // Max heap of chordal distances to ascending rotation angles.
+    for(size_t n = count; n > 1; n--) {
+        const Neighbor last = neighbors[n - 1];
+        neighbors[n - 1] = neighbors[0];
+        neighbors[0] = last;
+        siftDown(neighbors, n - 1, 0);
+    }
+    for(size_t i = 0; i < count; i++) {
+        neighbors[i].angle = rotationAngle(neighbors[i].angle);
+    }
+    return count;
+}
+
+template<typename QuaternionConvention, typename Type>
+void RotationTree<QuaternionConvention, Type>::nearest(const QuaternionBatch<QuaternionConvention, const Type>& queries, size_t k, Neighbor* neighbors) const {
+    for(size_t i = 0; i < queries.size(); i++) {
+        nearest(queries[i], k, neighbors + i * k);
+    }
+}
+
+template<typename QuaternionConvention, typename Type>
+size_t RotationTree<QuaternionConvention, Type>::radius(const QuaternionType& q, const Type& angle, Neighbor* neighbors, size_t capacity) const {
+    size_t count = 0;
+    if(_size > 0 && angle >= Type(0)) {
+        searchRadius(0, static_cast<uint32_t>(_size), query(q), chordal(angle), neighbors, capacity, count);
+    }
+
+    const size_t written = count < capacity ? count : capacity;
+    for(size_t i = 0; i < written; i++) {
+        neighbors[i].angle = rotationAngle(neighbors[i].angle);
+    }
+    return count;
+}
+
+template<typename QuaternionConvention, typename Type>
+void RotationTree<QuaternionConvention, Type>::split(uint32_t begin, uint32_t end, size_t levels, Subtree* subtrees, size_t& count) {
+    if(begin >= end) {
+        return;
+    }
+    if(levels == 0) {
+        subtrees[count++] = Subtree{begin, end};
+        return;
+    }
+
+    // The middle node becomes the vantage point, the others are split at their median distance to it.
+    const uint32_t n = end - begin;
+    const Node vantage = _nodes[begin + n / 2];
+    _nodes[begin + n / 2] = _nodes[begin];
+    _nodes[begin] = vantage;
+    if(n == 1) {
+        _nodes[begin].threshold = Type(0);
+        _nodes[begin].inner = 0;
+        return;
+    }
+
+    const Query v{vantage.w, vantage.x, vantage.y, vantage.z};
+    for(uint32_t i = begin + 1; i < end; i++) {
+        _nodes[i].threshold = distance(v, _nodes[i]);
+    }
+    const uint32_t median = begin + 1 + (n - 1) / 2;
+    select(begin + 1, median, end);
+    _nodes[begin].threshold = _nodes[median].threshold;
+    _nodes[begin].inner = median - begin - 1;
+
+    split(begin + 1, median, levels - 1, subtrees, count);
+    split(median, end, levels - 1, subtrees, count);
+}
+
+template<typename QuaternionConvention, typename Type>
+void RotationTree<QuaternionConvention, Type>::select(uint32_t begin, uint32_t nth, uint32_t end) {
+    // Quickselect by threshold with Hoare partitions around the middle element.
+    while(end - begin > 1) {
+        const Type pivot = _nodes[begin + (end - begin - 1) / 2].threshold; // lower middle, each partition shrinks the range
+        size_t i = size_t(begin) - 1;
+        size_t j = end;
+        for(;;) {
+            do {
+                i++;
+            } while(_nodes[i].threshold < pivot);
+            do {
+                j--;
+            } while(_nodes[j].threshold > pivot);
+            if(i >= j) {
+                break;
+            }
+            const Node swap = _nodes[i];
+            _nodes[i] = _nodes[j];
+            _nodes[j] = swap;
+        }
+
+        if(nth <= j) {
+            end = static_cast<uint32_t>(j + 1);
+        } else {
+            begin = static_cast<uint32_t>(j + 1);
+        }
+    }
+}
+
+template<typename QuaternionConvention, typename Type>
+void RotationTree<QuaternionConvention, Type>::searchNearest(uint32_t begin, uint32_t end, const Query& q, size_t k, Neighbor* heap, size_t& count) const {
+    const Node& node = _nodes[begin];
+    const Type d = distance(q, node);
+    if(count < k) {
+        heap[count] = Neighbor{node.index, d};
+        siftUp(heap, count++);
+    } else if(d < heap[0].angle) {
+        heap[0] = Neighbor{node.index, d};
+        siftDown(heap, k, 0);
+    }
+
+    // The closer side first, the other only if the ball of the current k-th distance crosses the threshold.
+    const uint32_t middle = begin + 1 + node.inner;
+    if(d < node.threshold) {
+        if(begin + 1 < middle && (count < k || d - heap[0].angle <= node.threshold)) {
+            searchNearest(begin + 1, middle, q, k, heap, count);
+        }
+        if(middle < end && (count < k || d + heap[0].angle >= node.threshold)) {
+            searchNearest(middle, end, q, k, heap, count);
+        }
+    } else {
+        if(middle < end && (count < k || d + heap[0].angle >= node.threshold)) {
+            searchNearest(middle, end, q, k, heap, count);
+        }
+        if(begin + 1 < middle && (count < k || d - heap[0].angle <= node.threshold)) {
+            searchNearest(begin + 1, middle, q, k, heap, count);
+        }
+    }
+}
+
+template<typename QuaternionConvention, typename Type>
+void RotationTree<QuaternionConvention, Type>::searchRadius(uint32_t begin, uint32_t end, const Query& q, const Type& radius, Neighbor* neighbors, size_t capacity, size_t& count) const {
+    const Node& node = _nodes[begin];
+    const Type d = distance(q, node);
+    if(d <= radius) {
+        if(count < capacity) {
+            neighbors[count] = Neighbor{node.index, d};
+        }
+        count++;
+    }
+
+    const uint32_t middle = begin + 1 + node.inner;
+    if(begin + 1 < middle && d - radius <= node.threshold) {
+        searchRadius(begin + 1, middle, q, radius, neighbors, capacity, count);
+    }
+    if(middle < end && d + radius >= node.threshold) {
+        searchRadius(middle, end, q, radius, neighbors, capacity, count);
+    }
+}
+
+template<typename QuaternionConvention, typename Type>
+Type RotationTree<QuaternionConvention, Type>::distance(const Query& q, const Node& node) {
+    // min(|q - p|, |q + p|), without the cancellation of 2 - 2 |q . p| for close rotations.
+    const Type dw = q.w - node.w, dx = q.x - node.x, dy = q.y - node.y, dz = q.z - node.z;
+    const Type sw = q.w + node.w, sx = q.x + node.x, sy = q.y + node.y, sz = q.z + node.z;
+    const Type minus = dw * dw + dx * dx + dy * dy + dz * dz;
+    const Type plus = sw * sw + sx * sx + sy * sy + sz * sz;
+    return sqrt(minus < plus ? minus : plus);
+}
+
+template<typename QuaternionConvention, typename Type>
+Type RotationTree<QuaternionConvention, Type>::chordal(const Type& angle) {
+    return Type(2) * sin((angle < Type(M_PI) ? angle : Type(M_PI)) / Type(4));
+}
+
+template<typename QuaternionConvention, typename Type>
+Type RotationTree<QuaternionConvention, Type>::rotationAngle(const Type& chordal) {
+    const Type half = chordal / Type(2);
+    return Type(4) * asin(half < Type(1) ? half : Type(1));
+}
+
+template<typename QuaternionConvention, typename Type>
+void RotationTree<QuaternionConvention, Type>::siftUp(Neighbor* heap, size_t i) {
+    while(i > 0 && heap[(i - 1) / 2].angle < heap[i].angle) {
+        const Neighbor parent = heap[(i - 1) / 2];
+        heap[(i - 1) / 2] = heap[i];
+        heap[i] = parent;
+        i = (i - 1) / 2;
+    }
+}
+
+template<typename QuaternionConvention, typename Type>
+void RotationTree<QuaternionConvention, Type>::siftDown(Neighbor* heap, size_t size, size_t i) {
+    for(;;) {
+        size_t largest = i;
+        const size_t left = 2 * i + 1;
+        const size_t right = left + 1;
+        largest = left < size && heap[left].angle > heap[largest].angle ? left : largest;
+        largest = right < size && heap[right].angle > heap[largest].angle ? right : largest;
+        if(largest == i) {
+            return;
+        }
+        const Neighbor child = heap[largest];
+        heap[largest] = heap[i];
+        heap[i] = child;
+        i = largest;
+    }
+}
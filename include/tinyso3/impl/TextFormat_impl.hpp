@@ -0,0 +1,657 @@
+/**
+ * @file TextFormat_impl.hpp
+ *
+ * Allocation-free, locale-independent conversion between floating point values and decimal text.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+template<typename Type>
+size_t TextFormat<Type>::Format(const Type& value, char* out) {
+    const Bits bits = toBits(value);
+    const Bits sign = Bits(1) << (SignificandBits + ExponentBits);
+    const Bits exponent = (bits >> SignificandBits) & ((Bits(1) << ExponentBits) - Bits(1));
+    const Bits significand = bits & ((Bits(1) << SignificandBits) - Bits(1));
+
+    if(exponent == (Bits(1) << ExponentBits) - Bits(1) && significand != Bits(0)) {
+        memcpy(out, "nan", 3);
+        return 3;
+    }
+
+    size_t length = 0;
+    if(bits & sign) {
+        out[length++] = '-';
+    }
+    if(exponent == (Bits(1) << ExponentBits) - Bits(1)) {
+        memcpy(out + length, "inf", 3);
+        return length + 3;
+    }
+    if((bits & ~sign) == Bits(0)) {
+        out[length++] = '0';
+        return length;
+    }
+
+    size_t digits = 0;
+    int k = 0;
+    grisu2(fromBits(bits & ~sign), out + length, digits, k);
+    return length + prettify(out + length, digits, k);
+}
+
+template<typename Type>
+template<size_t M, size_t N>
+size_t TextFormat<Type>::Format(const Matrix<M, N, Type>& matrix, char* out, char separator) {
+    size_t length = 0;
+    for(size_t k = 0; k < M * N; k++) {
+        if(k > 0) {
+            out[length++] = separator;
+        }
+        length += Format(matrix(k / N, k % N), out + length);
+    }
+    return length;
+}
+
+template<typename Type>
+bool TextFormat<Type>::Parse(const char*& cursor, const char* end, Type& value) {
+    const char* p = cursor;
+    bool negative = false;
+    if(p < end && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        p++;
+    }
+
+    if(match(p, end, "inf") || match(p, end, "nan")) {
+        const bool nan = match(p, end, "nan");
+        p += match(p, end, "infinity") ? 8 : 3;
+        const Bits bits = ((Bits(1) << ExponentBits) - Bits(1)) << SignificandBits;
+        value = fromBits(nan ? bits | (Bits(1) << (SignificandBits - 1)) : bits);
+        value = negative ? -value : value;
+        cursor = p;
+        return true;
+    }
+
+    // Up to 19 significant digits are accumulated, the rest only shift the exponent.
+    const char* const digits_begin = p;
+    uint64_t mantissa = 0;
+    int significant = 0;
+    int exponent = 0;
+    bool truncated = false;
+    bool any = false;
+    bool dot = false;
+    for(; p < end; p++) {
+        if(*p == '.' && !dot) {
+            dot = true;
+            continue;
+        }
+        if(*p < '0' || *p > '9') {
+            break;
+        }
+
+        const unsigned digit = static_cast<unsigned>(*p - '0');
+        any = true;
+        if(significant < 19) {
+            mantissa = mantissa * 10 + digit;
+            significant += mantissa != 0 ? 1 : 0;
+            exponent -= dot ? 1 : 0;
+        } else {
+            truncated |= digit != 0;
+            exponent += dot ? 0 : 1;
+        }
+    }
+    if(!any) {
+        return false;
+    }
+    const char* const digits_end = p;
+
+    int explicit_exponent = 0;
+    if(p < end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        const bool exponent_negative = q < end && *q == '-';
+        q += q < end && (*q == '+' || *q == '-') ? 1 : 0;
+        if(q < end && *q >= '0' && *q <= '9') {
+            for(; q < end && *q >= '0' && *q <= '9'; q++) {
+                explicit_exponent = explicit_exponent < 100000 ? explicit_exponent * 10 + (*q - '0') : explicit_exponent;
+            }
+            explicit_exponent = exponent_negative ? -explicit_exponent : explicit_exponent;
+            p = q;
+        }
+    }
+    exponent += explicit_exponent;
+
+    Type result;
+    if(mantissa == 0 && !truncated) {
+        result = Type(0);
+    } else if(!truncated && mantissa <= FastPathSignificand && exponent >= -FastPathExponent && exponent <= FastPathExponent) {
+        // Both the mantissa and the power of ten are exact, a single correctly rounded operation.
+        static const Type powers[] = {Type(1e0), Type(1e1), Type(1e2), Type(1e3), Type(1e4), Type(1e5), Type(1e6), Type(1e7),
+                                      Type(1e8), Type(1e9), Type(1e10), Type(1e11), Type(1e12), Type(1e13), Type(1e14), Type(1e15),
+                                      Type(1e16), Type(1e17), Type(1e18), Type(1e19), Type(1e20), Type(1e21), Type(1e22)};
+        result = static_cast<Type>(mantissa);
+        result = exponent < 0 ? result / powers[-exponent] : result * powers[exponent];
+    } else if(!approximate(mantissa, significant, exponent, truncated, result)) {
+        Decimal decimal;
+        decimal.count = 0;
+        decimal.point = 0;
+        decimal.truncated = false;
+        bool decimal_dot = false;
+        for(const char* q = digits_begin; q < digits_end; q++) {
+            if(*q == '.') {
+                decimal_dot = true;
+                decimal.point = decimal.count;
+                continue;
+            }
+
+            const unsigned char digit = static_cast<unsigned char>(*q - '0');
+            if(digit == 0 && decimal.count == 0) { // leading zeros
+                decimal.point--;
+                continue;
+            }
+            if(decimal.count < Decimal::Capacity) {
+                decimal.digits[decimal.count++] = digit;
+            } else if(digit != 0) {
+                decimal.truncated = true;
+            }
+        }
+        decimal.point = (decimal_dot ? decimal.point : decimal.count) + explicit_exponent;
+        result = fromBits(decimal.bits());
+    }
+
+    value = negative ? -result : result;
+    cursor = p;
+    return true;
+}
+
+template<typename Type>
+template<size_t M, size_t N>
+bool TextFormat<Type>::Parse(const char*& cursor, const char* end, Matrix<M, N, Type>& matrix, char separator) {
+    const char* p = cursor;
+    Matrix<M, N, Type> result;
+    for(size_t k = 0; k < M * N; k++) {
+        for(; p < end && (*p == ' ' || *p == '\t'); p++) {}
+        if(k > 0) {
+            if(p == end || *p != separator) {
+                return false;
+            }
+            for(p++; p < end && (*p == ' ' || *p == '\t'); p++) {}
+        }
+        if(!Parse(p, end, result(k / N, k % N))) {
+            return false;
+        }
+    }
+
+    matrix = result;
+    cursor = p;
+    return true;
+}
+
+template<typename Type>
+typename TextFormat<Type>::DiyFp TextFormat<Type>::multiply(const DiyFp& a, const DiyFp& b) {
+    // Upper 64 bits of the 128 bits product, rounded.
+    const uint64_t mask = 0xFFFFFFFFu;
+    const uint64_t ah = a.f >> 32, al = a.f & mask;
+    const uint64_t bh = b.f >> 32, bl = b.f & mask;
+    const uint64_t hh = ah * bh, hl = ah * bl, lh = al * bh, ll = al * bl;
+    const uint64_t middle = (ll >> 32) + (hl & mask) + (lh & mask) + (uint64_t(1) << 31);
+    return DiyFp{hh + (hl >> 32) + (lh >> 32) + (middle >> 32), a.e + b.e + 64};
+}
+
+template<typename Type>
+typename TextFormat<Type>::DiyFp TextFormat<Type>::normalize(DiyFp x) {
+    while(!(x.f & (uint64_t(1) << 63))) {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+template<typename Type>
+typename TextFormat<Type>::DiyFp TextFormat<Type>::cachedPower(int e, int& k) {
+    // The smallest power whose product with a significand of exponent e lands in [2^-59, 2^-32) * 2^64.
+    const double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int ik = static_cast<int>(dk);
+    ik += dk - ik > 0.0 ? 1 : 0;
+    const size_t index = static_cast<size_t>((ik >> 3) + 1);
+    k = 348 - static_cast<int>(index) * 8;
+    return cachedPower(index);
+}
+
+template<typename Type>
+typename TextFormat<Type>::DiyFp TextFormat<Type>::cachedPower(size_t index) {
+    // 10^(-348 + 8 * i), normalized and rounded to 64 bits
+    static const uint64_t significands[] = {
+      0xfa8fd5a0081c0288, 0xbaaee17fa23ebf76, 0x8b16fb203055ac76, 0xcf42894a5dce35ea, 0x9a6bb0aa55653b2d, 0xe61acf033d1a45df,
+      0xab70fe17c79ac6ca, 0xff77b1fcbebcdc4f, 0xbe5691ef416bd60c, 0x8dd01fad907ffc3c, 0xd3515c2831559a83, 0x9d71ac8fada6c9b5,
+      0xea9c227723ee8bcb, 0xaecc49914078536d, 0x823c12795db6ce57, 0xc21094364dfb5637, 0x9096ea6f3848984f, 0xd77485cb25823ac7,
+      0xa086cfcd97bf97f4, 0xef340a98172aace5, 0xb23867fb2a35b28e, 0x84c8d4dfd2c63f3b, 0xc5dd44271ad3cdba, 0x936b9fcebb25c996,
+      0xdbac6c247d62a584, 0xa3ab66580d5fdaf6, 0xf3e2f893dec3f126, 0xb5b5ada8aaff80b8, 0x87625f056c7c4a8b, 0xc9bcff6034c13053,
+      0x964e858c91ba2655, 0xdff9772470297ebd, 0xa6dfbd9fb8e5b88f, 0xf8a95fcf88747d94, 0xb94470938fa89bcf, 0x8a08f0f8bf0f156b,
+      0xcdb02555653131b6, 0x993fe2c6d07b7fac, 0xe45c10c42a2b3b06, 0xaa242499697392d3, 0xfd87b5f28300ca0e, 0xbce5086492111aeb,
+      0x8cbccc096f5088cc, 0xd1b71758e219652c, 0x9c40000000000000, 0xe8d4a51000000000, 0xad78ebc5ac620000, 0x813f3978f8940984,
+      0xc097ce7bc90715b3, 0x8f7e32ce7bea5c70, 0xd5d238a4abe98068, 0x9f4f2726179a2245, 0xed63a231d4c4fb27, 0xb0de65388cc8ada8,
+      0x83c7088e1aab65db, 0xc45d1df942711d9a, 0x924d692ca61be758, 0xda01ee641a708dea, 0xa26da3999aef774a, 0xf209787bb47d6b85,
+      0xb454e4a179dd1877, 0x865b86925b9bc5c2, 0xc83553c5c8965d3d, 0x952ab45cfa97a0b3, 0xde469fbd99a05fe3, 0xa59bc234db398c25,
+      0xf6c69a72a3989f5c, 0xb7dcbf5354e9bece, 0x88fcf317f22241e2, 0xcc20ce9bd35c78a5, 0x98165af37b2153df, 0xe2a0b5dc971f303a,
+      0xa8d9d1535ce3b396, 0xfb9b7cd9a4a7443c, 0xbb764c4ca7a44410, 0x8bab8eefb6409c1a, 0xd01fef10a657842c, 0x9b10a4e5e9913129,
+      0xe7109bfba19c0c9d, 0xac2820d9623bf429, 0x80444b5e7aa7cf85, 0xbf21e44003acdd2d, 0x8e679c2f5e44ff8f, 0xd433179d9c8cb841,
+      0x9e19db92b4e31ba9, 0xeb96bf6ebadf77d9, 0xaf87023b9bf0ee6b};
+    static const int16_t exponents[] = {
+      -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927, -901, -874, -847, -821, -794, -768,
+      -741, -715, -688, -661, -635, -608, -582, -555, -529, -502, -475, -449, -422, -396, -369, -343, -316, -289,
+      -263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30, 56, 83, 109, 136, 162, 189,
+      216, 242, 269, 295, 322, 348, 375, 402, 428, 455, 481, 508, 534, 561, 588, 614, 641, 667,
+      694, 720, 747, 774, 800, 827, 853, 880, 907, 933, 960, 986, 1013, 1039, 1066};
+
+    return DiyFp{significands[index], exponents[index]};
+}
+
+template<typename Type>
+void TextFormat<Type>::round(char* digits, size_t length, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t distance) {
+    // Moves the last digit towards the exact value while staying within the rounding interval.
+    while(rest < distance && delta - rest >= ten_kappa && (rest + ten_kappa < distance || distance - rest > rest + ten_kappa - distance)) {
+        digits[length - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+template<typename Type>
+void TextFormat<Type>::grisu2(const Type& value, char* digits, size_t& length, int& k) {
+    const Bits bits = toBits(value);
+    const int biased = static_cast<int>((bits >> SignificandBits) & ((Bits(1) << ExponentBits) - Bits(1)));
+    const uint64_t significand = static_cast<uint64_t>(bits & ((Bits(1) << SignificandBits) - Bits(1)));
+    const uint64_t hidden = uint64_t(1) << SignificandBits;
+    const DiyFp v = biased != 0 ? DiyFp{significand + hidden, biased - ExponentBias - SignificandBits} :
+                                  DiyFp{significand, 1 - ExponentBias - SignificandBits};
+
+    // Boundaries halfway to the neighbours, with the upper one normalized.
+    DiyFp plus{(v.f << 1) + 1, v.e - 1};
+    while(!(plus.f & (hidden << 1))) {
+        plus.f <<= 1;
+        plus.e--;
+    }
+    plus.f <<= 64 - SignificandBits - 2;
+    plus.e -= 64 - SignificandBits - 2;
+    DiyFp minus = v.f == hidden ? DiyFp{(v.f << 2) - 1, v.e - 2} : DiyFp{(v.f << 1) - 1, v.e - 1};
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+
+    const DiyFp c = cachedPower(plus.e, k);
+    const DiyFp w = multiply(normalize(v), c);
+    DiyFp upper = multiply(plus, c);
+    DiyFp lower = multiply(minus, c);
+    upper.f--;
+    lower.f++;
+
+    // Digit generation, the integral part then the fractional part of upper.
+    static const uint64_t powers[] = {1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+                                      10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull,
+                                      1000000000000000ull, 10000000000000000ull, 100000000000000000ull, 1000000000000000000ull};
+    const DiyFp one{uint64_t(1) << -upper.e, upper.e};
+    const uint64_t distance = upper.f - w.f;
+    uint64_t delta = upper.f - lower.f;
+    uint32_t integral = static_cast<uint32_t>(upper.f >> -one.e);
+    uint64_t fractional = upper.f & (one.f - 1);
+
+    int kappa = 1;
+    while(kappa < 10 && integral >= powers[kappa]) {
+        kappa++;
+    }
+
+    length = 0;
+    while(kappa > 0) {
+        const uint32_t digit = static_cast<uint32_t>(integral / powers[kappa - 1]);
+        integral = static_cast<uint32_t>(integral % powers[kappa - 1]);
+        if(digit != 0 || length != 0) {
+            digits[length++] = static_cast<char>('0' + digit);
+        }
+        kappa--;
+
+        const uint64_t rest = (static_cast<uint64_t>(integral) << -one.e) + fractional;
+        if(rest <= delta) {
+            k += kappa;
+            round(digits, length, delta, rest, powers[kappa] << -one.e, distance);
+            return;
+        }
+    }
+
+    for(;;) {
+        fractional *= 10;
+        delta *= 10;
+        const char digit = static_cast<char>(fractional >> -one.e);
+        if(digit != 0 || length != 0) {
+            digits[length++] = static_cast<char>('0' + digit);
+        }
+        fractional &= one.f - 1;
+        kappa--;
+        if(fractional < delta) {
+            k += kappa;
+            round(digits, length, delta, fractional, one.f, distance * powers[-kappa]);
+            return;
+        }
+    }
+}
+
+template<typename Type>
+size_t TextFormat<Type>::prettify(char* out, size_t length, int k) {
+    // The value is 0.digits * 10^point.
+    const int point = static_cast<int>(length) + k;
+    const int digits = static_cast<int>(length);
+
+    if(k >= 0 && point <= 21) { // 1234e7 -> 12340000000
+        for(int i = digits; i < point; i++) {
+            out[i] = '0';
+        }
+        return static_cast<size_t>(point);
+    }
+    if(point > 0 && point <= 21) { // 1234e-2 -> 12.34
+        memmove(out + point + 1, out + point, static_cast<size_t>(digits - point));
+        out[point] = '.';
+        return length + 1;
+    }
+    if(point > -6 && point <= 0) { // 1234e-6 -> 0.001234
+        const int offset = 2 - point;
+        memmove(out + offset, out, length);
+        out[0] = '0';
+        out[1] = '.';
+        for(int i = 2; i < offset; i++) {
+            out[i] = '0';
+        }
+        return length + static_cast<size_t>(offset);
+    }
+
+    // 1234e30 -> 1.234e+33
+    size_t position = 1;
+    if(digits > 1) {
+        memmove(out + 2, out + 1, length - 1);
+        out[1] = '.';
+        position = length + 1;
+    }
+    out[position++] = 'e';
+
+    int exponent = point - 1;
+    out[position++] = exponent < 0 ? '-' : '+';
+    exponent = exponent < 0 ? -exponent : exponent;
+    if(exponent >= 100) {
+        out[position++] = static_cast<char>('0' + exponent / 100);
+        exponent %= 100;
+    }
+    out[position++] = static_cast<char>('0' + exponent / 10);
+    out[position++] = static_cast<char>('0' + exponent % 10);
+    return position;
+}
+
+template<typename Type>
+bool TextFormat<Type>::approximate(uint64_t mantissa, int digits, int exponent, bool truncated, Type& value) {
+    // Errors are counted in eighths of the unit in the last place of the 64 bit significand.
+    constexpr int denominator_log = 3;
+    constexpr uint64_t denominator = 1 << denominator_log;
+    if(exponent < -348 || exponent >= 348) {
+        return false;
+    }
+
+    DiyFp input{mantissa, 0};
+    uint64_t error = truncated ? denominator : 0; // dropped digits add less than one unit
+    DiyFp normalized = normalize(input);
+    error <<= input.e - normalized.e;
+    input = normalized;
+
+    // 10^exponent as an exact power 10^1 to 10^7 times a cached power.
+    const size_t index = static_cast<size_t>(exponent + 348) / 8;
+    const int adjustment = exponent + 348 - static_cast<int>(index) * 8;
+    if(adjustment > 0) {
+        static const DiyFp powers[] = {{0xa000000000000000u, -60}, {0xc800000000000000u, -57}, {0xfa00000000000000u, -54}, {0x9c40000000000000u, -50},
+                                       {0xc350000000000000u, -47}, {0xf424000000000000u, -44}, {0x9896800000000000u, -40}};
+        input = multiply(input, powers[adjustment - 1]);
+        // Exact if the product has at most 18 digits (below 2^63), otherwise rounded by half a unit.
+        error += 18 - digits >= adjustment ? 0 : denominator / 2;
+    }
+    input = multiply(input, cachedPower(index));
+    // The cached power and the rounding of the product are within half a unit each, plus their cross term.
+    error += denominator / 2 + denominator / 2 + (error == 0 ? 0 : 1);
+
+    normalized = normalize(input);
+    error <<= input.e - normalized.e;
+    input = normalized;
+
+    // Bits of the 64 bit significand below the precision of Type at this magnitude, fewer for subnormals.
+    constexpr int denormal_exponent = 1 - ExponentBias - SignificandBits;
+    const int magnitude = 64 + input.e;
+    const int precision = magnitude >= denormal_exponent + SignificandBits + 1 ? SignificandBits + 1 : magnitude - denormal_exponent;
+    if(precision < -1) {
+        // Below a quarter of the smallest subnormal, the error can not reach the halfway point to it.
+        value = Type(0);
+        return true;
+    }
+    // At precision -1, below the halfway point to the smallest subnormal, the last place is still the smallest subnormal.
+    int dropped = 64 - precision;
+    if(dropped + denominator_log >= 64) {
+        // Tiny subnormals, where the halfway point in eighths exceeds 64 bits.
+        const int shift = dropped + denominator_log - 64 + 1;
+        input.f >>= shift;
+        input.e += shift;
+        error = (error >> shift) + 1 + denominator;
+        dropped -= shift;
+    }
+
+    const uint64_t rest = (input.f & ((uint64_t(1) << dropped) - 1)) * denominator;
+    const uint64_t halfway = (uint64_t(1) << (dropped - 1)) * denominator;
+    if(halfway - error < rest && rest < halfway + error) {
+        return false;
+    }
+
+    uint64_t significand = (input.f >> dropped) + (rest >= halfway + error ? 1 : 0);
+    int e = input.e + dropped;
+    const uint64_t hidden = uint64_t(1) << SignificandBits;
+    if(significand >= hidden << 1) { // rounded up to the next binade
+        significand >>= 1;
+        e++;
+    }
+    if(e + SignificandBits > ExponentBias) {
+        value = fromBits(((Bits(1) << ExponentBits) - Bits(1)) << SignificandBits);
+        return true;
+    }
+    if(significand == 0 || e < denormal_exponent) {
+        value = Type(0);
+        return true;
+    }
+    while(e > denormal_exponent && (significand & hidden) == 0) {
+        significand <<= 1;
+        e--;
+    }
+    const Bits biased = e == denormal_exponent && (significand & hidden) == 0 ? Bits(0) : static_cast<Bits>(e + ExponentBias + SignificandBits);
+    value = fromBits(static_cast<Bits>(significand & (hidden - 1)) | (biased << SignificandBits));
+    return true;
+}
+
+template<typename Type>
+void TextFormat<Type>::Decimal::shift(int k) {
+    constexpr int max_shift = 60;
+    if(count == 0) {
+        return;
+    }
+    for(; k > max_shift; k -= max_shift) {
+        leftShift(max_shift);
+    }
+    for(; k < -max_shift; k += max_shift) {
+        rightShift(max_shift);
+    }
+    if(k > 0) {
+        leftShift(k);
+    } else if(k < 0) {
+        rightShift(-k);
+    }
+}
+
+template<typename Type>
+void TextFormat<Type>::Decimal::leftShift(int k) {
+    // Multiplies from the least significant digit, the carry adds at most 20 leading digits.
+    unsigned char product[Capacity + 20];
+    int w = Capacity + 20;
+    uint64_t n = 0;
+    for(int r = count - 1; r >= 0; r--) {
+        n += static_cast<uint64_t>(digits[r]) << k;
+        product[--w] = static_cast<unsigned char>(n % 10);
+        n /= 10;
+    }
+    for(; n > 0; n /= 10) {
+        product[--w] = static_cast<unsigned char>(n % 10);
+    }
+
+    const int length = Capacity + 20 - w;
+    const int kept = length < Capacity ? length : Capacity;
+    for(int i = kept; i < length; i++) {
+        truncated |= product[w + i] != 0;
+    }
+    memcpy(digits, product + w, static_cast<size_t>(kept));
+    point += length - count;
+    count = kept;
+    trim();
+}
+
+template<typename Type>
+void TextFormat<Type>::Decimal::rightShift(int k) {
+    // Long division by 2^k from the most significant digit.
+    int r = 0;
+    int w = 0;
+    uint64_t n = 0;
+    for(; (n >> k) == 0; r++) {
+        if(r >= count) {
+            if(n == 0) {
+                count = 0;
+                return;
+            }
+            for(; (n >> k) == 0; r++) {
+                n *= 10;
+            }
+            break;
+        }
+        n = n * 10 + digits[r];
+    }
+    point -= r - 1;
+
+    const uint64_t mask = (uint64_t(1) << k) - 1;
+    for(; r < count; r++) {
+        const uint64_t digit = digits[r];
+        digits[w++] = static_cast<unsigned char>(n >> k);
+        n &= mask;
+        n = n * 10 + digit;
+    }
+    for(; n > 0; n *= 10) {
+        const uint64_t digit = n >> k;
+        n &= mask;
+        if(w < Capacity) {
+            digits[w++] = static_cast<unsigned char>(digit);
+        } else if(digit > 0) {
+            truncated = true;
+        }
+    }
+    count = w;
+    trim();
+}
+
+template<typename Type>
+void TextFormat<Type>::Decimal::trim() {
+    while(count > 0 && digits[count - 1] == 0) {
+        count--;
+    }
+    point = count == 0 ? 0 : point;
+}
+
+template<typename Type>
+uint64_t TextFormat<Type>::Decimal::roundedInteger() const {
+    if(point > 20) {
+        return ~uint64_t(0);
+    }
+
+    uint64_t n = 0;
+    int i = 0;
+    for(; i < point && i < count; i++) {
+        n = n * 10 + digits[i];
+    }
+    for(; i < point; i++) {
+        n *= 10;
+    }
+
+    // Round half to even, dropped digits make a halfway value larger.
+    bool up = false;
+    if(point >= 0 && point < count) {
+        up = digits[point] == 5 && point + 1 == count ? truncated || (point > 0 && digits[point - 1] % 2 == 1) : digits[point] >= 5;
+    }
+    return n + (up ? 1 : 0);
+}
+
+template<typename Type>
+typename TextFormat<Type>::Bits TextFormat<Type>::Decimal::bits() {
+    const Bits infinity = ((Bits(1) << ExponentBits) - Bits(1)) << SignificandBits;
+    const int bias = -ExponentBias;
+    if(count == 0 || point < -330) {
+        return Bits(0);
+    }
+    if(point > 310) {
+        return infinity;
+    }
+
+    // Scales by powers of two into [0.5, 1), the shifts keep the value within 60 bits per digit step.
+    static const int powers[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};
+    int exponent = 0;
+    while(point > 0) {
+        const int n = point >= 9 ? 27 : powers[point];
+        shift(-n);
+        exponent += n;
+    }
+    while(point < 0 || (point == 0 && digits[0] < 5)) {
+        const int n = -point >= 9 ? 27 : powers[-point];
+        shift(n);
+        exponent -= n;
+    }
+    exponent--; // [0.5, 1) to [1, 2)
+
+    // Subnormals
+    if(exponent < bias + 1) {
+        shift(-(bias + 1 - exponent));
+        exponent = bias + 1;
+    }
+    if(exponent - bias >= (1 << ExponentBits) - 1) {
+        return infinity;
+    }
+
+    shift(1 + SignificandBits);
+    uint64_t significand = roundedInteger();
+    if(significand == (uint64_t(2) << SignificandBits)) { // rounded up to the next binade
+        significand >>= 1;
+        exponent++;
+        if(exponent - bias >= (1 << ExponentBits) - 1) {
+            return infinity;
+        }
+    }
+    if(!(significand & (uint64_t(1) << SignificandBits))) {
+        exponent = bias;
+    }
+
+    return static_cast<Bits>(significand & ((uint64_t(1) << SignificandBits) - 1)) |
+           (static_cast<Bits>(exponent - bias) << SignificandBits);
+}
+
+template<typename Type>
+Type TextFormat<Type>::fromBits(Bits bits) {
+    Type value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+template<typename Type>
+typename TextFormat<Type>::Bits TextFormat<Type>::toBits(const Type& value) {
+    Bits bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+template<typename Type>
+bool TextFormat<Type>::match(const char* cursor, const char* end, const char* word) {
+    for(; *word != '\0'; cursor++, word++) {
+        if(cursor == end || (*cursor | 0x20) != *word) {
+            return false;
+        }
+    }
+    return true;
+}
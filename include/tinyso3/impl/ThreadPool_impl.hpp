@@ -0,0 +1,196 @@
+/**
+ * @file ThreadPool_impl.hpp
+ *
+ * Work stealing thread pool, with parallel loops and reductions over index ranges, e.g. of batch views.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+inline ThreadPool::ThreadPool(size_t threads) :
+_size(threads > 0 ? threads : (std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1)),
+_ranges(new Range[_size]) {
+    for(size_t t = 0; t < _size; t++) {
+        _ranges[t].bounds.store(0, std::memory_order_relaxed);
+    }
+    _workers.reserve(_size - 1);
+    for(size_t t = 1; t < _size; t++) {
+        _workers.emplace_back(&ThreadPool::loop, this, t);
+    }
+}
+
+inline ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _wake.notify_all();
+    for(std::thread& worker : _workers) {
+        worker.join();
+    }
+}
+
+template<typename Function>
+void ThreadPool::run(size_t chunks, Function&& function) {
+    using FunctionType = typename std::remove_reference<Function>::type;
+    const Invoke invoke = [](void* context, size_t chunk, size_t thread) {
+        (*static_cast<FunctionType*>(context))(chunk, thread);
+    };
+    dispatch(chunks, invoke, const_cast<void*>(static_cast<const void*>(&function)));
+}
+
+template<typename Function>
+void ThreadPool::parallelFor(size_t size, Function&& function, size_t grain, Chunking chunking) {
+    const size_t step = chunkSize(size, grain, chunking);
+    run((size + step - 1) / step, [&](size_t chunk, size_t) {
+        const size_t begin = chunk * step;
+        function(begin, size - begin > step ? begin + step : size);
+    });
+}
+
+template<typename Type, typename Map, typename Combine>
+Type ThreadPool::parallelReduce(size_t size, const Type& identity, Map&& map, Combine&& combine, size_t grain, Chunking chunking) {
+    const size_t step = chunkSize(size, grain, chunking);
+    const size_t chunks = (size + step - 1) / step;
+
+    if(chunking == Chunking::DYNAMIC) {
+        std::vector<Type> partials(_size, identity);
+        run(chunks, [&](size_t chunk, size_t thread) {
+            const size_t begin = chunk * step;
+            partials[thread] = combine(partials[thread], map(begin, size - begin > step ? begin + step : size));
+        });
+
+        Type result = identity;
+        for(size_t t = 0; t < _size; t++) {
+            result = combine(result, partials[t]);
+        }
+        return result;
+    }
+
+    std::vector<Type> partials(chunks, identity);
+    run(chunks, [&](size_t chunk, size_t) {
+        const size_t begin = chunk * step;
+        partials[chunk] = map(begin, size - begin > step ? begin + step : size);
+    });
+
+    // Pairwise in chunk order, the same tree for any number of threads.
+    for(size_t width = 1; width < chunks; width *= 2) {
+        for(size_t i = 0; i + width < chunks; i += 2 * width) {
+            partials[i] = combine(partials[i], partials[i + width]);
+        }
+    }
+    return chunks > 0 ? partials[0] : identity;
+}
+
+inline size_t ThreadPool::chunkSize(size_t size, size_t grain, Chunking chunking) const {
+    if(grain > 0) {
+        return grain;
+    }
+    const size_t chunks = chunking == Chunking::DETERMINISTIC ? 256 : 8 * _size;
+    const size_t step = (size + chunks - 1) / chunks;
+    return step > 0 ? step : 1;
+}
+
+inline void ThreadPool::dispatch(size_t chunks, Invoke invoke, void* context) {
+    if(_size == 1 || chunks <= 1) {
+        for(size_t chunk = 0; chunk < chunks; chunk++) {
+            invoke(context, chunk, 0);
+        }
+        return;
+    }
+
+    for(size_t t = 0; t < _size; t++) {
+        _ranges[t].bounds.store(pack(chunks * t / _size, chunks * (t + 1) / _size), std::memory_order_relaxed);
+    }
+    _remaining.store(chunks, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _invoke = invoke;
+        _context = context;
+        _busy = _size - 1;
+        _generation++;
+    }
+    _wake.notify_all();
+
+    work(0);
+
+    // The context lives on the caller's stack, wait for every worker to leave the loop.
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done.wait(lock, [this] { return _busy == 0; });
+}
+
+inline void ThreadPool::loop(size_t thread) {
+    uint64_t generation = 0;
+    for(;;) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wake.wait(lock, [&] { return _stop || _generation != generation; });
+            if(_stop) {
+                return;
+            }
+            generation = _generation;
+        }
+
+        work(thread);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(--_busy == 0) {
+            _done.notify_one();
+        }
+    }
+}
+
+inline void ThreadPool::work(size_t thread) {
+    for(;;) {
+        size_t chunk;
+        if(pop(thread, chunk)) {
+            _invoke(_context, chunk, thread);
+            _remaining.fetch_sub(1, std::memory_order_acq_rel);
+            continue;
+        }
+        if(_remaining.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+        if(!steal(thread)) {
+            std::this_thread::yield(); // the last chunks are running elsewhere
+        }
+    }
+}
+
+inline bool ThreadPool::pop(size_t thread, size_t& chunk) {
+    std::atomic<uint64_t>& bounds = _ranges[thread].bounds;
+    uint64_t current = bounds.load(std::memory_order_relaxed);
+    for(;;) {
+        const uint64_t begin = current & 0xFFFFFFFFu;
+        const uint64_t end = current >> 32;
+        if(begin >= end) {
+            return false;
+        }
+        if(bounds.compare_exchange_weak(current, pack(begin + 1, end), std::memory_order_relaxed)) {
+            chunk = static_cast<size_t>(begin);
+            return true;
+        }
+    }
+}
+
+inline bool ThreadPool::steal(size_t thread) {
+    for(size_t k = 1; k < _size; k++) {
+        std::atomic<uint64_t>& victim = _ranges[(thread + k) % _size].bounds;
+        uint64_t current = victim.load(std::memory_order_relaxed);
+        for(;;) {
+            const uint64_t begin = current & 0xFFFFFFFFu;
+            const uint64_t end = current >> 32;
+            if(begin >= end) {
+                break;
+            }
+            // The back half, or the last chunk. A chunk is in one range at a time and never returns, so no ABA.
+            const uint64_t middle = begin + (end - begin) / 2;
+            if(victim.compare_exchange_weak(current, pack(begin, middle), std::memory_order_relaxed)) {
+                _ranges[thread].bounds.store(pack(middle, end), std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    return false;
+}
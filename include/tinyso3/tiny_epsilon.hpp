@@ -1,5 +1,7 @@
 #pragma once
 
+#include <float.h>
+
 #include "config.hpp"
 
 #define TINYSO3_EPS_EXPONENT_0 1e-0
@@ -51,4 +53,28 @@ template<>
 constexpr long double epsilon<>() {
     return static_cast<long double>(TINYSO3_LDBL_EPSILON);
 }
+
+/**
+ * Machine epsilon, the distance from 1 to the next representable value, for sizing series cutoffs.
+ */
+template<typename T>
+constexpr T machine_epsilon() {
+    static_assert(true, "T must be a floating point type");
+    return static_cast<T>(0); // Can not reach here, but to avoid compiler warning
+}
+
+template<>
+constexpr float machine_epsilon<>() {
+    return FLT_EPSILON;
+}
+
+template<>
+constexpr double machine_epsilon<>() {
+    return DBL_EPSILON;
+}
+
+template<>
+constexpr long double machine_epsilon<>() {
+    return LDBL_EPSILON;
+}
 }; // namespace tinyso3
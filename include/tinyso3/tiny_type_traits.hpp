@@ -52,6 +52,16 @@ struct is_same : false_type {};
 template<class T>
 struct is_same<T, T> : true_type {};
 
+/**
+ * @brief remove_const
+ */
+template<class T>
+struct remove_const { using type = T; };
+template<class T>
+struct remove_const<const T> { using type = T; };
+template<class T>
+using remove_const_t = typename remove_const<T>::type;
+
 /**
  * @brief is_floating_point
  */
@@ -63,4 +73,18 @@ template<>
 struct is_floating_point<double> : true_type {};
 template<>
 struct is_floating_point<long double> : true_type {};
+
+/**
+ * @brief is_trivially_copyable, from the compiler intrinsic
+ */
+template<typename T>
+struct is_trivially_copyable : integral_constant<bool, __is_trivially_copyable(T)> {};
+
+/**
+ * @brief compute_type, the arithmetic type of a storage type, float for the storage only Half and BFloat16
+ */
+template<typename T>
+struct compute_type { using type = T; };
+template<typename T>
+using compute_type_t = typename compute_type<T>::type;
 }; // namespace tinyso3
\ No newline at end of file
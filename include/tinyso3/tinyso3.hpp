@@ -13,4 +13,27 @@
 #include "AxisAngle.hpp"
 #include "Quaternion.hpp"
 #include "AngularVelocity.hpp"
-#include "EulerRate.hpp"
\ No newline at end of file
+#include "EulerRate.hpp"
+#include "RotationMatrixInterpolator.hpp"
+#include "QuaternionHermite.hpp"
+#include "QuaternionResampler.hpp"
+#include "AttitudeIntegrator.hpp"
+#include "ConingAccumulator.hpp"
+#include "RotationPreintegration.hpp"
+#include "RotationSolver.hpp"
+#include "RigidBodyDynamics.hpp"
+#include "MatrixMap.hpp"
+#include "Vector3Map.hpp"
+#include "QuaternionMap.hpp"
+#include "QuaternionCodec.hpp"
+#include "RotationGrid.hpp"
+#include "RotationTree.hpp"
+#include "RotationHashSet.hpp"
+#include "Reduction.hpp"
+#include "RotationStatistics.hpp"
+#include "Half.hpp"
+#include "BFloat16.hpp"
+#include "RotationMatrixBatch.hpp"
+#include "AttitudeLog.hpp"
+#include "TextFormat.hpp"
+#include "CsvReader.hpp"
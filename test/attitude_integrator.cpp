@@ -0,0 +1,121 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "trajectory.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const Trajectory trajectory{1.3, -0.7};
+
+template<typename Scheme, typename QuaternionConvention = HAMILTON>
+double finalError(size_t steps) {
+    const AttitudeIntegrator<Scheme, QuaternionConvention, double> integrator;
+    const double dt = 1.0 / static_cast<double>(steps);
+    Quaternion<QuaternionConvention, double> q = trajectory.attitude<QuaternionConvention>(0.0);
+
+    for(size_t k = 0; k < steps; k++) {
+        const double t = static_cast<double>(k) * dt;
+        q = integrator.step(q, trajectory.angularVelocity(t), trajectory.angularVelocity(t + dt / 2.0), trajectory.angularVelocity(t + dt), dt);
+    }
+
+    return q.boxminus(trajectory.attitude<QuaternionConvention>(1.0)).norm();
+}
+
+template<size_t N, typename Type>
+double distance(const Vector<N, Type>& v1, const Vector<N, Type>& v2) {
+    return static_cast<double>((v1 - v2).norm());
+}
+} // namespace
+
+TEST_CASE("AttitudeIntegrator") {
+    SECTION("Constant angular velocity") {
+        const AngularVelocity<double> w{0.3, -1.2, 2.1};
+        const Quaternion<HAMILTON, double> q0 = trajectory.attitude<HAMILTON>(0.3);
+        const Quaternion<HAMILTON, double> expected = q0.boxplus(w);
+
+        Quaternion<HAMILTON, double> q_exp = q0, q_rk4 = q0, q_magnus = q0;
+        for(size_t k = 0; k < 100; k++) {
+            q_exp = AttitudeIntegrator<EXPONENTIAL, HAMILTON, double>{}.step(q_exp, w, w, 0.01);
+            q_rk4 = AttitudeIntegrator<RK4, HAMILTON, double>{}.step(q_rk4, w, w, 0.01);
+            q_magnus = AttitudeIntegrator<MAGNUS4, HAMILTON, double>{}.step(q_magnus, w, w, 0.01);
+        }
+
+        REQUIRE(q_exp.boxminus(expected).norm() < 1e-12);
+        REQUIRE(q_rk4.boxminus(expected).norm() < 1e-9);
+        REQUIRE(q_magnus.boxminus(expected).norm() < 1e-12);
+    }
+
+    SECTION("Order of accuracy") {
+        const double exp_coarse = finalError<EXPONENTIAL>(50);
+        const double exp_fine = finalError<EXPONENTIAL>(100);
+        const double rk4_coarse = finalError<RK4>(50);
+        const double rk4_fine = finalError<RK4>(100);
+        const double magnus_coarse = finalError<MAGNUS4>(50);
+        const double magnus_fine = finalError<MAGNUS4>(100);
+
+        REQUIRE_THAT(exp_coarse / exp_fine, Catch::Matchers::WithinAbs(4.0, 0.5));
+        REQUIRE(rk4_coarse / rk4_fine > 12.0);
+        REQUIRE(magnus_coarse / magnus_fine > 12.0);
+        REQUIRE(magnus_fine < exp_fine / 100.0);
+        REQUIRE(rk4_fine < exp_fine / 100.0);
+
+        const double magnus_jpl = finalError<MAGNUS4, JPL>(100);
+        const double rk4_jpl = finalError<RK4, JPL>(100);
+        REQUIRE_THAT(magnus_jpl, Catch::Matchers::WithinRel(magnus_fine, 1e-3));
+        REQUIRE_THAT(rk4_jpl, Catch::Matchers::WithinRel(rk4_fine, 1e-3));
+    }
+
+    SECTION("Coning correction with linear angular velocity") {
+        // With w0 = w1 the coning term vanishes, with w0 != w1 MAGNUS4 adds dt^2 / 12 * (w0 x w1).
+        const AngularVelocity<double> w0{1.0, 0.0, 0.0};
+        const AngularVelocity<double> w1{0.0, 1.0, 0.0};
+        const double dt = 0.1;
+        const Quaternion<HAMILTON, double> q = AttitudeIntegrator<MAGNUS4, HAMILTON, double>{}.step(Quaternion<HAMILTON, double>{}, w0, w1, dt);
+        const Vector3<double> phi = (w0 + w1) * (dt / 2.0) + w0.cross(w1) * (dt * dt / 12.0);
+        REQUIRE(distance(q.boxminus(Quaternion<HAMILTON, double>{}), phi) < 1e-12);
+    }
+
+    SECTION("Batch and lazy renormalization") {
+        const size_t N = 7;
+        float w[N], x[N], y[N], z[N];
+        float wx[N], wy[N], wz[N];
+        Quaternion<JPL, float> reference[N];
+
+        for(size_t i = 0; i < N; i++) {
+            const float s = static_cast<float>(i);
+            reference[i] = Quaternion<JPL, float>::Exp(Vector3<float>{0.1f * s, -0.2f, 0.05f * s});
+            w[i] = reference[i].w();
+            x[i] = reference[i].x();
+            y[i] = reference[i].y();
+            z[i] = reference[i].z();
+            wx[i] = 2.0f - s;
+            wy[i] = 0.5f * s;
+            wz[i] = 1.0f;
+        }
+
+        const QuaternionBatch<JPL, float> batch{w, x, y, z, N};
+        const Vector3Batch<float> rates{wx, wy, wz, N};
+        const AttitudeIntegrator<RK4, JPL, float> integrator;
+
+        for(size_t k = 0; k < 2000; k++) {
+            integrator.step(batch, rates, rates, 0.001f);
+            for(size_t i = 0; i < N; i++) {
+                reference[i] = integrator.step(reference[i], AngularVelocity<float>{rates[i]}, AngularVelocity<float>{rates[i]}, 0.001f);
+            }
+        }
+
+        for(size_t i = 0; i < N; i++) {
+            REQUIRE(distance(batch[i], reference[i]) == 0.0);
+            REQUIRE_THAT(batch[i].norm(), Catch::Matchers::WithinAbs(1.0f, 1e-4f));
+        }
+
+        // Renormalization is skipped within the tolerance.
+        const Quaternion<HAMILTON, double> unit{};
+        const Quaternion<HAMILTON, double> drifted{Vector<4, double>{1.01, 0.0, 0.0, 0.0}};
+        const AttitudeIntegrator<MAGNUS4, HAMILTON, double> integrator_d{};
+        REQUIRE(distance(integrator_d.renormalize(unit), unit) == 0.0);
+        REQUIRE_THAT(integrator_d.renormalize(drifted).norm(), Catch::Matchers::WithinAbs(1.0, 1e-3));
+    }
+}
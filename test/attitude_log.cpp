@@ -0,0 +1,208 @@
+#include <tinyso3/tinyso3.hpp>
+#include <tinyso3/AttitudeLogFile.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <stdio.h>
+#include <string.h>
+
+using namespace tinyso3;
+
+namespace {
+// Appends into a fixed, 8 byte aligned buffer.
+struct MemorySink {
+    unsigned char* buffer;
+    size_t capacity;
+    size_t* size;
+
+    bool operator()(const void* data, size_t n) const {
+        if(*size + n > capacity) {
+            return false;
+        }
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for(size_t i = 0; i < n; i++) {
+            buffer[*size + i] = bytes[i];
+        }
+        *size += n;
+        return true;
+    }
+};
+
+alignas(8) unsigned char memory[1 << 16];
+
+template<typename QuaternionConvention>
+Quaternion<QuaternionConvention, float> attitude(size_t i) {
+    const float s = static_cast<float>(i);
+    return Quaternion<QuaternionConvention, float>{}.boxplus(Vector3<float>{0.01f * s, -0.02f * s, 0.5f});
+}
+} // namespace
+
+TEST_CASE("AttitudeLog") {
+    size_t size = 0;
+    const MemorySink sink{memory, sizeof(memory), &size};
+    AttitudeLogIndexEntry index[16];
+
+    SECTION("Quaternion round trip") {
+        AttitudeLogWriter<JPL, float, MemorySink, 8> writer{sink, index, 16};
+        for(size_t i = 0; i < 20; i++) {
+            REQUIRE(writer.append(0.1 * static_cast<double>(i), attitude<JPL>(i)));
+        }
+        REQUIRE(writer.chunks() == 2);
+        REQUIRE(writer.pending() == 4);
+        REQUIRE(writer.close());
+        REQUIRE_FALSE(writer.append(9.0, attitude<JPL>(0)));
+        REQUIRE(writer.bytes() == size);
+
+        const AttitudeLogReader reader{memory, size};
+        REQUIRE(reader.valid());
+        REQUIRE(reader.chunks() == 3);
+        REQUIRE(reader.records() == 20);
+        REQUIRE(reader.holds<JPL, float>());
+        REQUIRE_FALSE(reader.holds<HAMILTON, float>());
+        REQUIRE_FALSE(reader.holds<JPL, double>());
+
+        size_t i = 0;
+        for(size_t chunk = 0; chunk < reader.chunks(); chunk++) {
+            const double* t = reader.timestamps(chunk);
+            const QuaternionBatch<JPL, const float> q = reader.quaternions<JPL, float>(chunk);
+            REQUIRE(q.size() == (chunk < 2 ? 8 : 4));
+            for(size_t k = 0; k < q.size(); k++, i++) {
+                REQUIRE(t[k] == 0.1 * static_cast<double>(i));
+                REQUIRE((Vector<4, float>{q[k]} - Vector<4, float>{attitude<JPL>(i)}).abs().max() == 0.f);
+            }
+        }
+
+        // Views point into the log, without copying.
+        REQUIRE(reinterpret_cast<const unsigned char*>(reader.timestamps(0)) == memory + sizeof(AttitudeLogHeader) + sizeof(AttitudeLogChunkHeader));
+
+        REQUIRE(reader.find(-1.0) == 0);
+        REQUIRE(reader.find(0.75) == 1);
+        REQUIRE(reader.find(0.8) == 1);
+        REQUIRE(reader.find(1.55) == 2);
+        REQUIRE(reader.find(100.0) == 3);
+    }
+
+    SECTION("Rotation matrix batches") {
+        double elements[9][5];
+        double* pointers[9];
+        for(size_t k = 0; k < 9; k++) {
+            pointers[k] = elements[k];
+        }
+        const RotationMatrixBatch<PASSIVE, double> batch{pointers, 5};
+        double timestamps[5];
+        for(size_t i = 0; i < 5; i++) {
+            batch.set(i, RotationMatrix<PASSIVE, double>::Exp(Vector3<double>{0.1, 0.2 * static_cast<double>(i), -0.3}.hat()));
+            timestamps[i] = static_cast<double>(i);
+        }
+
+        AttitudeLogWriter<PASSIVE, double, MemorySink, 3> writer{sink, index, 16};
+        REQUIRE(writer.append(timestamps, batch));
+        REQUIRE(writer.append(timestamps, batch));
+        REQUIRE(writer.chunks() == 3);
+        REQUIRE(writer.close());
+
+        const AttitudeLogReader reader{memory, size};
+        REQUIRE(reader.valid());
+        REQUIRE(reader.holds<PASSIVE, double>());
+        REQUIRE(reader.chunks() == 4);
+        REQUIRE(reader.records() == 10);
+
+        const RotationMatrixBatch<PASSIVE, const double> chunk = reader.rotationMatrices<PASSIVE, double>(1);
+        REQUIRE(chunk.size() == 3);
+        REQUIRE((chunk[0] - batch[3]).abs().max() == 0.0);
+        REQUIRE((chunk[2] - batch[0]).abs().max() == 0.0);
+    }
+
+    SECTION("Invalid logs") {
+        AttitudeLogWriter<HAMILTON, double, MemorySink, 4> writer{sink, index, 2};
+        for(size_t i = 0; i < 8; i++) {
+            REQUIRE(writer.append(static_cast<double>(i), Quaternion<HAMILTON, double>{}));
+        }
+        // The index holds two chunks only.
+        REQUIRE_FALSE(writer.append(8.0, Quaternion<HAMILTON, double>{}));
+        REQUIRE(writer.chunks() == 2);
+
+        // Not closed yet, there is no footer.
+        REQUIRE_FALSE(AttitudeLogReader(memory, size).valid());
+
+        size_t closed = 0;
+        AttitudeLogWriter<HAMILTON, double, MemorySink, 4> empty{MemorySink{memory, sizeof(memory), &closed}, index, 2};
+        REQUIRE(empty.close());
+        const AttitudeLogReader reader{memory, closed};
+        REQUIRE(reader.valid());
+        REQUIRE(reader.chunks() == 0);
+        REQUIRE(reader.find(0.0) == 0);
+
+        memory[0] = 'X';
+        REQUIRE_FALSE(AttitudeLogReader(memory, closed).valid());
+    }
+
+    SECTION("Overflowing sizes") {
+        // header 32 | chunk header 32, 1 record of 40 bytes | index entry 88 | footer 120
+        auto log = [&]() {
+            size = 0;
+            AttitudeLogWriter<HAMILTON, double, MemorySink, 4> writer{sink, index, 2};
+            REQUIRE(writer.append(0.0, Quaternion<HAMILTON, double>{}));
+            REQUIRE(writer.close());
+            REQUIRE(size == 152);
+            REQUIRE(AttitudeLogReader(memory, size).valid());
+        };
+        auto patch = [](size_t offset, uint64_t value, size_t bytes) { memcpy(memory + offset, &value, bytes); };
+
+        // A chunk of 2^32 - 1 records, whose end wraps around to its beginning.
+        log();
+        patch(32 + 4, 0xFFFFFFFFu, 4);
+        patch(32 + 8, ~uint64_t(0) - 31, 8);
+        patch(88 + 8, 0xFFFFFFFFu, 8);
+        patch(120 + 16, 0xFFFFFFFFu, 8);
+        REQUIRE_FALSE(AttitudeLogReader(memory, size).valid());
+
+        // More records than the chunk holds.
+        log();
+        patch(32 + 4, 2, 4);
+        patch(88 + 8, 2, 8);
+        patch(120 + 16, 2, 8);
+        REQUIRE_FALSE(AttitudeLogReader(memory, size).valid());
+
+        // A chunk count whose index size wraps to the size of one entry.
+        log();
+        patch(120 + 8, (uint64_t(1) << 59) + 1, 8);
+        REQUIRE_FALSE(AttitudeLogReader(memory, size).valid());
+
+        // A chunk offset whose chunk header wraps around.
+        log();
+        patch(88, ~uint64_t(0) - 7, 8);
+        REQUIRE_FALSE(AttitudeLogReader(memory, size).valid());
+
+        // An index offset past the footer.
+        log();
+        patch(120, ~uint64_t(0) - 7, 8);
+        REQUIRE_FALSE(AttitudeLogReader(memory, size).valid());
+    }
+
+    SECTION("Memory mapped file") {
+        const char* path = "attitude_log_test.bin";
+        FILE* file = fopen(path, "wb");
+        REQUIRE(file != nullptr);
+
+        AttitudeLogWriter<HAMILTON, float, FileSink, 16> writer{FileSink{fileno(file)}, index, 16};
+        for(size_t i = 0; i < 100; i++) {
+            REQUIRE(writer.append(static_cast<double>(i), attitude<HAMILTON>(i)));
+        }
+        REQUIRE(writer.close());
+        fclose(file);
+
+        {
+            const MappedFile mapped{path};
+            REQUIRE(mapped.valid());
+            REQUIRE(mapped.size() == writer.bytes());
+
+            const AttitudeLogReader reader{mapped.data(), mapped.size()};
+            REQUIRE(reader.valid());
+            REQUIRE(reader.records() == 100);
+            const QuaternionBatch<HAMILTON, const float> q = reader.quaternions<HAMILTON, float>(6);
+            REQUIRE((Vector<4, float>{q[3]} - Vector<4, float>{attitude<HAMILTON>(99)}).abs().max() == 0.f);
+        }
+        remove(path);
+    }
+}
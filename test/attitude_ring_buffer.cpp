@@ -0,0 +1,119 @@
+#include <tinyso3/tinyso3.hpp>
+#include <tinyso3/AttitudeRingBuffer.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <atomic>
+#include <thread>
+
+#include "trajectory.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const Trajectory trajectory{1.3, -0.7};
+
+using Buffer = AttitudeRingBuffer<HAMILTON, double>;
+Buffer::Slot slots[64];
+} // namespace
+
+TEST_CASE("AttitudeRingBuffer") {
+    SECTION("Empty and out of range queries") {
+        Buffer buffer{slots, 64};
+        Quaternion<HAMILTON, double> q;
+        Buffer::Sample sample;
+        REQUIRE_FALSE(buffer.at(0.0, q));
+        REQUIRE_FALSE(buffer.latest(sample));
+        REQUIRE(buffer.size() == 0);
+
+        REQUIRE(buffer.push({1.0, trajectory.attitude(1.0), trajectory.angularVelocity(1.0)}));
+        REQUIRE(buffer.at(1.0, q));
+        REQUIRE(angularError(q, trajectory.attitude(1.0)) == 0.0);
+        REQUIRE_FALSE(buffer.at(0.999, q));
+        REQUIRE_FALSE(buffer.at(1.001, q));
+
+        // Timestamps must increase.
+        REQUIRE_FALSE(buffer.push({1.0, trajectory.attitude(1.0), trajectory.angularVelocity(1.0)}));
+        REQUIRE_FALSE(buffer.push({0.5, trajectory.attitude(0.5), trajectory.angularVelocity(0.5)}));
+        REQUIRE(buffer.pushed() == 1);
+    }
+
+    SECTION("Interpolation") {
+        const Interpolation interpolations[] = {Interpolation::SLERP, Interpolation::NLERP, Interpolation::HERMITE};
+        const double tolerances[] = {2e-4, 2e-4, 1e-7};
+        for(size_t m = 0; m < 3; m++) {
+            Buffer buffer{slots, 64, interpolations[m]};
+            for(size_t k = 0; k < 40; k++) {
+                const double t = 0.01 * static_cast<double>(k);
+                REQUIRE(buffer.push({t, trajectory.attitude(t), trajectory.angularVelocity(t)}));
+            }
+            REQUIRE(buffer.size() == 40);
+
+            double max_error = 0.0;
+            for(size_t k = 0; k <= 390; k++) {
+                const double t = 0.001 * static_cast<double>(k);
+                Quaternion<HAMILTON, double> q;
+                REQUIRE(buffer.at(t, q));
+                max_error = fmax(max_error, angularError(q, trajectory.attitude(t)));
+            }
+            REQUIRE(max_error < tolerances[m]);
+
+            // At the samples themselves, exactly or up to rounding.
+            Quaternion<HAMILTON, double> q;
+            REQUIRE(buffer.at(0.2, q));
+            REQUIRE(angularError(q, trajectory.attitude(0.2)) < 1e-12);
+        }
+    }
+
+    SECTION("Overwrites the oldest") {
+        Buffer buffer{slots, 64};
+        for(size_t k = 0; k < 100; k++) {
+            const double t = static_cast<double>(k);
+            REQUIRE(buffer.push({t, trajectory.attitude(t), trajectory.angularVelocity(t)}));
+        }
+        REQUIRE(buffer.size() == 64);
+        REQUIRE(buffer.pushed() == 100);
+
+        Quaternion<HAMILTON, double> q;
+        REQUIRE_FALSE(buffer.at(35.5, q));
+        REQUIRE(buffer.at(36.0, q));
+        REQUIRE(buffer.at(98.25, q));
+
+        Buffer::Sample sample;
+        REQUIRE(buffer.latest(sample));
+        REQUIRE(sample.time == 99.0);
+    }
+
+    SECTION("Concurrent producer and reader") {
+        static Buffer::Slot small[16];
+        Buffer buffer{small, 16};
+        const size_t count = 200000;
+        std::atomic<bool> done{false};
+
+        // Samples on a uniform rotation, so that any consistent interpolation is exact up to rounding.
+        auto uniform = [](double t) { return Quaternion<HAMILTON, double>::Exp(Vector3<double>{0.3, -0.2, 0.5} * t); };
+        std::thread producer([&] {
+            for(size_t k = 0; k < count; k++) {
+                const double t = 1e-3 * static_cast<double>(k);
+                buffer.push({t, uniform(t), AngularVelocity<double>{0.6, -0.4, 1.0}});
+            }
+            done.store(true);
+        });
+
+        size_t worst = 0;
+        while(!done.load()) {
+            Buffer::Sample newest;
+            if(!buffer.latest(newest)) {
+                continue;
+            }
+            const double t = newest.time - 4.5e-3;
+            Quaternion<HAMILTON, double> q;
+            if(buffer.at(t, q)) {
+                worst += angularError(q, uniform(t)) > 1e-9 ? 1u : 0u;
+            }
+        }
+        producer.join();
+
+        REQUIRE(worst == 0);
+        REQUIRE(buffer.pushed() == count);
+    }
+}
@@ -67,4 +67,18 @@ TEST_CASE("AxisAngle") {
         REQUIRE(fabs(axis(2) - 0.0f) < 1e-4f);
         REQUIRE(fabs(angle - 0.2f) < 1e-4f);
     }
-}
\ No newline at end of file
+
+    SECTION("Small angles and angles near pi") {
+        const Vector3<double> axis = Vector3<double>{0.3, -0.4, 0.5}.unit();
+        const double angles[] = {1e-7, 1e-3, 3.14159, M_PI - 1e-9};
+        for(double angle : angles) {
+            const AxisAngle<double> expected{axis, angle};
+            const AxisAngle<double> from_active{RotationMatrix<ACTIVE, double>{expected}};
+            const AxisAngle<double> from_passive{RotationMatrix<PASSIVE, double>{expected}};
+            const AxisAngle<double> from_jpl{Quaternion<JPL, double>{expected}};
+            REQUIRE((Vector3<double>{from_active} - expected).norm() < 1e-12);
+            REQUIRE((Vector3<double>{from_passive} - expected).norm() < 1e-12);
+            REQUIRE((Vector3<double>{from_jpl} - expected).norm() < 1e-12);
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "trajectory.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const Trajectory trajectory{2.1, -3.3};
+
+// Propagates through one second, 10 attitude updates of 8 samples each.
+double finalError(bool compensate) {
+    ConingAccumulator<double> accumulator;
+    Quaternion<HAMILTON, double> q = trajectory.attitude(0.0);
+    const double dt = 1.0 / 80.0;
+
+    for(size_t k = 0; k < 80; k++) {
+        const double t = static_cast<double>(k) * dt;
+        accumulator.push(trajectory.deltaAngle(t, t + dt));
+
+        if(accumulator.count() == 8) {
+            q = compensate ? q * accumulator.quaternion<HAMILTON>() : q * Quaternion<HAMILTON, double>::Exp(trajectory.deltaAngle(t + dt - 8.0 * dt, t + dt) / 2.0);
+            accumulator.reset();
+        }
+    }
+
+    return q.boxminus(trajectory.attitude(1.0)).norm();
+}
+} // namespace
+
+TEST_CASE("ConingAccumulator") {
+    SECTION("Coning compensation") {
+        const double compensated = finalError(true);
+        const double uncompensated = finalError(false);
+
+        REQUIRE(compensated < 5e-4);
+        REQUIRE(compensated < uncompensated / 100.0);
+    }
+
+    SECTION("Increments in every convention") {
+        ConingAccumulator<double> accumulator;
+        accumulator.push(Vector3<double>{0.01, 0.0, 0.0});
+        accumulator.push(Vector3<double>{0.0, 0.02, 0.0});
+        accumulator.push(Vector3<double>{0.0, 0.0, -0.01});
+
+        const Vector3<double> phi = accumulator.rotationVector();
+        const Quaternion<HAMILTON, double> q_h = Quaternion<HAMILTON, double>{}.boxplus(phi);
+        const Quaternion<JPL, double> q_j = Quaternion<JPL, double>{}.boxplus(phi);
+
+        REQUIRE((Vector<4, double>{accumulator.quaternion<HAMILTON>()} - Vector<4, double>{q_h}).norm() < 1e-15);
+        REQUIRE((Vector<4, double>{accumulator.quaternion<JPL>()} - Vector<4, double>{q_j}).norm() < 1e-15);
+        REQUIRE((accumulator.rotationMatrix<ACTIVE>() - RotationMatrix<ACTIVE, double>{q_h}).abs().max() < 1e-12);
+        REQUIRE((accumulator.rotationMatrix<PASSIVE>() - accumulator.rotationMatrix<ACTIVE>().T()).abs().max() < 1e-15);
+    }
+
+    SECTION("Two increments") {
+        // phi = d_theta_1 + d_theta_2 + 1/2 * (d_theta_1 + 1/6 * d_theta_1) x d_theta_2, an x then y rotation cones towards +z.
+        const Vector3<double> d_theta_1{0.01, 0.0, 0.0};
+        const Vector3<double> d_theta_2{0.0, 0.02, 0.0};
+        ConingAccumulator<double> accumulator;
+        accumulator.push(d_theta_1);
+        accumulator.push(d_theta_2);
+
+        const Vector3<double> phi = accumulator.rotationVector();
+        REQUIRE_THAT(phi.x(), Catch::Matchers::WithinAbs(0.01, 1e-15));
+        REQUIRE_THAT(phi.y(), Catch::Matchers::WithinAbs(0.02, 1e-15));
+        REQUIRE_THAT(phi.z(), Catch::Matchers::WithinAbs(7.0 / 12.0 * 0.01 * 0.02, 1e-15));
+    }
+
+    SECTION("Sculling compensation") {
+        // Constant rotation about z and constant body frame specific force along x.
+        const double w = 5.0;
+        const double dt = 0.001;
+        const size_t N = 10;
+        const double T = dt * static_cast<double>(N);
+        const Vector3<double> truth{sin(w * T) / w, (1.0 - cos(w * T)) / w, 0.0};
+
+        ConingAccumulator<double> accumulator;
+        for(size_t k = 0; k < N; k++) {
+            accumulator.push(Vector3<double>{0.0, 0.0, w * dt}, Vector3<double>{dt, 0.0, 0.0});
+        }
+
+        const double compensated = (accumulator.velocityIncrement() - truth).norm();
+        const double uncompensated = (Vector3<double>{T, 0.0, 0.0} - truth).norm();
+        REQUIRE(compensated < uncompensated / 10.0);
+
+        accumulator.reset();
+        REQUIRE(accumulator.count() == 0);
+        REQUIRE(accumulator.velocityIncrement().norm() == 0.0);
+    }
+}
@@ -0,0 +1,95 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <string.h>
+
+using namespace tinyso3;
+
+TEST_CASE("CsvReader QuaternionBatch") {
+    const char* text = "t,w,x,y,z\r\n"
+                       "0.0, 1, 0, 0, 0\r\n"
+                       "# comment\n"
+                       "\n"
+                       "0.5,0.5,-0.5,0.5,-0.5  \n"
+                       "1.0,0,1,0,";
+    const size_t size = strlen(text);
+
+    double w[4], x[4], y[4], z[4], t[4];
+    QuaternionBatch<HAMILTON, double> batch{w, x, y, z, 4};
+    CsvReader<double> reader;
+
+    // Only complete lines are consumed.
+    size_t consumed = reader.read(text, size, batch, t);
+    CHECK(reader.records() == 2);
+    CHECK_FALSE(reader.failed());
+    CHECK(reader.line() == 5);
+    CHECK(text[consumed] == '1');
+    CHECK((w[0] == 1.0 && x[0] == 0.0 && y[0] == 0.0 && z[0] == 0.0));
+    CHECK((w[1] == 0.5 && x[1] == -0.5 && y[1] == 0.5 && z[1] == -0.5));
+    CHECK((t[0] == 0.0 && t[1] == 0.5));
+
+    // The rest, completed by the next piece.
+    char rest[32];
+    const size_t remaining = size - consumed;
+    memcpy(rest, text + consumed, remaining);
+    memcpy(rest + remaining, "0\n", 2);
+    CHECK(reader.read(rest, remaining + 2, batch, t) == remaining + 2);
+    CHECK(reader.records() == 1);
+    CHECK((w[0] == 0.0 && x[0] == 1.0 && y[0] == 0.0 && z[0] == 0.0));
+    CHECK(t[0] == 1.0);
+
+    // The final line without a line break.
+    CHECK(reader.read(text + consumed, remaining, batch, t, true) == 0);
+    CHECK(reader.failed());
+    CHECK(reader.read("2,0,0,0,1", 9, batch, t, true) == 9);
+    CHECK((reader.records() == 1 && batch[0].z() == 1.0 && t[0] == 2.0));
+}
+
+TEST_CASE("CsvReader arrays") {
+    const char* text = "0.1;0.2;0.3\n"
+                       "nan;0;0\n"
+                       "1;2;3\n";
+    const size_t size = strlen(text);
+
+    Euler<INTRINSIC, ZYX, float> euler[2];
+    CsvReader<float> reader{';'};
+    const size_t consumed = reader.read(text, size, euler, 2);
+    CHECK(reader.records() == 2);
+    CHECK(text[consumed] == '1'); // capacity reached
+    CHECK((euler[0](0) == 0.1f && euler[0](1) == 0.2f && euler[0](2) == 0.3f));
+    CHECK(euler[1](0) != euler[1](0));
+
+    RotationMatrix<ACTIVE, double> dcm[1];
+    CsvReader<double> matrix_reader;
+    const char* identity = "1,0,0,0,1,0,0,0,1\n";
+    CHECK(matrix_reader.read(identity, strlen(identity), dcm, 1) == strlen(identity));
+    CHECK((dcm[0](0, 0) == 1.0 && dcm[0](1, 1) == 1.0 && dcm[0](2, 2) == 1.0 && dcm[0](0, 1) == 0.0));
+
+    double xs[2], ys[2], zs[2];
+    Vector3Batch<double> vectors{xs, ys, zs, 2};
+    const char* vector_text = "1,2,3\n4,5,6\n";
+    CHECK(matrix_reader.read(vector_text, strlen(vector_text), vectors) == strlen(vector_text));
+    CHECK((xs[1] == 4.0 && ys[1] == 5.0 && zs[1] == 6.0));
+}
+
+TEST_CASE("CsvReader malformed") {
+    const char* text = "1,0,0,0\n"
+                       "1,0,0\n"
+                       "1,0,0,0\n";
+    Quaternion<JPL, double> q[3];
+    CsvReader<double> reader;
+    const size_t consumed = reader.read(text, strlen(text), q, 3);
+    CHECK(reader.failed());
+    CHECK(reader.records() == 1);
+    CHECK(reader.line() == 1);
+    CHECK(consumed == 8);
+
+    const char* trailing = "1,0,0,0 x\n";
+    CHECK(reader.read(trailing, strlen(trailing), q, 3) == 0);
+    CHECK(reader.failed());
+
+    const char* missing = "0.5\n";
+    double t[1];
+    CHECK(reader.read(missing, strlen(missing), q, 1, t) == 0);
+    CHECK(reader.failed());
+}
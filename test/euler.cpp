@@ -296,4 +296,20 @@ TEST_CASE("Euler") {
         REQUIRE(fabs(euler_zyz_singular_p_pi_0(i) - euler_zyz_singular_p_pi_0_passive(i)) < 1e-4f);
         REQUIRE(fabs(euler_zyz_singular_p_pi_1(i) - euler_zyz_singular_p_pi_1_passive(i)) < 1e-4f);
     };
-}
\ No newline at end of file
+
+    // Extrinsic angles recovered from rotation matrices and quaternions
+    Euler<EXTRINSIC, ZYX, float> euler_extrinsic_zyx(0.3f, -0.5f, 0.7f);
+    Euler<EXTRINSIC, ZXZ, float> euler_extrinsic_zxz(0.3f, 0.5f, 0.7f);
+    Euler<EXTRINSIC, ZYX, float> euler_extrinsic_zyx_active(RotationMatrix<ACTIVE, float>{euler_extrinsic_zyx});
+    Euler<EXTRINSIC, ZYX, float> euler_extrinsic_zyx_passive(RotationMatrix<PASSIVE, float>{euler_extrinsic_zyx});
+    Euler<EXTRINSIC, ZYX, float> euler_extrinsic_zyx_jpl(Quaternion<JPL, float>{euler_extrinsic_zyx});
+    Euler<EXTRINSIC, ZXZ, float> euler_extrinsic_zxz_active(RotationMatrix<ACTIVE, float>{euler_extrinsic_zxz});
+    Euler<EXTRINSIC, ZXZ, float> euler_extrinsic_zxz_hamilton(Quaternion<HAMILTON, float>{euler_extrinsic_zxz});
+    for(size_t i = 0; i < 3; i++) {
+        REQUIRE(fabs(euler_extrinsic_zyx(i) - euler_extrinsic_zyx_active(i)) < 1e-4f);
+        REQUIRE(fabs(euler_extrinsic_zyx(i) - euler_extrinsic_zyx_passive(i)) < 1e-4f);
+        REQUIRE(fabs(euler_extrinsic_zyx(i) - euler_extrinsic_zyx_jpl(i)) < 1e-4f);
+        REQUIRE(fabs(euler_extrinsic_zxz(i) - euler_extrinsic_zxz_active(i)) < 1e-4f);
+        REQUIRE(fabs(euler_extrinsic_zxz(i) - euler_extrinsic_zxz_hamilton(i)) < 1e-4f);
+    }
+}
@@ -25,4 +25,66 @@ TEST_CASE("EulerRate") {
     REQUIRE(fabs(euler_rate(0U) - euler_rate_comp(0U)) < 1e-4f);
     REQUIRE(fabs(euler_rate(1U) - euler_rate_comp(1U)) < 1e-4f);
     REQUIRE(fabs(euler_rate(2U) - euler_rate_comp(2U)) < 1e-4f);
-}
\ No newline at end of file
+}
+namespace {
+// Body frame angular velocity from central differences of the ACTIVE rotation matrix.
+template<typename EulerConvention, typename EulerSequence>
+Vector3<double> numericalAngularVelocity(const Euler<EulerConvention, EulerSequence, double>& euler, const EulerRate<EulerConvention, EulerSequence, double>& euler_rate) {
+    const double h = 1e-6;
+    const RotationMatrix<ACTIVE, double> before{Euler<EulerConvention, EulerSequence, double>{euler - euler_rate * h}};
+    const RotationMatrix<ACTIVE, double> after{Euler<EulerConvention, EulerSequence, double>{euler + euler_rate * h}};
+    return (before.T() * after).log().vee() / (2.0 * h);
+}
+
+template<typename EulerConvention, typename EulerSequence>
+void checkSequence() {
+    const size_t N = 4;
+    Euler<EulerConvention, EulerSequence, double> euler[N];
+    EulerRate<EulerConvention, EulerSequence, double> euler_rate[N];
+    AngularVelocity<double> angular_velocity[N];
+    EulerRate<EulerConvention, EulerSequence, double> recovered[N];
+
+    for(size_t i = 0; i < N; i++) {
+        const double s = static_cast<double>(i);
+        euler[i] = Euler<EulerConvention, EulerSequence, double>{0.3 - 0.2 * s, 0.4 + 0.1 * s, -0.5 + 0.3 * s};
+        euler_rate[i] = EulerRate<EulerConvention, EulerSequence, double>{0.7, -0.2 * s, 1.1};
+    }
+
+    AngularVelocity<double>::FromEulerRates(euler, euler_rate, angular_velocity, N);
+    EulerRate<EulerConvention, EulerSequence, double>::FromAngularVelocities(euler, angular_velocity, recovered, N);
+
+    for(size_t i = 0; i < N; i++) {
+        REQUIRE((angular_velocity[i] - numericalAngularVelocity(euler[i], euler_rate[i])).norm() < 1e-7);
+        REQUIRE((recovered[i] - euler_rate[i]).norm() < 1e-12);
+
+        const EulerRate<EulerConvention, EulerSequence, double> from_dcm{RotationMatrix<PASSIVE, double>{euler[i]}, angular_velocity[i]};
+        REQUIRE((from_dcm - euler_rate[i]).norm() < 1e-10);
+    }
+}
+
+template<typename EulerConvention>
+void checkConvention() {
+    checkSequence<EulerConvention, XYZ>();
+    checkSequence<EulerConvention, XZY>();
+    checkSequence<EulerConvention, YXZ>();
+    checkSequence<EulerConvention, YZX>();
+    checkSequence<EulerConvention, ZXY>();
+    checkSequence<EulerConvention, ZYX>();
+    checkSequence<EulerConvention, XYX>();
+    checkSequence<EulerConvention, XZX>();
+    checkSequence<EulerConvention, YXY>();
+    checkSequence<EulerConvention, YZY>();
+    checkSequence<EulerConvention, ZXZ>();
+    checkSequence<EulerConvention, ZYZ>();
+}
+} // namespace
+
+TEST_CASE("EulerRate, all sequences") {
+    SECTION("INTRINSIC") {
+        checkConvention<INTRINSIC>();
+    }
+
+    SECTION("EXTRINSIC") {
+        checkConvention<EXTRINSIC>();
+    }
+}
@@ -0,0 +1,134 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace tinyso3;
+
+namespace {
+float fromBits(uint32_t bits) {
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+uint32_t toBits(float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+} // namespace
+
+TEST_CASE("Half") {
+    SECTION("Round trip of every half") {
+        for(uint32_t bits = 0; bits < 0x10000u; bits++) {
+            const Half h = Half::FromBits(static_cast<uint16_t>(bits));
+            const float f = h;
+            if(f != f) {
+                REQUIRE((bits & 0x7C00u) == 0x7C00u);
+                REQUIRE((bits & 0x3FFu) != 0);
+                REQUIRE((Half(f).bits() & 0x7FFFu) > 0x7C00u);
+                continue;
+            }
+            REQUIRE(Half(f).bits() == bits);
+        }
+    }
+
+    SECTION("Values") {
+        REQUIRE(Half(1.0f).bits() == 0x3C00u);
+        REQUIRE(Half(-2.0f).bits() == 0xC000u);
+        REQUIRE(Half(65504.0f).bits() == 0x7BFFu);
+        REQUIRE(Half(0.0f).bits() == 0x0000u);
+        REQUIRE(Half(-0.0f).bits() == 0x8000u);
+        REQUIRE(float(Half::FromBits(0x0001u)) == 5.9604644775390625e-8f);
+        REQUIRE(float(Half::FromBits(0x0400u)) == 6.103515625e-5f);
+    }
+
+    SECTION("Round to nearest even") {
+        // 1 + 2^-11 is halfway between 1 and 1 + 2^-10, rounds to the even 1.
+        REQUIRE(Half(1.0f + 0.00048828125f).bits() == 0x3C00u);
+        // 1 + 3 * 2^-11 is halfway between 1 + 2^-10 and 1 + 2^-9, rounds to the even 1 + 2^-9.
+        REQUIRE(Half(1.0f + 3.0f * 0.00048828125f).bits() == 0x3C02u);
+        // Just above halfway rounds up.
+        REQUIRE(Half(fromBits(toBits(1.0f + 0.00048828125f) + 1u)).bits() == 0x3C01u);
+
+        // Subnormals, half of the smallest rounds to zero, just above to the smallest.
+        REQUIRE(Half(2.98023223876953125e-8f).bits() == 0x0000u);
+        REQUIRE(Half(fromBits(toBits(2.98023223876953125e-8f) + 1u)).bits() == 0x0001u);
+        REQUIRE(Half(3.0f * 2.98023223876953125e-8f).bits() == 0x0002u);
+        // The largest subnormal rounds up into the smallest normal.
+        REQUIRE(Half(6.103515625e-5f - 2.98023223876953125e-8f / 2.0f).bits() == 0x0400u);
+    }
+
+    SECTION("Overflow and special values") {
+        REQUIRE(Half(65519.0f).bits() == 0x7BFFu);
+        REQUIRE(Half(65520.0f).bits() == 0x7C00u);
+        REQUIRE(Half(-1e10f).bits() == 0xFC00u);
+        REQUIRE(Half(fromBits(0x7F800000u)).bits() == 0x7C00u);
+        REQUIRE(Half(fromBits(0x7FC00000u)).bits() == 0x7E00u);
+        REQUIRE((Half(fromBits(0x7F800001u)).bits() & 0x7FFFu) > 0x7C00u);
+    }
+
+    SECTION("Array conversion matches scalar") {
+        float in[37];
+        Half half[37];
+        float out[37];
+        for(size_t i = 0; i < 37; i++) {
+            in[i] = (static_cast<float>(i) - 18.0f) * 1.37f + 1e-5f * static_cast<float>(i);
+        }
+        in[3] = fromBits(0x7FC00000u);
+        in[5] = 1e9f;
+        in[7] = 3e-7f;
+        Half::Narrow(in, half, 37);
+        Half::Widen(half, out, 37);
+        for(size_t i = 0; i < 37; i++) {
+            REQUIRE(half[i].bits() == Half(in[i]).bits());
+            REQUIRE(toBits(out[i]) == toBits(float(half[i])));
+        }
+    }
+
+    SECTION("Quaternion batch") {
+        Half w[16], x[16], y[16], z[16];
+        const QuaternionBatch<HAMILTON, Half> batch{w, x, y, z, 16};
+        for(size_t i = 0; i < 16; i++) {
+            const float angle = 0.4f * static_cast<float>(i);
+            const Quaternion<HAMILTON, float> q{AxisAngle<float>{Vector3<float>{0.6f, -0.48f, 0.64f}, angle}};
+            batch.set(i, q);
+
+            const Quaternion<HAMILTON, float> p = QuaternionBatch<HAMILTON, const Half>{batch}[i];
+            REQUIRE(fabs(p.w() - q.w()) <= 4.9e-4f);
+            REQUIRE(fabs(p.x() - q.x()) <= 4.9e-4f);
+            REQUIRE(fabs(p.y() - q.y()) <= 4.9e-4f);
+            REQUIRE(fabs(p.z() - q.z()) <= 4.9e-4f);
+        }
+    }
+}
+
+TEST_CASE("BFloat16") {
+    SECTION("Round trip of every bfloat16") {
+        for(uint32_t bits = 0; bits < 0x10000u; bits++) {
+            const float f = BFloat16::FromBits(static_cast<uint16_t>(bits));
+            REQUIRE(toBits(f) == bits << 16);
+            if(f == f) {
+                REQUIRE(BFloat16(f).bits() == bits);
+            }
+        }
+    }
+
+    SECTION("Round to nearest even") {
+        REQUIRE(BFloat16(1.0f).bits() == 0x3F80u);
+        REQUIRE(BFloat16(fromBits(0x3F808000u)).bits() == 0x3F80u);
+        REQUIRE(BFloat16(fromBits(0x3F818000u)).bits() == 0x3F82u);
+        REQUIRE(BFloat16(fromBits(0x3F808001u)).bits() == 0x3F81u);
+        REQUIRE(BFloat16(fromBits(0x7F7FFFFFu)).bits() == 0x7F80u);
+        REQUIRE((BFloat16(fromBits(0x7F800001u)).bits() & 0x7FFFu) > 0x7F80u);
+    }
+
+    SECTION("Vector batch") {
+        BFloat16 x[4], y[4], z[4];
+        const Vector3Batch<BFloat16> batch{x, y, z, 4};
+        batch.set(2, Vector3<float>{0.1f, -0.7f, 3.0f});
+        const Vector3<float> v = batch[2];
+        REQUIRE(fabs(v(0) - 0.1f) <= 0.1f * 3.9e-3f);
+        REQUIRE(fabs(v(1) + 0.7f) <= 0.7f * 3.9e-3f);
+        REQUIRE(v(2) == 3.0f);
+    }
+}
@@ -0,0 +1,94 @@
+#include <tinyso3/tinyso3.hpp>
+#include <tinyso3/LatestAttitude.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace tinyso3;
+
+namespace {
+// Every element holds the same value, so a value mixed from two stores is detected.
+struct Stamped {
+    double time;
+    RotationMatrix<ACTIVE, double> rotation;
+};
+
+Stamped stamped(size_t k) {
+    const double v = static_cast<double>(k);
+    return Stamped{v, RotationMatrix<ACTIVE, double>{SquareMatrix<3, double>{v}}};
+}
+
+bool consistent(const Stamped& s) {
+    for(size_t i = 0; i < 3; i++) {
+        for(size_t j = 0; j < 3; j++) {
+            if(s.rotation(i, j) != s.time) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("LatestAttitude") {
+    SECTION("Store and load") {
+        LatestAttitude<Quaternion<HAMILTON, double>> latest;
+        REQUIRE(latest.version() == 1);
+        REQUIRE(latest.load().w() == 1.0);
+
+        const Quaternion<HAMILTON, double> q{0.5, 0.5, -0.5, 0.5};
+        latest.store(q);
+        REQUIRE(latest.version() == 2);
+        const Quaternion<HAMILTON, double> loaded = latest.load();
+        REQUIRE(loaded.w() == 0.5);
+        REQUIRE(loaded.y() == -0.5);
+
+        Quaternion<HAMILTON, double> tried;
+        size_t version = 0;
+        REQUIRE(latest.tryLoad(tried, &version));
+        REQUIRE(version == 2);
+        REQUIRE(tried.z() == 0.5);
+
+        LatestAttitude<RotationMatrix<ACTIVE, float>, 3> matrix{RotationMatrix<ACTIVE, float>::Identity()};
+        for(size_t k = 0; k < 10; k++) {
+            matrix.store(RotationMatrix<ACTIVE, float>{Euler<INTRINSIC, ZYX, float>{0.1f * static_cast<float>(k), 0.2f, 0.3f}});
+        }
+        REQUIRE(matrix.version() == 11);
+        const RotationMatrix<ACTIVE, float> expected{Euler<INTRINSIC, ZYX, float>{0.1f * 9.0f, 0.2f, 0.3f}};
+        REQUIRE(matrix.load()(1, 2) == expected(1, 2));
+    }
+
+    SECTION("Concurrent readers never see a torn value") {
+        LatestAttitude<Stamped> latest{stamped(0)};
+        const size_t count = 200000;
+        std::atomic<bool> done{false};
+        std::atomic<size_t> torn{0};
+        std::atomic<size_t> regressed{0};
+
+        std::vector<std::thread> readers;
+        for(size_t r = 0; r < 3; r++) {
+            readers.emplace_back([&] {
+                double previous = 0.0;
+                while(!done.load()) {
+                    const Stamped s = latest.load();
+                    torn += consistent(s) ? 0u : 1u;
+                    regressed += s.time < previous ? 1u : 0u;
+                    previous = s.time;
+                }
+            });
+        }
+        for(size_t k = 1; k <= count; k++) {
+            latest.store(stamped(k));
+        }
+        done.store(true);
+        for(std::thread& reader : readers) {
+            reader.join();
+        }
+
+        REQUIRE(torn.load() == 0);
+        REQUIRE(regressed.load() == 0);
+        REQUIRE(latest.version() == count + 1);
+        REQUIRE(latest.load().time == static_cast<double>(count));
+    }
+}
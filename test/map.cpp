@@ -0,0 +1,137 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using namespace tinyso3;
+
+namespace {
+// A message layout with interleaved fields, e.g. a pose stamped sensor packet.
+struct Packet {
+    float position[3];
+    float orientation[4]; // w, x, y, z
+    float covariance[9];  // column major
+};
+} // namespace
+
+TEST_CASE("MatrixMap") {
+    float buffer[9] = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f};
+
+    SECTION("Row and column major") {
+        const MatrixMap<3, 3, float> row_major{buffer};
+        const MatrixMap<3, 3, const float> col_major{buffer, 1, 3};
+
+        REQUIRE(row_major(0, 1) == 2.f);
+        REQUIRE(row_major(2, 0) == 7.f);
+        REQUIRE(col_major(0, 1) == 4.f);
+        REQUIRE(col_major(2, 0) == 3.f);
+        REQUIRE((col_major.matrix() - row_major.T()).abs().max() == 0.f);
+    }
+
+    SECTION("Arithmetic") {
+        const MatrixMap<3, 3, const float> map{buffer};
+        const Matrix<3, 3, float> m{buffer};
+
+        REQUIRE(((map + 1.f) - (m + 1.f)).abs().max() == 0.f);
+        REQUIRE(((2.f * map) - m * 2.f).abs().max() == 0.f);
+        REQUIRE(((map * m) - m * m).abs().max() == 0.f);
+        REQUIRE(((m * map) - m * m).abs().max() == 0.f);
+        REQUIRE(((map * map) - m * m).abs().max() == 0.f);
+        REQUIRE(((map - m) + (-map)).abs().max() == m.abs().max());
+        REQUIRE(map.max() == 9.f);
+        REQUIRE(map.min() == 1.f);
+    }
+
+    SECTION("Write through") {
+        MatrixMap<3, 3, float> map{buffer, 1, 3};
+        map = SquareMatrix<3, float>::Identity();
+        REQUIRE(buffer[0] == 1.f);
+        REQUIRE(buffer[1] == 0.f);
+        REQUIRE(buffer[4] == 1.f);
+
+        map *= 2.f;
+        map += SquareMatrix<3, float>::Identity();
+        REQUIRE(buffer[8] == 3.f);
+
+        float other[9] = {};
+        MatrixMap<3, 3, float> copy{other};
+        copy = map;
+        REQUIRE(other[4] == 3.f);
+        REQUIRE(copy.data() == other);
+
+        const MatrixMap<3, 3, const float> view = map;
+        REQUIRE(view(2, 2) == 3.f);
+    }
+}
+
+TEST_CASE("Vector3Map") {
+    float column_major[9] = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f};
+
+    Vector3Map<float> contiguous{column_major + 3};
+    const Vector3Map<const float> row{column_major, 3};
+
+    REQUIRE(contiguous.x() == 4.f);
+    REQUIRE(contiguous.z() == 6.f);
+    REQUIRE(row(1) == 4.f);
+    REQUIRE(row.z() == 7.f);
+
+    const Vector3<float> v{1.f, 0.f, 0.f};
+    REQUIRE(row.dot(v) == 1.f);
+    REQUIRE((row.cross(v) - row.vector().cross(v)).norm() == 0.f);
+    REQUIRE((row.hat() * v - row.cross(v)).abs().max() == 0.f);
+    REQUIRE((row + v - Vector3<float>{2.f, 4.f, 7.f}).norm() == 0.f);
+
+    const RotationMatrix<ACTIVE, float> R = RotationMatrix<ACTIVE, float>::RotatePrincipalAxis<Z>(0.5f);
+    const Vector3<float> rotated = R * row;
+    REQUIRE((rotated - R * row.vector()).abs().max() == 0.f);
+
+    contiguous = R * row;
+    REQUIRE(column_major[3] == rotated.x());
+    REQUIRE(column_major[5] == rotated.z());
+    REQUIRE(column_major[0] == 1.f);
+
+    contiguous *= 2.f;
+    REQUIRE(column_major[4] == rotated.y() * 2.f);
+}
+
+TEST_CASE("QuaternionMap") {
+    Packet packets[2] = {};
+    const Quaternion<HAMILTON, float> q = Quaternion<HAMILTON, float>{}.boxplus(Vector3<float>{0.3f, -0.2f, 0.7f});
+
+    SECTION("Message fields") {
+        QuaternionMap<HAMILTON, float> orientation{packets[0].orientation};
+        orientation = q;
+        REQUIRE(packets[0].orientation[0] == q.w());
+        REQUIRE(packets[0].orientation[3] == q.z());
+
+        Vector3Map<float> position{packets[0].position};
+        position = orientation * Vector3<float>{1.f, 0.f, 0.f};
+        REQUIRE((position - q * Vector3<float>{1.f, 0.f, 0.f}).norm() == 0.f);
+
+        const Quaternion<HAMILTON, float> dq = Quaternion<HAMILTON, float>{}.boxplus(Vector3<float>{0.f, 0.f, 0.1f});
+        orientation *= dq;
+        REQUIRE((Vector<4, float>{orientation.quaternion()} - Vector<4, float>{q * dq}).abs().max() == 0.f);
+        REQUIRE(orientation.boxminus(q).norm() < 0.1f + 1e-5f);
+
+        MatrixMap<3, 3, float> covariance{packets[0].covariance, 1, 3};
+        covariance = SquareMatrix<3, float>::Identity() * 0.01f;
+        covariance = q.adjoint() * covariance * q.adjoint().T();
+        REQUIRE_THAT(packets[0].covariance[0] + packets[0].covariance[4] + packets[0].covariance[8], Catch::Matchers::WithinAbs(0.03f, 1e-6f));
+    }
+
+    SECTION("Strided quaternions") {
+        // JPL storage x, y, z, w across an array of packets, every 16th float.
+        float interleaved[32] = {};
+        QuaternionMap<JPL, float> map{interleaved + 1, 4};
+        const Quaternion<JPL, float> q_jpl = Quaternion<JPL, float>{}.boxplus(Vector3<float>{0.3f, -0.2f, 0.7f});
+        map = q_jpl;
+
+        REQUIRE(interleaved[1] == q_jpl.x());
+        REQUIRE(interleaved[13] == q_jpl.w());
+        REQUIRE(map.Re() == q_jpl.w());
+
+        const QuaternionMap<JPL, const float> view = map;
+        REQUIRE((Vector<4, float>{view.quaternion()} - Vector<4, float>{q_jpl}).abs().max() == 0.f);
+        REQUIRE((view * q_jpl.conjugate()).boxminus(Quaternion<JPL, float>{}).norm() < 1e-6f);
+        REQUIRE_THAT(view.norm(), Catch::Matchers::WithinAbs(1.f, 1e-6f));
+    }
+}
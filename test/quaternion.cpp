@@ -457,4 +457,40 @@ TEST_CASE("Quaternion") {
         REQUIRE_THAT(q8_log.y(), Catch::Matchers::WithinAbs(q8_vec.y(), 1e-4));
         REQUIRE_THAT(q8_log.z(), Catch::Matchers::WithinAbs(q8_vec.z(), 1e-4));
     }
+
+    SECTION("boxplus, boxminus") {
+        const Vector3<double> phi{0.3, -0.2, 0.5};
+        const Euler<INTRINSIC, ZYX, double> euler{0.4, -0.1, 1.2};
+
+        // Body frame perturbation matches R * Exp(hat(phi)) for ACTIVE, Exp(-hat(phi)) * R for PASSIVE.
+        const RotationMatrix<ACTIVE, double> R_active = RotationMatrix<ACTIVE, double>{euler} * RotationMatrix<ACTIVE, double>::Exp(phi.hat());
+        const RotationMatrix<PASSIVE, double> R_passive = RotationMatrix<PASSIVE, double>::Exp(-phi.hat()) * RotationMatrix<PASSIVE, double>{euler};
+        const Quaternion<HAMILTON, double> q_hamilton = Quaternion<HAMILTON, double>{euler}.boxplus(phi);
+        const Quaternion<JPL, double> q_jpl = Quaternion<JPL, double>{euler}.boxplus(phi);
+
+        const Vector3<double> vec{1.1, 2.2, 3.3};
+        const Vector3<double> vec_active = Vector3<double>{R_active * vec};
+        const Vector3<double> vec_passive = Vector3<double>{R_passive * vec};
+        const Vector3<double> vec_hamilton = q_hamilton * vec;
+        const Vector3<double> vec_jpl = q_jpl * vec;
+
+        for(size_t i = 0; i < 3; i++) {
+            REQUIRE_THAT(vec_hamilton(i), Catch::Matchers::WithinAbs(vec_active(i), 1e-12));
+            REQUIRE_THAT(vec_jpl(i), Catch::Matchers::WithinAbs(vec_passive(i), 1e-12));
+        }
+
+        const Vector3<double> phi_hamilton = q_hamilton.boxminus(Quaternion<HAMILTON, double>{euler});
+        const Vector3<double> phi_jpl = q_jpl.boxminus(Quaternion<JPL, double>{euler});
+        for(size_t i = 0; i < 3; i++) {
+            REQUIRE_THAT(phi_hamilton(i), Catch::Matchers::WithinAbs(phi(i), 1e-12));
+            REQUIRE_THAT(phi_jpl(i), Catch::Matchers::WithinAbs(phi(i), 1e-12));
+        }
+
+        // Shortest path is returned regardless of the sign of the quaternion.
+        const Quaternion<HAMILTON, double> q_negated{-q_hamilton.w(), -q_hamilton.x(), -q_hamilton.y(), -q_hamilton.z()};
+        const Vector3<double> phi_negated = q_negated.boxminus(Quaternion<HAMILTON, double>{euler});
+        for(size_t i = 0; i < 3; i++) {
+            REQUIRE_THAT(phi_negated(i), Catch::Matchers::WithinAbs(phi(i), 1e-12));
+        }
+    }
 }
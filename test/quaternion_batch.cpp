@@ -0,0 +1,64 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace tinyso3;
+
+TEST_CASE("QuaternionBatch, Vector3Batch") {
+    SECTION("Element access") {
+        double w[3] = {1.0, 0.0, 0.5};
+        double x[3] = {0.0, 1.0, 0.5};
+        double y[3] = {0.0, 0.0, 0.5};
+        double z[3] = {0.0, 0.0, 0.5};
+        const QuaternionBatch<JPL, double> batch{w, x, y, z, 3};
+
+        REQUIRE(batch.size() == 3);
+        REQUIRE(batch[1].x() == 1.0);
+        REQUIRE(batch[2].w() == 0.5);
+
+        batch.set(0, Quaternion<JPL, double>{0.0, 0.0, 1.0, 0.0});
+        REQUIRE(z[0] == 1.0);
+        REQUIRE(w[0] == 0.0);
+
+        const QuaternionBatch<JPL, const double> view = batch;
+        REQUIRE(view.z()[0] == 1.0);
+        REQUIRE(view[0].z() == 1.0);
+    }
+
+    SECTION("Vector3 element access") {
+        float x[2] = {1.0f, 2.0f};
+        float y[2] = {3.0f, 4.0f};
+        float z[2] = {5.0f, 6.0f};
+        const Vector3Batch<float> batch{x, y, z, 2};
+
+        REQUIRE(batch[1].y() == 4.0f);
+        batch.set(1, Vector3<float>{-1.0f, -2.0f, -3.0f});
+        REQUIRE(x[1] == -1.0f);
+
+        const Vector3Batch<const float> view = batch;
+        REQUIRE(view[1].z() == -3.0f);
+        REQUIRE(view.size() == 2);
+    }
+
+    SECTION("Slices") {
+        double w[4] = {1.0, 0.0, 0.0, 0.0};
+        double x[4] = {0.0, 1.0, 0.0, 0.0};
+        double y[4] = {0.0, 0.0, 1.0, 0.0};
+        double z[4] = {0.0, 0.0, 0.0, 1.0};
+        const QuaternionBatch<HAMILTON, double> slice = QuaternionBatch<HAMILTON, double>{w, x, y, z, 4}.slice(2, 2);
+        REQUIRE(slice.size() == 2);
+        REQUIRE(slice[0].y() == 1.0);
+        slice.set(1, Quaternion<HAMILTON, double>{1.0, 0.0, 0.0, 0.0});
+        REQUIRE(w[3] == 1.0);
+
+        const Vector3Batch<const double> vectors = Vector3Batch<const double>{w, x, y, 4}.slice(1, 3);
+        REQUIRE(vectors[0].y() == 1.0);
+        REQUIRE(vectors.size() == 3);
+
+        double* const elements[9] = {w, x, y, z, w, x, y, z, w};
+        const RotationMatrixBatch<ACTIVE, double> matrices = RotationMatrixBatch<ACTIVE, double>{elements, 4}.slice(3, 1);
+        REQUIRE(matrices.element(0, 0)[0] == 1.0);
+        REQUIRE(matrices.element(2, 2)[0] == 1.0);
+        REQUIRE(matrices.element(1, 0)[0] == 0.0);
+        REQUIRE(matrices.size() == 1);
+    }
+}
@@ -0,0 +1,117 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using namespace tinyso3;
+
+namespace {
+// Deterministic unit quaternions covering every largest component and sign.
+template<typename QuaternionConvention, typename Type>
+Quaternion<QuaternionConvention, Type> sample(size_t i) {
+    const double s = static_cast<double>(i);
+    Quaternion<QuaternionConvention, Type> q;
+    q.w() = Type(sin(1.7 * s + 0.3));
+    q.x() = Type(cos(2.3 * s));
+    q.y() = Type(sin(0.37 * s) * 0.8);
+    q.z() = Type(cos(3.1 * s + 1.0) * 1.2);
+    return q.unit();
+}
+
+template<size_t Bits, typename QuaternionConvention, typename Type>
+double maxError(size_t count) {
+    using Codec = QuaternionCodec<Bits, QuaternionConvention, Type>;
+    using QuaternionType = Quaternion<QuaternionConvention, Type>;
+    double error = 0.0;
+    for(size_t i = 0; i < count; i++) {
+        const QuaternionType q = sample<QuaternionConvention, Type>(i);
+        const QuaternionType decoded = Codec::Decode(Codec::Encode(q));
+
+        REQUIRE_THAT(static_cast<double>(decoded.norm()), Catch::Matchers::WithinAbs(1.0, 1e-6));
+        REQUIRE(decoded.w() >= 0);
+
+        // Angle in double precision, independent of the rounding of the float norms.
+        const Vector<4, double> a = Vector<4, Type>{q}.template cast<double>();
+        const Vector<4, double> b = Vector<4, Type>{decoded}.template cast<double>();
+        const double cosine = fabs(a.dot(b)) / (a.norm() * b.norm());
+        error = fmax(error, 2.0 * acos(fmin(cosine, 1.0)));
+    }
+    return error;
+}
+} // namespace
+
+TEST_CASE("QuaternionCodec") {
+    SECTION("Worst-case angular error") {
+        const double e32 = maxError<32, HAMILTON, double>(20000);
+        const double e48 = maxError<48, HAMILTON, double>(20000);
+        const double e64 = maxError<64, JPL, double>(20000);
+
+        REQUIRE(e32 < QuaternionCodec<32, HAMILTON, double>::MaxAngularError());
+        REQUIRE(e48 < QuaternionCodec<48, HAMILTON, double>::MaxAngularError());
+        REQUIRE(e64 < QuaternionCodec<64, JPL, double>::MaxAngularError());
+        REQUIRE(QuaternionCodec<32, HAMILTON, double>::MaxAngularError() < 4.8e-3);
+        REQUIRE(QuaternionCodec<48, HAMILTON, double>::MaxAngularError() < 1.5e-4);
+        REQUIRE(QuaternionCodec<64, HAMILTON, double>::MaxAngularError() < 4.7e-6);
+
+        REQUIRE(maxError<32, JPL, float>(5000) < QuaternionCodec<32, JPL, float>::MaxAngularError());
+        REQUIRE(maxError<48, HAMILTON, float>(5000) < QuaternionCodec<48, HAMILTON, float>::MaxAngularError());
+    }
+
+    SECTION("Sign and layout") {
+        using Codec = QuaternionCodec<48, HAMILTON, double>;
+        REQUIRE(Codec::ComponentBits == 15);
+        REQUIRE(Codec::Bytes == 6);
+
+        for(size_t i = 0; i < 100; i++) {
+            const Quaternion<HAMILTON, double> q = sample<HAMILTON, double>(i);
+            const Quaternion<HAMILTON, double> negated{-q.w(), -q.x(), -q.y(), -q.z()};
+            REQUIRE(Codec::Encode(q) == Codec::Encode(negated));
+            REQUIRE((Codec::Encode(q) >> 47) == 0);
+        }
+
+        // The dropped component index is stored above the three components.
+        Quaternion<HAMILTON, double> q;
+        q.w() = 0.1;
+        q.x() = 0.2;
+        q.y() = -0.9;
+        q.z() = 0.3;
+        q = q.unit();
+        REQUIRE((Codec::Encode(q) >> 45) == 2);
+        REQUIRE_THAT(Codec::Decode(Codec::Encode(q)).y(), Catch::Matchers::WithinAbs(q.y(), 1e-4));
+    }
+
+    SECTION("Store and Load") {
+        using Codec = QuaternionCodec<48, JPL, float>;
+        unsigned char bytes[Codec::Bytes * 3];
+        Codec::Code codes[3];
+        for(size_t i = 0; i < 3; i++) {
+            codes[i] = Codec::Encode(sample<JPL, float>(i));
+            Codec::Store(codes[i], bytes + i * Codec::Bytes);
+        }
+
+        for(size_t i = 0; i < 3; i++) {
+            REQUIRE(Codec::Load(bytes + i * Codec::Bytes) == codes[i]);
+        }
+        REQUIRE(bytes[0] == static_cast<unsigned char>(codes[0] & 0xFF));
+    }
+
+    SECTION("Batch") {
+        using Codec = QuaternionCodec<32, JPL, float>;
+        const size_t N = 37;
+        float w[N], x[N], y[N], z[N], dw[N], dx[N], dy[N], dz[N];
+        const QuaternionBatch<JPL, float> q{w, x, y, z, N};
+        const QuaternionBatch<JPL, float> decoded{dw, dx, dy, dz, N};
+        for(size_t i = 0; i < N; i++) {
+            q.set(i, sample<JPL, float>(i));
+        }
+
+        Codec::Code codes[N];
+        Codec::Encode(q, codes);
+        Codec::Decode(codes, decoded);
+
+        for(size_t i = 0; i < N; i++) {
+            REQUIRE(codes[i] == Codec::Encode(q[i]));
+            const Quaternion<JPL, float> expected = Codec::Decode(codes[i]);
+            REQUIRE((Vector<4, float>{decoded[i]} - Vector<4, float>{expected}).abs().max() == 0.f);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "trajectory.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const Trajectory trajectory{1.3, -0.7};
+} // namespace
+
+TEST_CASE("QuaternionHermite") {
+    SECTION("Endpoints and tangents") {
+        const double t0 = 0.2;
+        const double t1 = 0.7;
+        const QuaternionHermite<HAMILTON, double> hermite{trajectory.attitude(t0), trajectory.angularVelocity(t0), trajectory.attitude(t1), trajectory.angularVelocity(t1), t1 - t0};
+
+        REQUIRE(hermite(0.0).boxminus(trajectory.attitude(t0)).norm() < 1e-12);
+        REQUIRE(hermite(1.0).boxminus(trajectory.attitude(t1)).norm() < 1e-12);
+
+        const AngularVelocity<double> w0 = hermite.angularVelocity(0.0);
+        const AngularVelocity<double> w1 = hermite.angularVelocity(1.0);
+        for(size_t i = 0; i < 3; i++) {
+            REQUIRE_THAT(w0(i), Catch::Matchers::WithinAbs(trajectory.angularVelocity(t0)(i), 1e-12));
+            REQUIRE_THAT(w1(i), Catch::Matchers::WithinAbs(trajectory.angularVelocity(t1)(i), 1e-12));
+        }
+
+        // Angular velocity agrees with the finite difference of the curve.
+        const double h = 1e-6;
+        const Vector3<double> finite_difference = hermite(0.4 + h).boxminus(hermite(0.4 - h)) / (2.0 * h * hermite.duration());
+        const AngularVelocity<double> w = hermite.angularVelocity(0.4);
+        for(size_t i = 0; i < 3; i++) {
+            REQUIRE_THAT(w(i), Catch::Matchers::WithinAbs(finite_difference(i), 1e-6));
+        }
+    }
+
+    SECTION("JPL convention") {
+        const Euler<INTRINSIC, ZYX, double> euler0{0.1, 0.2, -0.3};
+        const Euler<INTRINSIC, ZYX, double> euler1{0.9, -0.4, 0.5};
+        const AngularVelocity<double> w0{0.3, -1.0, 0.2};
+        const AngularVelocity<double> w1{-0.5, 0.4, 1.1};
+
+        const QuaternionHermite<HAMILTON, double> hamilton{Quaternion<HAMILTON, double>{euler0}, w0, Quaternion<HAMILTON, double>{euler1}, w1, 0.8};
+        const QuaternionHermite<JPL, double> jpl{Quaternion<JPL, double>{euler0}, w0, Quaternion<JPL, double>{euler1}, w1, 0.8};
+
+        const Vector3<double> vec{1.1, 2.2, 3.3};
+        for(double u = 0.0; u <= 1.0; u += 0.25) {
+            // HAMILTON rotates actively and JPL passively, the transposed rotation.
+            const Vector3<double> vec_hamilton = hamilton(u).conjugate() * vec;
+            const Vector3<double> vec_jpl = jpl(u) * vec;
+            const AngularVelocity<double> w_hamilton = hamilton.angularVelocity(u);
+            const AngularVelocity<double> w_jpl = jpl.angularVelocity(u);
+
+            for(size_t i = 0; i < 3; i++) {
+                REQUIRE_THAT(vec_jpl(i), Catch::Matchers::WithinAbs(vec_hamilton(i), 1e-12));
+                REQUIRE_THAT(w_jpl(i), Catch::Matchers::WithinAbs(w_hamilton(i), 1e-12));
+            }
+        }
+    }
+
+    SECTION("Accuracy against slerp with fewer keyframes") {
+        // Hermite keyframes every 0.2 second against slerp keyframes every 0.05 second.
+        double hermite_error = 0.0;
+        double slerp_error = 0.0;
+
+        for(size_t k = 0; k < 10; k++) {
+            const double t0 = 0.2 * static_cast<double>(k);
+            const double t1 = t0 + 0.2;
+            const QuaternionHermite<HAMILTON, double> hermite{trajectory.attitude(t0), trajectory.angularVelocity(t0), trajectory.attitude(t1), trajectory.angularVelocity(t1), t1 - t0};
+
+            for(double u = 0.0; u <= 1.0; u += 0.01) {
+                hermite_error = fmax(hermite_error, hermite(u).boxminus(trajectory.attitude(t0 + u * 0.2)).norm());
+            }
+        }
+
+        for(size_t k = 0; k < 40; k++) {
+            const double t0 = 0.05 * static_cast<double>(k);
+            Quaternion<HAMILTON, double> q0 = trajectory.attitude(t0);
+
+            for(double u = 0.0; u <= 1.0; u += 0.04) {
+                slerp_error = fmax(slerp_error, q0.slerp(trajectory.attitude(t0 + 0.05), u).boxminus(trajectory.attitude(t0 + u * 0.05)).norm());
+            }
+        }
+
+        REQUIRE(hermite_error < slerp_error);
+    }
+
+    SECTION("Batch evaluation") {
+        const QuaternionHermite<JPL, float> hermite{Quaternion<JPL, float>{}, AngularVelocity<float>{0.1f, 0.2f, 0.3f},
+                                                    Quaternion<JPL, float>::RotatePrincipalAxis<Y>(0.5f), AngularVelocity<float>{0.0f, 0.0f, 0.0f},
+                                                    0.5f};
+
+        float u[16];
+        Quaternion<JPL, float> out[16];
+        for(size_t k = 0; k < 16; k++) {
+            u[k] = static_cast<float>(k) / 15.0f;
+        }
+
+        hermite(u, out, 16);
+
+        for(size_t k = 0; k < 16; k++) {
+            const Quaternion<JPL, float> compare = hermite(u[k]);
+            REQUIRE(out[k].w() == compare.w());
+            REQUIRE(out[k].x() == compare.x());
+            REQUIRE(out[k].y() == compare.y());
+            REQUIRE(out[k].z() == compare.z());
+        }
+    }
+}
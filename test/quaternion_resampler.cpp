@@ -0,0 +1,96 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "trajectory.hpp"
+
+using namespace tinyso3;
+
+namespace {
+const Trajectory trajectory{1.3, -0.7};
+
+double jitteredTime(size_t k) {
+    return static_cast<double>(k) / 137.0 + 0.002 * sin(1.7 * static_cast<double>(k));
+}
+
+double maxError(Interpolation interpolation) {
+    QuaternionResampler<HAMILTON, double> resampler{100.0, 0.1, interpolation};
+    double max_error = 0.0;
+
+    for(size_t k = 0; k < 500; k++) {
+        const double time = jitteredTime(k);
+        resampler.push({time, trajectory.attitude(time), trajectory.angularVelocity(time)}, [&](const double& t, const Quaternion<HAMILTON, double>& q) {
+            max_error = fmax(max_error, angularError(q, trajectory.attitude(t)));
+        });
+    }
+
+    return max_error;
+}
+} // namespace
+
+TEST_CASE("QuaternionResampler") {
+    SECTION("Exact rate ticks") {
+        QuaternionResampler<HAMILTON, double> resampler{100.0, 0.1};
+        size_t count = 0;
+        long long previous_tick = -1;
+
+        for(size_t k = 0; k < 300; k++) {
+            const double time = jitteredTime(k);
+            resampler.push({time, trajectory.attitude(time), trajectory.angularVelocity(time)}, [&](const double& t, const Quaternion<HAMILTON, double>& q) {
+                const long long tick = static_cast<long long>(round(t * 100.0));
+                REQUIRE(t == static_cast<double>(tick) / 100.0);
+                REQUIRE((previous_tick < 0 || tick == previous_tick + 1));
+                REQUIRE_THAT(q.norm(), Catch::Matchers::WithinAbs(1.0, 1e-12));
+                previous_tick = tick;
+                count++;
+            });
+        }
+
+        REQUIRE(count == resampler.statistics().output_count);
+        REQUIRE(resampler.statistics().input_count == 300);
+        REQUIRE(resampler.statistics().gap_count == 0);
+        REQUIRE_THAT(resampler.statistics().inputRate(), Catch::Matchers::WithinRel(137.0, 1e-2));
+        REQUIRE_THAT(resampler.statistics().outputRate(), Catch::Matchers::WithinRel(100.0, 1e-2));
+    }
+
+    SECTION("Interpolation accuracy") {
+        const double slerp_error = maxError(Interpolation::SLERP);
+        const double nlerp_error = maxError(Interpolation::NLERP);
+        const double hermite_error = maxError(Interpolation::HERMITE);
+
+        REQUIRE(slerp_error < 1e-4);
+        REQUIRE(nlerp_error < 1e-4);
+        REQUIRE(hermite_error < 1e-7);
+        REQUIRE(hermite_error < slerp_error / 100.0);
+    }
+
+    SECTION("Gaps and rejected samples") {
+        QuaternionResampler<JPL, float> resampler{50.0f, 0.05f};
+        const Quaternion<JPL, float> q{};
+        const AngularVelocity<float> w{0.0f, 0.0f, 0.0f};
+        float last_output = 0.0f;
+        auto sink = [&](const float& t, const Quaternion<JPL, float>&) {
+            REQUIRE((t <= 1.0001f || t >= 2.0f));
+            last_output = t;
+        };
+
+        for(size_t k = 0; k <= 100; k++) {
+            resampler.push({static_cast<float>(k) * 0.01f, q, w}, sink);
+        }
+
+        // Out of order sample is rejected.
+        REQUIRE(resampler.push({0.5f, q, w}, sink) == 0);
+        REQUIRE(resampler.statistics().rejected_count == 1);
+
+        // 1 second gap, nothing is emitted inside.
+        REQUIRE(resampler.push({2.0f, q, w}, sink) == 0);
+        REQUIRE(resampler.statistics().gap_count == 1);
+
+        REQUIRE(resampler.push({2.01f, q, w}, sink) == 1);
+        REQUIRE_THAT(last_output, Catch::Matchers::WithinAbs(2.0f, 1e-6f));
+
+        resampler.reset();
+        REQUIRE(resampler.statistics().input_count == 0);
+        REQUIRE(resampler.statistics().output_count == 0);
+    }
+}
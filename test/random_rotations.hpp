@@ -0,0 +1,31 @@
+/**
+ * @file random_rotations.hpp
+ *
+ * Random rotations and the angle between them, shared by the tests.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <tinyso3/tinyso3.hpp>
+
+#include <stdint.h>
+
+// Uniformly distributed rotations (Shoemake 1992) from a xorshift generator.
+inline tinyso3::Quaternion<tinyso3::HAMILTON, double> uniform(uint64_t& state) {
+    double u[3];
+    for(size_t k = 0; k < 3; k++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        u[k] = static_cast<double>(state >> 11) / 9007199254740992.0;
+    }
+    const double a = sqrt(1.0 - u[0]), b = sqrt(u[0]);
+    return tinyso3::Quaternion<tinyso3::HAMILTON, double>{a * sin(2.0 * M_PI * u[1]), a * cos(2.0 * M_PI * u[1]), b * sin(2.0 * M_PI * u[2]), b * cos(2.0 * M_PI * u[2])};
+}
+
+// Angle between two rotations, identifying q and -q.
+inline double angle(const tinyso3::Quaternion<tinyso3::HAMILTON, double>& a, const tinyso3::Quaternion<tinyso3::HAMILTON, double>& b) {
+    return 2.0 * acos(fmin(fabs(tinyso3::Vector<4, double>{a}.dot(tinyso3::Vector<4, double>{b})), 1.0));
+}
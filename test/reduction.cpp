@@ -0,0 +1,99 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace tinyso3;
+
+namespace {
+// Merges of leaf labels, recording the tree as nested brackets.
+struct Trace {
+    char text[256]{};
+
+    void merge(const Trace& other) {
+        const size_t left = strlen(text), right = strlen(other.text);
+        memmove(text + 1, text, left);
+        text[0] = '(';
+        text[left + 1] = ' ';
+        memcpy(text + left + 2, other.text, right);
+        text[left + right + 2] = ')';
+        text[left + right + 3] = '\0';
+    }
+};
+
+Trace leaf(size_t i) {
+    Trace t;
+    snprintf(t.text, sizeof(t.text), "%zu", i);
+    return t;
+}
+} // namespace
+
+TEST_CASE("Reduction") {
+    SECTION("Compensated summation") {
+        // 1 followed by many values below half an ulp of it, lost entirely by a naive sum.
+        MatrixSum<2, 1, double, NAIVE> naive;
+        MatrixSum<2, 1, double, KAHAN> kahan;
+        const Vector<2, double> big{1.0, -1.0};
+        const Vector<2, double> small{1e-17, 1e-17};
+        naive.add(big);
+        kahan.add(big);
+        for(size_t i = 0; i < 100000; i++) {
+            naive.add(small);
+            kahan.add(small);
+        }
+        REQUIRE(naive.value()(0, 0) == 1.0);
+        REQUIRE(fabs(kahan.value()(0, 0) - (1.0 + 1e-12)) <= 2.3e-16);
+        REQUIRE(fabs(kahan.value()(1, 0) - (-1.0 + 1e-12)) <= 2.3e-16);
+        REQUIRE(kahan.count() == 100001);
+
+        // Merging keeps both compensations.
+        MatrixSum<2, 1, double, KAHAN> half;
+        half.add(big);
+        MatrixSum<2, 1, double, KAHAN> rest;
+        for(size_t i = 0; i < 100000; i++) {
+            rest.add(small);
+        }
+        half.merge(rest);
+        REQUIRE(fabs(half.value()(0, 0) - (1.0 + 1e-12)) <= 2.3e-16);
+        REQUIRE(half.count() == 100001);
+    }
+
+    SECTION("Quaternion and matrix sums") {
+        MatrixSum<4, 1, float> quaternions;
+        quaternions.add(Quaternion<HAMILTON, float>{0.5f, 0.5f, 0.5f, 0.5f});
+        quaternions.add(Quaternion<HAMILTON, float>{1.0f, 0.0f, 0.0f, 0.0f});
+        REQUIRE(Quaternion<HAMILTON, float>{quaternions.value()}.w() == 1.5f);
+
+        MatrixSum<3, 3, float> matrices;
+        matrices.add(SquareMatrix<3, float>::Identity());
+        matrices.add(RotationMatrix<ACTIVE, float>::Identity());
+        REQUIRE(matrices.value()(2, 2) == 2.0f);
+        REQUIRE(matrices.value()(0, 1) == 0.0f);
+    }
+
+    SECTION("The tree of push is the tree of Combine") {
+        for(size_t count = 1; count <= 40; count++) {
+            ReductionTree<Trace> tree;
+            Trace leaves[40];
+            for(size_t i = 0; i < count; i++) {
+                tree.push(leaf(i));
+                leaves[i] = leaf(i);
+            }
+            REQUIRE(strcmp(tree.result().text, ReductionTree<Trace>::Combine(leaves, count).text) == 0);
+        }
+
+        ReductionTree<Trace> tree;
+        for(size_t i = 0; i < 7; i++) {
+            tree.push(leaf(i));
+        }
+        REQUIRE(strcmp(tree.result().text, "(((0 1) (2 3)) ((4 5) 6))") == 0);
+        REQUIRE(ReductionTree<Trace>{}.result().text[0] == '\0');
+    }
+
+    SECTION("Leaf ranges") {
+        REQUIRE(ReductionTree<Trace>::Leaves(0, 256) == 0);
+        REQUIRE(ReductionTree<Trace>::Leaves(513, 256) == 3);
+        size_t begin, end;
+        ReductionTree<Trace>::Range(2, 513, 256, begin, end);
+        REQUIRE(begin == 512);
+        REQUIRE(end == 513);
+    }
+}
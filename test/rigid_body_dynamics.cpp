@@ -0,0 +1,174 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using namespace tinyso3;
+
+namespace {
+// A tumbling body with distinct principal moments (1, 2, 3.5), principal axes rotated away from the body axes.
+SquareMatrix<3, double> inertia() {
+    const SquareMatrix<3, double> A = RotationMatrix<ACTIVE, double>::Exp(Vector3<double>{0.3, -0.5, 0.9}.hat());
+    SquareMatrix<3, double> D{};
+    D(0, 0) = 1.0;
+    D(1, 1) = 2.0;
+    D(2, 2) = 3.5;
+    return A * D * A.T();
+}
+
+// World frame angular momentum, HAMILTON rotates body to world, JPL rotates world to body.
+template<typename QuaternionConvention>
+Vector3<double> worldMomentum(const Quaternion<QuaternionConvention, double>& q, const Vector3<double>& body) {
+    return is_same<QuaternionConvention, HAMILTON>::value ? q * body : q.conjugate() * body;
+}
+
+template<typename Scheme, typename QuaternionConvention>
+void tumble(double& energy_error, double& norm_error, double& world_error) {
+    const RigidBodyDynamics<Scheme, QuaternionConvention, double> dynamics{inertia()};
+    Quaternion<QuaternionConvention, double> q;
+    AngularVelocity<double> w{0.2, 1.5, -0.4};
+
+    const double energy = dynamics.kineticEnergy(w);
+    const Vector3<double> momentum = worldMomentum(q, dynamics.angularMomentum(w));
+
+    energy_error = norm_error = world_error = 0.0;
+    for(size_t k = 0; k < 2000; k++) {
+        dynamics.step(q, w, 0.01);
+        energy_error = fmax(energy_error, fabs(dynamics.kineticEnergy(w) - energy) / energy);
+        norm_error = fmax(norm_error, fabs(dynamics.angularMomentum(w).norm() - momentum.norm()));
+        world_error = fmax(world_error, (worldMomentum(q, dynamics.angularMomentum(w)) - momentum).norm());
+    }
+}
+
+template<typename Scheme>
+Vector3<double> finalAngularVelocity(double dt) {
+    const RigidBodyDynamics<Scheme, HAMILTON, double> dynamics{inertia()};
+    Quaternion<HAMILTON, double> q;
+    AngularVelocity<double> w{0.2, 1.5, -0.4};
+    const size_t steps = static_cast<size_t>(2.0 / dt + 0.5);
+    for(size_t k = 0; k < steps; k++) {
+        dynamics.step(q, w, Vector3<double>{0.1, 0.0, -0.2}, dt);
+    }
+    return w;
+}
+} // namespace
+
+TEST_CASE("RigidBodyDynamics") {
+    SECTION("Principal axes") {
+        const RigidBodyDynamics<SPLITTING, HAMILTON, double> dynamics{inertia()};
+        REQUIRE_THAT(dynamics.principalMoments()(0), Catch::Matchers::WithinAbs(1.0, 1e-12));
+        REQUIRE_THAT(dynamics.principalMoments()(1), Catch::Matchers::WithinAbs(2.0, 1e-12));
+        REQUIRE_THAT(dynamics.principalMoments()(2), Catch::Matchers::WithinAbs(3.5, 1e-12));
+
+        const SquareMatrix<3, double>& A = dynamics.principalAxes();
+        SquareMatrix<3, double> D{};
+        for(size_t i = 0; i < 3; i++) {
+            D(i, i) = dynamics.principalMoments()(i);
+        }
+        REQUIRE((A * D * A.T() - inertia()).abs().max() < 1e-12);
+        REQUIRE((A.T() * A - SquareMatrix<3, double>::Identity()).abs().max() < 1e-12);
+    }
+
+    SECTION("Spin about a principal axis") {
+        const RigidBodyDynamics<SPLITTING, HAMILTON, double> splitting{inertia()};
+        const RigidBodyDynamics<MIDPOINT, HAMILTON, double> midpoint{inertia()};
+        const Vector3<double> axis = Vector3<double>{splitting.principalAxes().col(1)};
+
+        Quaternion<HAMILTON, double> q1, q2;
+        AngularVelocity<double> w1 = axis * 2.0, w2 = axis * 2.0;
+        for(size_t k = 0; k < 100; k++) {
+            splitting.step(q1, w1, 0.01);
+            midpoint.step(q2, w2, 0.01);
+        }
+
+        const Quaternion<HAMILTON, double> expected = Quaternion<HAMILTON, double>{}.boxplus(axis * 2.0);
+        REQUIRE((w1 - axis * 2.0).norm() < 1e-12);
+        REQUIRE((w2 - axis * 2.0).norm() < 1e-12);
+        REQUIRE(q1.boxminus(expected).norm() < 1e-12);
+        REQUIRE(q2.boxminus(expected).norm() < 1e-12);
+    }
+
+    SECTION("Constant torque from rest") {
+        const RigidBodyDynamics<SPLITTING, HAMILTON, double> dynamics{inertia()};
+        const Vector3<double> axis = Vector3<double>{dynamics.principalAxes().col(2)};
+
+        Quaternion<HAMILTON, double> q;
+        AngularVelocity<double> w{};
+        for(size_t k = 0; k < 100; k++) {
+            dynamics.step(q, w, axis * 0.7, 0.01);
+        }
+
+        // w = torque / I * t, angle = torque / I * t^2 / 2
+        REQUIRE((w - axis * (0.7 / 3.5)).norm() < 1e-12);
+        REQUIRE(q.boxminus(Quaternion<HAMILTON, double>{}.boxplus(axis * (0.7 / 3.5 / 2.0))).norm() < 1e-12);
+    }
+
+    SECTION("Conservation") {
+        double energy, norm, world;
+
+        tumble<SPLITTING, HAMILTON>(energy, norm, world);
+        REQUIRE(energy < 1e-3);
+        REQUIRE(norm < 1e-12);
+        REQUIRE(world < 1e-12);
+
+        tumble<SPLITTING, JPL>(energy, norm, world);
+        REQUIRE(energy < 1e-3);
+        REQUIRE(norm < 1e-12);
+        REQUIRE(world < 1e-12);
+
+        tumble<MIDPOINT, HAMILTON>(energy, norm, world);
+        REQUIRE(energy < 1e-9);
+        REQUIRE(norm < 1e-9);
+        REQUIRE(world < 1e-3);
+
+        tumble<MIDPOINT, JPL>(energy, norm, world);
+        REQUIRE(energy < 1e-9);
+        REQUIRE(norm < 1e-9);
+        REQUIRE(world < 1e-3);
+    }
+
+    SECTION("Order of accuracy") {
+        const Vector3<double> reference = finalAngularVelocity<SPLITTING>(1e-4);
+
+        const double splitting1 = (finalAngularVelocity<SPLITTING>(0.02) - reference).norm();
+        const double splitting2 = (finalAngularVelocity<SPLITTING>(0.01) - reference).norm();
+        const double midpoint1 = (finalAngularVelocity<MIDPOINT>(0.02) - reference).norm();
+        const double midpoint2 = (finalAngularVelocity<MIDPOINT>(0.01) - reference).norm();
+
+        REQUIRE(splitting1 / splitting2 > 3.5);
+        REQUIRE(splitting1 / splitting2 < 4.5);
+        REQUIRE(midpoint1 / midpoint2 > 3.5);
+        REQUIRE(midpoint1 / midpoint2 < 4.5);
+    }
+
+    SECTION("Batch") {
+        const RigidBodyDynamics<SPLITTING, JPL, float> dynamics{SquareMatrix<3, float>{inertia()}};
+
+        float qw[5], qx[5], qy[5], qz[5], wx[5], wy[5], wz[5], tx[5], ty[5], tz[5];
+        const QuaternionBatch<JPL, float> q{qw, qx, qy, qz, 5};
+        const Vector3Batch<float> w{wx, wy, wz, 5};
+        const Vector3Batch<float> torque{tx, ty, tz, 5};
+
+        Quaternion<JPL, float> expected_q[5];
+        AngularVelocity<float> expected_w[5];
+        for(size_t i = 0; i < 5; i++) {
+            const float s = static_cast<float>(i);
+            q.set(i, Quaternion<JPL, float>{}.boxplus(Vector3<float>{0.1f * s, -0.2f, 0.3f}));
+            w.set(i, Vector3<float>{0.5f - s, 0.2f * s, 1.0f});
+            torque.set(i, Vector3<float>{0.0f, 0.1f * s, -0.1f});
+            expected_q[i] = q[i];
+            expected_w[i] = w[i];
+        }
+
+        for(size_t k = 0; k < 10; k++) {
+            dynamics.step(q, w, torque, 0.01f);
+            for(size_t i = 0; i < 5; i++) {
+                dynamics.step(expected_q[i], expected_w[i], torque[i], 0.01f);
+            }
+        }
+
+        for(size_t i = 0; i < 5; i++) {
+            REQUIRE((Vector<4, float>{q[i]} - Vector<4, float>{expected_q[i]}).abs().max() == 0.0f);
+            REQUIRE((w[i] - expected_w[i]).abs().max() == 0.0f);
+        }
+    }
+}
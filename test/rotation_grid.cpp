@@ -0,0 +1,126 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "random_rotations.hpp"
+
+using namespace tinyso3;
+
+namespace {
+// Deterministic unit quaternions covering every largest component and sign.
+Quaternion<HAMILTON, double> sample(size_t i) {
+    const double s = static_cast<double>(i);
+    Quaternion<HAMILTON, double> q;
+    q.w() = sin(1.7 * s + 0.3);
+    q.x() = cos(2.3 * s);
+    q.y() = sin(0.37 * s) * 0.8;
+    q.z() = cos(3.1 * s + 1.0) * 1.2;
+    return q.unit();
+}
+} // namespace
+
+TEST_CASE("RotationGrid") {
+    using Grid = RotationGrid<8, HAMILTON, double>;
+    REQUIRE(Grid::Size == 2048);
+
+    SECTION("Cell centers") {
+        for(Grid::Cell cell = 0; cell < Grid::Size; cell++) {
+            const Quaternion<HAMILTON, double> q = Grid::CellCenter(cell);
+            REQUIRE_THAT(q.norm(), Catch::Matchers::WithinAbs(1.0, 1e-12));
+            REQUIRE(q.w() >= 0.0);
+            REQUIRE(Grid::Quantize(q) == cell);
+            REQUIRE(Grid::Quantize(-q) == cell);
+        }
+    }
+
+    SECTION("Quantize") {
+        double error = 0.0;
+        for(size_t i = 0; i < 20000; i++) {
+            const Quaternion<HAMILTON, double> q = sample(i);
+            const Grid::Cell cell = Grid::Quantize(q);
+            REQUIRE(cell < Grid::Size);
+            REQUIRE(Grid::Quantize(-q) == cell);
+            error = fmax(error, angle(q, Grid::CellCenter(cell)));
+        }
+        REQUIRE(error <= Grid::MaxAngularError());
+        REQUIRE(error > 0.7 * Grid::MaxAngularError());
+    }
+
+    SECTION("Uniformity") {
+        using Coarse = RotationGrid<4, HAMILTON, double>;
+        size_t counts[Coarse::Size] = {};
+        const size_t samples = 1024 * Coarse::Size;
+        uint64_t state = 0x9E3779B97F4A7C15u;
+        for(size_t i = 0; i < samples; i++) {
+            counts[Coarse::Quantize(uniform(state))]++;
+        }
+        size_t lowest = samples, highest = 0;
+        for(size_t cell = 0; cell < Coarse::Size; cell++) {
+            lowest = counts[cell] < lowest ? counts[cell] : lowest;
+            highest = counts[cell] > highest ? counts[cell] : highest;
+        }
+        REQUIRE(lowest > 0);
+        REQUIRE(static_cast<double>(highest) / static_cast<double>(lowest) < 2.5);
+    }
+
+    SECTION("Neighbors") {
+        using Coarse = RotationGrid<4, HAMILTON, double>;
+        Coarse::Cell neighbors[Coarse::MaxNeighbors];
+        Coarse::Cell others[Coarse::MaxNeighbors];
+        for(Coarse::Cell cell = 0; cell < Coarse::Size; cell++) {
+            const size_t count = Coarse::Neighbors(cell, neighbors);
+            REQUIRE(count >= 18);
+            REQUIRE(count <= Coarse::MaxNeighbors);
+            for(size_t k = 0; k < count; k++) {
+                REQUIRE(neighbors[k] != cell);
+                REQUIRE(neighbors[k] < Coarse::Size);
+                for(size_t j = 0; j < k; j++) {
+                    REQUIRE(neighbors[j] != neighbors[k]);
+                }
+                // Adjacent cells are close, and adjacency is symmetric.
+                REQUIRE(angle(Coarse::CellCenter(cell), Coarse::CellCenter(neighbors[k])) < 2.5 * Coarse::MaxAngularError());
+                const size_t other_count = Coarse::Neighbors(neighbors[k], others);
+                bool found = false;
+                for(size_t j = 0; j < other_count; j++) {
+                    found |= others[j] == cell;
+                }
+                REQUIRE(found);
+            }
+        }
+
+        // The cell of a rotation near a boundary is adjacent to the cell of the rotation across it.
+        for(size_t i = 0; i < 5000; i++) {
+            const Quaternion<HAMILTON, double> q = sample(i);
+            const Quaternion<HAMILTON, double> p = q.boxplus(Vector3<double>{1e-3, -2e-3, 1e-3});
+            const Coarse::Cell a = Coarse::Quantize(q);
+            const Coarse::Cell b = Coarse::Quantize(p);
+            if(a != b) {
+                const size_t count = Coarse::Neighbors(a, neighbors);
+                bool found = false;
+                for(size_t k = 0; k < count; k++) {
+                    found |= neighbors[k] == b;
+                }
+                REQUIRE(found);
+            }
+        }
+    }
+
+    SECTION("Batch") {
+        float w[64], x[64], y[64], z[64], cw[64], cx[64], cy[64], cz[64];
+        const QuaternionBatch<JPL, float> q{w, x, y, z, 64};
+        for(size_t i = 0; i < 64; i++) {
+            const Quaternion<HAMILTON, double> s = sample(i);
+            q.set(i, Quaternion<JPL, float>{float(s.x()), float(s.y()), float(s.z()), float(s.w())});
+        }
+
+        using FloatGrid = RotationGrid<32, JPL, float>;
+        FloatGrid::Cell cells[64];
+        FloatGrid::Quantize(QuaternionBatch<JPL, const float>{w, x, y, z, 64}, cells);
+        FloatGrid::CellCenter(cells, QuaternionBatch<JPL, float>{cw, cx, cy, cz, 64});
+        for(size_t i = 0; i < 64; i++) {
+            REQUIRE(cells[i] == FloatGrid::Quantize(q[i]));
+            const Quaternion<JPL, float> center = FloatGrid::CellCenter(cells[i]);
+            REQUIRE((cw[i] == center.w() && cx[i] == center.x() && cy[i] == center.y() && cz[i] == center.z()));
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "random_rotations.hpp"
+
+using namespace tinyso3;
+
+namespace {
+RotationHashSet<HAMILTON, double>::Slot slots[1 << 13];
+} // namespace
+
+TEST_CASE("RotationHashSet") {
+    using Set = RotationHashSet<HAMILTON, double>;
+
+    SECTION("Deduplication against a linear scan") {
+        const double tolerance = 0.05;
+        Set set{slots, 1 << 13, tolerance};
+
+        // Clusters of nearby rotations, with random signs, straddling the tolerance.
+        uint64_t state = 0x9E3779B97F4A7C15u;
+        Quaternion<HAMILTON, double> kept[4096];
+        size_t count = 0;
+        for(size_t n = 0; n < 4000; n++) {
+            const Quaternion<HAMILTON, double> center = n % 4 == 0 || count == 0 ? uniform(state) : kept[n % count];
+            const Quaternion<HAMILTON, double> offset = uniform(state);
+            const double scale = 0.06 * static_cast<double>(n % 7) / 6.0;
+            Quaternion<HAMILTON, double> q = center.boxplus(Vector3<double>{offset.x() * scale, offset.y() * scale, offset.z() * scale});
+            q = n % 3 == 0 ? Quaternion<HAMILTON, double>{-q} : q;
+
+            size_t duplicate = count;
+            for(size_t i = 0; i < count && duplicate == count; i++) {
+                duplicate = angle(q, kept[i]) <= tolerance ? i : count;
+            }
+
+            const uint32_t id = set.insert(q);
+            if(duplicate == count) {
+                REQUIRE(id == count);
+                kept[count++] = q;
+            } else {
+                REQUIRE(id < count);
+                REQUIRE(angle(q, kept[id]) <= tolerance + 1e-12);
+            }
+            REQUIRE(set.size() == count);
+        }
+        REQUIRE(count > 1000);
+        REQUIRE(count < 4000);
+
+        for(size_t i = 0; i < count; i++) {
+            REQUIRE(set.find(kept[i]) == i);
+            REQUIRE(set.find(Quaternion<HAMILTON, double>{-kept[i]}) == i);
+        }
+    }
+
+    SECTION("Canonical sign") {
+        Set set{slots, 64, 0.01};
+        // Opposite signs of w, within 0.004 rad.
+        const Quaternion<HAMILTON, double> a = Quaternion<HAMILTON, double>{0.001, 1.0, 0.0, 0.0}.unit();
+        const Quaternion<HAMILTON, double> b = Quaternion<HAMILTON, double>{-0.001, 1.0, 0.0, 0.0}.unit();
+        REQUIRE(set.insert(a) == 0);
+        REQUIRE(set.find(b) == 0);
+        REQUIRE(set.insert(b) == 0);
+        REQUIRE_FALSE(set.contains(Quaternion<HAMILTON, double>{-0.02, 1.0, 0.0, 0.0}.unit()));
+    }
+
+    SECTION("Capacity") {
+        Set set{slots, 16, 1e-6};
+        uint64_t state = 1;
+        for(size_t i = 0; i < 12; i++) {
+            REQUIRE(set.insert(uniform(state)) == i);
+        }
+        REQUIRE(set.insert(uniform(state)) == Set::None);
+        REQUIRE(set.size() == 12);
+        set.clear();
+        REQUIRE(set.size() == 0);
+        REQUIRE(set.insert(uniform(state)) == 0);
+    }
+
+    SECTION("Smallest capacity") {
+        Set set{slots, 4, 0.01};
+        for(uint32_t i = 0; i < 3; i++) {
+            REQUIRE(set.insert(Quaternion<HAMILTON, double>::Exp(Vector3<double>{0.5 * i, 0.0, 0.0})) == i);
+        }
+        REQUIRE(set.insert(Quaternion<HAMILTON, double>::Exp(Vector3<double>{0.0, 0.5, 0.0})) == Set::None);
+        REQUIRE(set.find(Quaternion<HAMILTON, double>::Exp(Vector3<double>{0.0, 0.0, 0.5})) == Set::None);
+    }
+
+    SECTION("Batch") {
+        float w[8], x[8], y[8], z[8];
+        const QuaternionBatch<JPL, float> q{w, x, y, z, 8};
+        for(size_t i = 0; i < 8; i++) {
+            const float angle = 0.1f * static_cast<float>(i / 2) + 0.001f * static_cast<float>(i % 2);
+            q.set(i, Quaternion<JPL, float>{0.0f, 0.0f, sinf(angle / 2.0f), cosf(angle / 2.0f)});
+        }
+
+        static RotationHashSet<JPL, float>::Slot float_slots[64];
+        RotationHashSet<JPL, float> set{float_slots, 64, 0.01f};
+        uint32_t ids[8];
+        REQUIRE(set.insert(QuaternionBatch<JPL, const float>{w, x, y, z, 8}, ids) == 4);
+        const uint32_t expected[8] = {0, 0, 1, 1, 2, 2, 3, 3};
+        for(size_t i = 0; i < 8; i++) {
+            REQUIRE(ids[i] == expected[i]);
+        }
+    }
+}
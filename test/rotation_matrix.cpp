@@ -4,6 +4,27 @@
 
 using namespace tinyso3;
 
+namespace {
+// Largest difference of J from I + sign * K / 2 + (1 / theta^2 - (1 + cos(theta)) / (2 * theta * sin(theta))) * K^2 in long double.
+template<typename Type>
+double jacobianInverseError(const Vector3<Type>& phi, const SquareMatrix<3, Type>& J, long double sign) {
+    const Vector3<long double> phi_ld{static_cast<long double>(phi(0)), static_cast<long double>(phi(1)), static_cast<long double>(phi(2))};
+    const SquareMatrix<3, long double> K = phi_ld.hat();
+    const long double theta2 = phi_ld.dot(phi_ld);
+    const long double theta = sqrtl(theta2);
+    const long double coefficient = 1.0L / theta2 - (1.0L + cosl(theta)) / (2.0L * theta * sinl(theta));
+    const SquareMatrix<3, long double> reference = SquareMatrix<3, long double>::Identity() + K * (sign / 2.0L) + K * K * coefficient;
+
+    long double error = 0.0L;
+    for(size_t i = 0; i < 3; i++) {
+        for(size_t j = 0; j < 3; j++) {
+            error = fmaxl(error, fabsl(static_cast<long double>(J(i, j)) - reference(i, j)));
+        }
+    }
+    return static_cast<double>(error);
+}
+} // namespace
+
 TEST_CASE("RotationMatrix") {
     SECTION("Constructors") {
         RotationMatrix<ACTIVE, float> m0{};
@@ -276,4 +297,81 @@ TEST_CASE("RotationMatrix") {
             }
         }
     };
-}
\ No newline at end of file
+
+    SECTION("Jacobians") {
+        using R = RotationMatrix<ACTIVE, double>;
+        const double h = 1e-6;
+        const Vector3<double> phis[3] = {Vector3<double>{0.3, -0.7, 1.1}, Vector3<double>{1e-7, 2e-7, -1e-7}, Vector3<double>{0.0, 3.0, 0.5}};
+
+        for(const Vector3<double>& phi : phis) {
+            // Exp(phi + d) ~ Exp(phi) * Exp(Jr * d), Exp(phi + d) ~ Exp(Jl * d) * Exp(phi) by central differences
+            SquareMatrix<3, double> Jr_numerical, Jl_numerical;
+            for(size_t i = 0; i < 3; i++) {
+                Vector3<double> d{};
+                d(i) = h;
+                const R plus = R::Exp((phi + d).hat());
+                const R minus = R::Exp((phi - d).hat());
+                Jr_numerical.setCol(i, (minus.T() * plus).log().vee() / (2.0 * h));
+                Jl_numerical.setCol(i, (plus * minus.T()).log().vee() / (2.0 * h));
+            }
+
+            const SquareMatrix<3, double> Jr = R::RightJacobian(phi);
+            const SquareMatrix<3, double> Jl = R::LeftJacobian(phi);
+            REQUIRE((Jr - Jr_numerical).abs().max() < 1e-8);
+            REQUIRE((Jl - Jl_numerical).abs().max() < 1e-8);
+            REQUIRE((Jr * R::RightJacobianInverse(phi) - SquareMatrix<3, double>::Identity()).abs().max() < 1e-12);
+            REQUIRE((Jl * R::LeftJacobianInverse(phi) - SquareMatrix<3, double>::Identity()).abs().max() < 1e-12);
+
+            // Fused variants
+            SquareMatrix<3, double> Jr_fused, Jr_inverse_fused;
+            const R exp = R::ExpWithJacobian(phi.hat(), Jr_fused);
+            REQUIRE((exp - R::Exp(phi.hat())).abs().max() < 1e-15);
+            REQUIRE((Jr_fused - Jr).abs().max() < 1e-15);
+
+            const SquareMatrix<3, double> log = exp.logWithJacobian(Jr_inverse_fused);
+            REQUIRE((log.vee() - phi).norm() < 1e-9);
+            REQUIRE((Jr_inverse_fused - R::RightJacobianInverse(phi)).abs().max() < 1e-8);
+        }
+
+        // Small rotations are not truncated to the identity.
+        const RotationMatrix<ACTIVE, float> small = RotationMatrix<ACTIVE, float>::Exp(Vector3<float>{0.0f, 0.0f, 5e-5f}.hat());
+        REQUIRE_THAT(small(1, 0), Catch::Matchers::WithinRel(5e-5f, 1e-4f));
+        REQUIRE_THAT(small.log().vee()(2), Catch::Matchers::WithinRel(5e-5f, 1e-2f));
+    }
+
+    SECTION("Jacobian inverses at small angles") {
+        // Around both series cutoffs, theta ~ 0.064 in double and theta ~ 0.79 in float precision, and where 1 - cos(theta) cancels.
+        const double thetas[] = {1.01e-5, 2e-5, 1e-3, 0.06, 0.07, 0.5, 2.5};
+        for(const double theta : thetas) {
+            const Vector3<double> phi = Vector3<double>{0.36, -0.48, 0.8} * theta;
+            REQUIRE(jacobianInverseError(phi, RotationMatrix<ACTIVE, double>::RightJacobianInverse(phi), 1.0L) < 1e-15);
+            REQUIRE(jacobianInverseError(phi, RotationMatrix<ACTIVE, double>::LeftJacobianInverse(phi), -1.0L) < 1e-15);
+
+            SquareMatrix<3, double> Jr_inverse;
+            const Vector3<double> log = RotationMatrix<ACTIVE, double>::Exp(phi.hat()).logWithJacobian(Jr_inverse).vee();
+            REQUIRE(jacobianInverseError(log, Jr_inverse, 1.0L) < 1e-15);
+        }
+
+        const float thetas_float[] = {0.0101f, 0.1f, 0.75f, 0.82f, 2.5f};
+        for(const float theta : thetas_float) {
+            const Vector3<float> phi = Vector3<float>{0.36f, -0.48f, 0.8f} * theta;
+            REQUIRE(jacobianInverseError(phi, RotationMatrix<ACTIVE, float>::RightJacobianInverse(phi), 1.0L) < 1e-6);
+            REQUIRE(jacobianInverseError(phi, RotationMatrix<ACTIVE, float>::LeftJacobianInverse(phi), -1.0L) < 1e-6);
+        }
+    }
+
+    SECTION("Adjoint") {
+        const Vector3<double> phi{0.2, -0.4, 0.9};
+        const RotationMatrix<ACTIVE, double> R = RotationMatrix<ACTIVE, double>::Exp(Vector3<double>{1.0, 0.5, -0.3}.hat());
+        const RotationMatrix<ACTIVE, double> lhs = R * RotationMatrix<ACTIVE, double>::Exp(phi.hat()) * R.T();
+        const SquareMatrix<3, double> Ad = R.adjoint();
+        const Vector3<double> Ad_phi = Ad * phi;
+        REQUIRE((lhs - RotationMatrix<ACTIVE, double>::Exp(Ad_phi.hat())).abs().max() < 1e-12);
+
+        const RotationMatrix<PASSIVE, double> R_passive{R.T()};
+        REQUIRE((R_passive.adjoint() - Ad).abs().max() < 1e-15);
+
+        const Quaternion<HAMILTON, double> q{R};
+        REQUIRE((q.adjoint() - Ad).abs().max() < 1e-12);
+    }
+}
@@ -0,0 +1,94 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using namespace tinyso3;
+
+TEST_CASE("RotationMatrixInterpolator") {
+    SECTION("Matches RotationMatrix::interpolate") {
+        const RotationMatrix<ACTIVE, double> active_from{Euler<INTRINSIC, ZYX, double>{0.1, -0.4, 0.7}};
+        const RotationMatrix<ACTIVE, double> active_to{Euler<INTRINSIC, ZYX, double>{-1.2, 0.3, 2.1}};
+        const RotationMatrixInterpolator<ACTIVE, double> active_interpolator{active_from, active_to};
+
+        const RotationMatrix<PASSIVE, double> passive_from{Euler<INTRINSIC, ZYX, double>{0.1, -0.4, 0.7}};
+        const RotationMatrix<PASSIVE, double> passive_to{Euler<INTRINSIC, ZYX, double>{-1.2, 0.3, 2.1}};
+        const RotationMatrixInterpolator<PASSIVE, double> passive_interpolator{passive_from, passive_to};
+
+        for(double t = 0.0; t <= 1.0; t += 0.125) {
+            const RotationMatrix<ACTIVE, double> active = active_interpolator(t);
+            const RotationMatrix<ACTIVE, double> active_compare = active_from.interpolate(active_to, t);
+            const RotationMatrix<PASSIVE, double> passive = passive_interpolator(t);
+            const RotationMatrix<PASSIVE, double> passive_compare = passive_from.interpolate(passive_to, t);
+
+            for(size_t i = 0; i < 3; i++) {
+                for(size_t j = 0; j < 3; j++) {
+                    REQUIRE_THAT(active(i, j), Catch::Matchers::WithinAbs(active_compare(i, j), 1e-12));
+                    REQUIRE_THAT(passive(i, j), Catch::Matchers::WithinAbs(passive_compare(i, j), 1e-12));
+                }
+            }
+        }
+
+        const RotationMatrix<ACTIVE, double> active_end = active_interpolator(1.0);
+        for(size_t i = 0; i < 3; i++) {
+            for(size_t j = 0; j < 3; j++) {
+                REQUIRE_THAT(active_end(i, j), Catch::Matchers::WithinAbs(active_to(i, j), 1e-12));
+            }
+        }
+    }
+
+    SECTION("Identity and near pi") {
+        const RotationMatrix<ACTIVE, float> from = RotationMatrix<ACTIVE, float>::RotatePrincipalAxis<Y>(0.3f);
+        const RotationMatrixInterpolator<ACTIVE, float> same{from, from};
+        REQUIRE(same.angle() == 0.0f);
+
+        const RotationMatrix<ACTIVE, float> same_half = same(0.5f);
+        for(size_t i = 0; i < 3; i++) {
+            for(size_t j = 0; j < 3; j++) {
+                REQUIRE_THAT(same_half(i, j), Catch::Matchers::WithinAbs(from(i, j), 1e-6f));
+            }
+        }
+
+        // Relative rotation of (pi - 1e-4) about a skewed axis, where the antisymmetric part is nearly zero.
+        const Vector3<double> axis = Vector3<double>{1.0, -2.0, 0.5}.unit();
+        const double angle = M_PI - 1e-4;
+        const RotationMatrix<ACTIVE, double> identity{};
+        const RotationMatrix<ACTIVE, double> to{AxisAngle<double>{axis, angle}};
+        const RotationMatrixInterpolator<ACTIVE, double> interpolator{identity, to};
+
+        REQUIRE_THAT(interpolator.angle(), Catch::Matchers::WithinAbs(angle, 1e-9));
+        REQUIRE_THAT(interpolator.axis()(0), Catch::Matchers::WithinAbs(axis(0), 1e-9));
+        REQUIRE_THAT(interpolator.axis()(1), Catch::Matchers::WithinAbs(axis(1), 1e-9));
+        REQUIRE_THAT(interpolator.axis()(2), Catch::Matchers::WithinAbs(axis(2), 1e-9));
+
+        const RotationMatrix<ACTIVE, double> half = interpolator(0.5);
+        const RotationMatrix<ACTIVE, double> half_compare{AxisAngle<double>{axis, angle / 2.0}};
+        for(size_t i = 0; i < 3; i++) {
+            for(size_t j = 0; j < 3; j++) {
+                REQUIRE_THAT(half(i, j), Catch::Matchers::WithinAbs(half_compare(i, j), 1e-9));
+            }
+        }
+    }
+
+    SECTION("Batch evaluation") {
+        const RotationMatrix<PASSIVE, float> from = RotationMatrix<PASSIVE, float>::RotatePrincipalAxis<Z>(-0.5f);
+        const RotationMatrix<PASSIVE, float> to{Euler<EXTRINSIC, XYZ, float>{0.4f, 0.9f, -0.2f}};
+        const RotationMatrixInterpolator<PASSIVE, float> interpolator{from, to};
+
+        float t[8];
+        RotationMatrix<PASSIVE, float> out[8];
+        for(size_t k = 0; k < 8; k++) {
+            t[k] = static_cast<float>(k) / 7.0f;
+        }
+
+        interpolator(t, out, 8);
+
+        for(size_t k = 0; k < 8; k++) {
+            const RotationMatrix<PASSIVE, float> compare = interpolator(t[k]);
+            for(size_t i = 0; i < 3; i++) {
+                for(size_t j = 0; j < 3; j++) {
+                    REQUIRE(out[k](i, j) == compare(i, j));
+                }
+            }
+        }
+    }
+}
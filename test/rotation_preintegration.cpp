@@ -0,0 +1,86 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using namespace tinyso3;
+
+namespace {
+AngularVelocity<double> measurement(size_t k) {
+    const double t = static_cast<double>(k) * 0.001;
+    return AngularVelocity<double>{0.4 * sin(3.0 * t), -0.8 + 0.3 * cos(2.0 * t), 1.1 * sin(t + 0.3)};
+}
+
+template<typename RotationMatrixConvention>
+RotationPreintegration<RotationMatrixConvention, double> integrate(const Vector3<double>& bias, size_t count) {
+    RotationPreintegration<RotationMatrixConvention, double> preintegration{bias, 1e-3};
+    for(size_t k = 0; k < count; k++) {
+        preintegration.integrate(measurement(k), 0.001);
+    }
+    return preintegration;
+}
+
+double angularDistance(const RotationMatrix<ACTIVE, double>& R1, const RotationMatrix<ACTIVE, double>& R2) {
+    return (R1.T() * R2).log().vee().norm();
+}
+} // namespace
+
+TEST_CASE("RotationPreintegration") {
+    SECTION("Constant angular velocity") {
+        const Vector3<double> bias{0.01, -0.02, 0.03};
+        const AngularVelocity<double> w{0.3, -0.5, 0.9};
+        RotationPreintegration<ACTIVE, double> preintegration{bias, 1e-3};
+        for(size_t k = 0; k < 1000; k++) {
+            preintegration.integrate(w, 0.001);
+        }
+
+        const RotationMatrix<ACTIVE, double> expected = RotationMatrix<ACTIVE, double>::Exp((w - bias).hat());
+        REQUIRE(angularDistance(preintegration.deltaRotation(), expected) < 1e-10);
+        REQUIRE_THAT(preintegration.deltaTime(), Catch::Matchers::WithinAbs(1.0, 1e-12));
+    }
+
+    SECTION("Bias correction") {
+        const Vector3<double> bias{0.01, -0.02, 0.03};
+        const Vector3<double> updated = bias + Vector3<double>{2e-3, 1e-3, -3e-3};
+
+        const RotationPreintegration<ACTIVE, double> preintegration = integrate<ACTIVE>(bias, 1000);
+        const RotationMatrix<ACTIVE, double> reintegrated = integrate<ACTIVE>(updated, 1000).deltaRotation();
+
+        const double uncorrected = angularDistance(preintegration.deltaRotation(), reintegrated);
+        const double corrected = angularDistance(preintegration.deltaRotation(updated), reintegrated);
+        REQUIRE(corrected < uncorrected / 100.0);
+
+        // PASSIVE is the transpose of ACTIVE.
+        const RotationPreintegration<PASSIVE, double> passive = integrate<PASSIVE>(bias, 1000);
+        REQUIRE((passive.deltaRotation(updated) - preintegration.deltaRotation(updated).T()).abs().max() < 1e-15);
+    }
+
+    SECTION("Covariance") {
+        // Without rotation, the covariance is sigma^2 * T * I.
+        RotationPreintegration<ACTIVE, double> preintegration{Vector3<double>{}, 1e-2};
+        for(size_t k = 0; k < 500; k++) {
+            preintegration.integrate(AngularVelocity<double>{0.0, 0.0, 0.0}, 0.002);
+        }
+
+        const SquareMatrix<3, double> expected = SquareMatrix<3, double>::Identity() * (1e-4 * 1.0);
+        REQUIRE((preintegration.covariance() - expected).abs().max() < 1e-15);
+
+        // With rotation, it stays symmetric and its trace is preserved by the similarity transforms.
+        const RotationPreintegration<ACTIVE, double> rotating = integrate<ACTIVE>(Vector3<double>{}, 1000);
+        REQUIRE((rotating.covariance() - rotating.covariance().T()).abs().max() < 1e-18);
+        REQUIRE_THAT(rotating.covariance().trace(), Catch::Matchers::WithinRel(3.0 * 1e-6, 1e-3));
+
+        preintegration.reset(Vector3<double>{});
+        REQUIRE(preintegration.deltaTime() == 0.0);
+        REQUIRE(preintegration.covariance().abs().max() == 0.0);
+    }
+
+    SECTION("Small increments in single precision") {
+        // Increments below epsilon<float>() must not be dropped.
+        RotationPreintegration<ACTIVE, float> preintegration{Vector3<float>{}, 1e-3f};
+        for(size_t k = 0; k < 1000; k++) {
+            preintegration.integrate(AngularVelocity<float>{0.0f, 0.0f, 0.05f}, 0.001f);
+        }
+
+        REQUIRE_THAT(preintegration.deltaRotation()(1, 0), Catch::Matchers::WithinAbs(sin(0.05f), 1e-5f));
+    }
+}
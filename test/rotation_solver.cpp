@@ -0,0 +1,136 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using namespace tinyso3;
+
+namespace {
+// Vector alignment (Wahba's problem), r_i = R * v_i - u_i
+template<typename RotationMatrixConvention>
+struct Alignment {
+    const Vector3<double>* v;
+    const Vector3<double>* u;
+    size_t count;
+
+    size_t size() const { return count; }
+
+    void operator()(const RotationMatrix<RotationMatrixConvention, double>& R, size_t begin, size_t end, Vector3<double>* residuals, SquareMatrix<3, double>* jacobians) const {
+        for(size_t i = begin; i < end; i++) {
+            const Vector3<double> Rv = R * v[i];
+            residuals[i - begin] = Rv - u[i];
+            if(jacobians != nullptr) {
+                // ACTIVE : d(R * Exp(d^) * v) = -R * v^ * d, PASSIVE : d(Exp(-d^) * R * v) = (R * v)^ * d
+                jacobians[i - begin] = is_same<RotationMatrixConvention, ACTIVE>::value ? SquareMatrix<3, double>{-(R * v[i].hat())} : Rv.hat();
+            }
+        }
+    }
+};
+
+// Rotation averaging, r_i = log(R_i^T * R)
+struct Averaging {
+    const RotationMatrix<ACTIVE, double>* rotations;
+    size_t count;
+
+    size_t size() const { return count; }
+
+    void operator()(const RotationMatrix<ACTIVE, double>& R, size_t begin, size_t end, Vector3<double>* residuals, SquareMatrix<3, double>* jacobians) const {
+        for(size_t i = begin; i < end; i++) {
+            SquareMatrix<3, double> right_jacobian_inverse;
+            residuals[i - begin] = (rotations[i].T() * R).logWithJacobian(right_jacobian_inverse).vee();
+            if(jacobians != nullptr) {
+                jacobians[i - begin] = right_jacobian_inverse;
+            }
+        }
+    }
+};
+
+double angularDistance(const RotationMatrix<ACTIVE, double>& R1, const RotationMatrix<ACTIVE, double>& R2) {
+    return (R1.T() * R2).log().vee().norm();
+}
+} // namespace
+
+TEST_CASE("RotationSolver") {
+    const RotationMatrix<ACTIVE, double> truth = RotationMatrix<ACTIVE, double>::Exp(Vector3<double>{0.4, -1.2, 2.0}.hat());
+
+    const size_t N = 37;
+    Vector3<double> v[N], u[N];
+    for(size_t i = 0; i < N; i++) {
+        const double s = static_cast<double>(i);
+        v[i] = Vector3<double>{sin(s), cos(1.3 * s), sin(0.7 * s + 1.0)};
+        u[i] = truth * v[i];
+    }
+
+    SECTION("Gauss-Newton and Levenberg-Marquardt") {
+        const Alignment<ACTIVE> problem{v, u, N};
+
+        RotationSolver<ACTIVE, double>::Options options;
+        options.method = Optimization::GAUSS_NEWTON;
+        RotationSolver<ACTIVE, double> gauss_newton{options};
+        const RotationMatrix<ACTIVE, double> gn = gauss_newton.solve(problem, RotationMatrix<ACTIVE, double>::Identity());
+
+        RotationSolver<ACTIVE, double, 4> levenberg_marquardt;
+        const RotationMatrix<ACTIVE, double> lm = levenberg_marquardt.solve(problem, RotationMatrix<ACTIVE, double>::Identity());
+
+        REQUIRE(angularDistance(gn, truth) < 1e-9);
+        REQUIRE(angularDistance(lm, truth) < 1e-9);
+        REQUIRE(gauss_newton.statistics().converged);
+        REQUIRE(levenberg_marquardt.statistics().converged);
+        REQUIRE(levenberg_marquardt.statistics().final_cost < 1e-18);
+        REQUIRE(levenberg_marquardt.statistics().initial_cost > 1.0);
+        REQUIRE(levenberg_marquardt.statistics().iterations < 20);
+        REQUIRE(levenberg_marquardt.statistics().evaluations % N == 0);
+    }
+
+    SECTION("Rank deficient") {
+        // A single observation leaves the rotation about it unobserved, with or without a zero diagonal in J^T J.
+        const Vector3<double> observed[2] = {Vector3<double>{1.0, 0.0, 0.0}, Vector3<double>{0.6, 0.0, 0.8}};
+        const Optimization methods[2] = {Optimization::GAUSS_NEWTON, Optimization::LEVENBERG_MARQUARDT};
+        for(size_t k = 0; k < 2; k++) {
+            const Vector3<double> target = truth * observed[k];
+            const Alignment<ACTIVE> problem{&observed[k], &target, 1};
+
+            for(Optimization method : methods) {
+                RotationSolver<ACTIVE, double>::Options options;
+                options.method = method;
+                RotationSolver<ACTIVE, double> solver{options};
+                const RotationMatrix<ACTIVE, double> R = solver.solve(problem, RotationMatrix<ACTIVE, double>::Identity());
+
+                REQUIRE(R.isfinite());
+                REQUIRE(solver.statistics().initial_cost > 0.1);
+                REQUIRE(solver.statistics().final_cost < 1e-18);
+                REQUIRE(Vector3<double>{R * observed[k] - target}.norm() < 1e-9);
+            }
+        }
+    }
+
+    SECTION("PASSIVE") {
+        const RotationMatrix<PASSIVE, double> truth_passive{truth};
+        Vector3<double> u_passive[N];
+        for(size_t i = 0; i < N; i++) {
+            u_passive[i] = truth_passive * v[i];
+        }
+
+        const Alignment<PASSIVE> problem{v, u_passive, N};
+        RotationSolver<PASSIVE, double> solver;
+        const RotationMatrix<PASSIVE, double> R = solver.solve(problem, RotationMatrix<PASSIVE, double>::Identity());
+        REQUIRE((R - truth_passive).abs().max() < 1e-9);
+    }
+
+    SECTION("Rotation averaging") {
+        RotationMatrix<ACTIVE, double> rotations[N];
+        Vector3<double> sum{};
+        for(size_t i = 0; i < N; i++) {
+            const Vector3<double> noise = v[i] * 0.05;
+            rotations[i] = truth * RotationMatrix<ACTIVE, double>::Exp(noise.hat());
+            sum += noise;
+        }
+
+        const Averaging problem{rotations, N};
+        RotationSolver<ACTIVE, double> solver;
+        const RotationMatrix<ACTIVE, double> R = solver.solve(problem, rotations[0]);
+
+        // The gradient vanishes at the solution, and it lies close to the mean perturbation.
+        REQUIRE(solver.statistics().converged);
+        REQUIRE(angularDistance(R, truth * RotationMatrix<ACTIVE, double>::Exp((sum / static_cast<double>(N)).hat())) < 1e-3);
+    }
+}
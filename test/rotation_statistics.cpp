@@ -0,0 +1,137 @@
+#include <tinyso3/tinyso3.hpp>
+#include <tinyso3/ThreadPool.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace tinyso3;
+
+namespace {
+// Rotations scattered about a center with a xorshift generator.
+void scatter(const QuaternionBatch<HAMILTON, double>& q, const Quaternion<HAMILTON, double>& center, double spread) {
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    for(size_t i = 0; i < q.size(); i++) {
+        double u[3];
+        for(size_t k = 0; k < 3; k++) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            u[k] = static_cast<double>(state >> 11) / 9007199254740992.0 - 0.5;
+        }
+        const Quaternion<HAMILTON, double> r = center.boxplus(Vector3<double>{u[0], u[1], u[2]} * (2.0 * spread));
+        q.set(i, i % 3 == 0 ? Quaternion<HAMILTON, double>{-r} : r);
+    }
+}
+
+bool identical(const SquareMatrix<3, double>& a, const SquareMatrix<3, double>& b) {
+    for(size_t i = 0; i < 3; i++) {
+        for(size_t j = 0; j < 3; j++) {
+            if(a(i, j) != b(i, j)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("RotationStatistics") {
+    using Statistics = RotationStatistics<HAMILTON, double>;
+    const size_t count = 10000;
+    std::vector<double> w(count), x(count), y(count), z(count);
+    const QuaternionBatch<HAMILTON, double> batch{w.data(), x.data(), y.data(), z.data(), count};
+    const QuaternionBatch<HAMILTON, const double> q{batch};
+    const Quaternion<HAMILTON, double> center = Quaternion<HAMILTON, double>::Exp(Vector3<double>{0.4, -1.1, 0.7});
+
+    SECTION("Chordal mean and covariance") {
+        scatter(batch, center, 0.1);
+        const Quaternion<HAMILTON, double> mean = Statistics::ChordalMean(q);
+        REQUIRE(mean.boxminus(center).norm() < 3e-3);
+
+        // Uniform in [-0.1, 0.1] per axis, variance 0.1^2 / 3.
+        const SquareMatrix<3, double> covariance = Statistics::Covariance(q, mean);
+        for(size_t i = 0; i < 3; i++) {
+            REQUIRE(fabs(covariance(i, i) - 0.01 / 3.0) < 4e-4);
+            REQUIRE(fabs(covariance(i, (i + 1) % 3)) < 4e-4);
+        }
+
+        // Sign of q does not matter.
+        const Quaternion<HAMILTON, double> one = Statistics::ChordalMean(q.slice(1, 1));
+        REQUIRE(one.boxminus(q[1]).norm() < 1e-12);
+        REQUIRE(Statistics::ChordalMean(q.slice(0, 0)).w() == 1.0);
+    }
+
+    SECTION("Identical for any partition over threads") {
+        scatter(batch, center, 1.0);
+        const Statistics::SumType serial = Statistics::RotationSum(q);
+        const Quaternion<HAMILTON, double> mean = Statistics::ChordalMean(serial);
+        const Statistics::SumType serial_scatter = Statistics::ScatterSum(q, mean);
+
+        auto merge = [](Statistics::SumType a, const Statistics::SumType& b) {
+            a.merge(b);
+            return a;
+        };
+        for(size_t threads = 1; threads <= 5; threads++) {
+            ThreadPool pool{threads};
+            const Statistics::SumType sum = pool.parallelReduce(
+              count, Statistics::SumType{}, [&](size_t begin, size_t end) { return Statistics::RotationSum(q, begin, end); }, merge,
+              Statistics::LeafSize, Chunking::DETERMINISTIC);
+            REQUIRE(identical(sum.value(), serial.value()));
+            REQUIRE(sum.count() == count);
+
+            const Statistics::SumType scatter_sum = pool.parallelReduce(
+              count, Statistics::SumType{}, [&](size_t begin, size_t end) { return Statistics::ScatterSum(q, mean, begin, end); }, merge,
+              Statistics::LeafSize, Chunking::DETERMINISTIC);
+            REQUIRE(identical(scatter_sum.value(), serial_scatter.value()));
+        }
+
+        // Leaves computed in reverse order and combined.
+        Statistics::SumType leaves[(count + Statistics::LeafSize - 1) / Statistics::LeafSize];
+        const size_t n = ReductionTree<Statistics::SumType>::Leaves(count, Statistics::LeafSize);
+        for(size_t leaf = n; leaf-- > 0;) {
+            size_t begin, end;
+            ReductionTree<Statistics::SumType>::Range(leaf, count, Statistics::LeafSize, begin, end);
+            leaves[leaf] = Statistics::RotationSum(q, begin, end);
+        }
+        REQUIRE(identical(ReductionTree<Statistics::SumType>::Combine(leaves, n).value(), serial.value()));
+    }
+
+    SECTION("Reflected and rank deficient sums") {
+        using Q = Quaternion<HAMILTON, double>;
+        const Q identity{};
+        const Q x_pi = Q::RotatePrincipalAxis<X>(M_PI);
+        const Q y_pi = Q::RotatePrincipalAxis<Y>(M_PI);
+        const Q z_pi = Q::RotatePrincipalAxis<Z>(M_PI);
+        auto mean = [&](const Q* rotations, size_t n) {
+            for(size_t i = 0; i < n; i++) {
+                batch.set(i, rotations[i]);
+            }
+            return Statistics::ChordalMean(q.slice(0, n));
+        };
+
+        // Sum diag(1, 1, -1), det < 0, every mean reaches trace(R^T sum) = 1, the polar factor is a reflection.
+        const Q reflected[3] = {identity, x_pi, y_pi};
+        const Q m = mean(reflected, 3);
+        REQUIRE(fabs(m.norm() - 1.0) < 1e-12);
+        const SquareMatrix<3, double> sum = Statistics::RotationSum(q.slice(0, 3)).value();
+        REQUIRE(fabs((RotationMatrix<ACTIVE, double>{m}.T() * sum).trace() - 1.0) < 1e-12);
+
+        // Sum diag(2, 2, 0) of rank two, the identity.
+        const Q rank_two[4] = {identity, identity, x_pi, y_pi};
+        REQUIRE(mean(rank_two, 4).boxminus(identity).norm() < 1e-12);
+
+        // Sum of rank two with a rotation about z, Rz(0.15).
+        const Q rank_two_rotated[4] = {x_pi, y_pi, identity, Q::RotatePrincipalAxis<Z>(0.3)};
+        REQUIRE(mean(rank_two_rotated, 4).boxminus(Q::RotatePrincipalAxis<Z>(0.15)).norm() < 1e-12);
+
+        // Sum diag(2, 0, 0) of rank one, every rotation about x is a mean, the identity rotates least.
+        const Q rank_one[2] = {identity, x_pi};
+        REQUIRE(mean(rank_one, 2).boxminus(identity).norm() < 1e-12);
+
+        // Sum diag(0, 0, 2) of rank one, rotated by Ry(pi / 2) on the left, the mean rotates least from z to x.
+        const Q rank_one_rotated[2] = {Q::RotatePrincipalAxis<Y>(M_PI / 2.0) * Q::RotatePrincipalAxis<Z>(M_PI / 2.0), Q::RotatePrincipalAxis<Y>(M_PI / 2.0) * Q::RotatePrincipalAxis<Z>(-M_PI / 2.0)};
+        REQUIRE(mean(rank_one_rotated, 2).boxminus(Q::RotatePrincipalAxis<Y>(M_PI / 2.0)).norm() < 1e-12);
+
+        // Zero sum, the identity.
+        const Q zero[4] = {identity, x_pi, y_pi, z_pi};
+        REQUIRE(mean(zero, 4).boxminus(identity).norm() < 1e-12);
+    }
+}
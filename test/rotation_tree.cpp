@@ -0,0 +1,120 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "random_rotations.hpp"
+
+#include <string.h>
+
+using namespace tinyso3;
+
+namespace {
+const size_t kCount = 2000;
+
+double w[kCount], x[kCount], y[kCount], z[kCount];
+RotationTree<HAMILTON, double>::Node nodes[kCount], parallel_nodes[kCount];
+} // namespace
+
+TEST_CASE("RotationTree") {
+    using Tree = RotationTree<HAMILTON, double>;
+
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    const QuaternionBatch<HAMILTON, double> points{w, x, y, z, kCount};
+    for(size_t i = 0; i < kCount; i++) {
+        // Random signs, the tree identifies q and -q.
+        const Quaternion<HAMILTON, double> q = uniform(state);
+        points.set(i, i % 3 == 0 ? Quaternion<HAMILTON, double>{-q} : q);
+    }
+    // Duplicates.
+    points.set(7, points[3]);
+    points.set(11, Quaternion<HAMILTON, double>{-points[3]});
+
+    Tree tree{nodes, kCount};
+    tree.build(points);
+
+    SECTION("Nearest") {
+        Tree::Neighbor neighbors[10];
+        for(size_t n = 0; n < 200; n++) {
+            const Quaternion<HAMILTON, double> q = n < 10 ? points[n].boxplus(Vector3<double>{1e-4, 0.0, -1e-4}) : uniform(state);
+            REQUIRE(tree.nearest(q, 10, neighbors) == 10);
+
+            // Against a linear scan, the k-th smallest angle.
+            double angles[kCount];
+            for(size_t i = 0; i < kCount; i++) {
+                angles[i] = angle(q, points[i]);
+            }
+            for(size_t k = 0; k < 10; k++) {
+                size_t below = 0;
+                for(size_t i = 0; i < kCount; i++) {
+                    below += angles[i] < neighbors[k].angle - 1e-9 ? 1u : 0u;
+                }
+                REQUIRE(below <= k);
+                REQUIRE_THAT(neighbors[k].angle, Catch::Matchers::WithinAbs(angles[neighbors[k].index], 1e-9));
+                REQUIRE((k == 0 || neighbors[k - 1].angle <= neighbors[k].angle));
+            }
+
+            // Antipodal query.
+            Tree::Neighbor antipodal[10];
+            tree.nearest(Quaternion<HAMILTON, double>{-q}, 10, antipodal);
+            REQUIRE(antipodal[0].index == neighbors[0].index);
+        }
+
+        REQUIRE(tree.nearest(points[3], 3, neighbors) == 3);
+        REQUIRE(neighbors[2].angle < 1e-7);
+        REQUIRE(tree.nearest(points[0], 0, nullptr) == 0);
+    }
+
+    SECTION("Radius") {
+        Tree::Neighbor neighbors[kCount];
+        for(size_t n = 0; n < 100; n++) {
+            const Quaternion<HAMILTON, double> q = uniform(state);
+            const double radius = 0.05 + 0.01 * static_cast<double>(n);
+            const size_t count = tree.radius(q, radius, neighbors, kCount);
+
+            size_t expected = 0;
+            for(size_t i = 0; i < kCount; i++) {
+                expected += angle(q, points[i]) <= radius ? 1u : 0u;
+            }
+            REQUIRE(count == expected);
+            for(size_t k = 0; k < count; k++) {
+                REQUIRE(neighbors[k].angle <= radius + 1e-12);
+            }
+            REQUIRE(tree.radius(q, radius, neighbors, 2) == count);
+        }
+        REQUIRE(tree.radius(points[5], M_PI, neighbors, kCount) == kCount);
+    }
+
+    SECTION("Parallel construction") {
+        Tree parallel{parallel_nodes, kCount};
+        Tree::Subtree subtrees[8];
+        const size_t count = parallel.buildTop(points, 3, subtrees);
+        REQUIRE(count == 8);
+        size_t total = 0;
+        for(size_t i = count; i > 0; i--) {
+            parallel.buildSubtree(subtrees[i - 1]);
+            total += subtrees[i - 1].end - subtrees[i - 1].begin;
+        }
+        REQUIRE(total == kCount - 7);
+        REQUIRE(memcmp(nodes, parallel_nodes, sizeof(nodes)) == 0);
+    }
+
+    SECTION("Batch") {
+        float fw[kCount], fx[kCount], fy[kCount], fz[kCount];
+        for(size_t i = 0; i < kCount; i++) {
+            fw[i] = float(w[i]), fx[i] = float(x[i]), fy[i] = float(y[i]), fz[i] = float(z[i]);
+        }
+        static RotationTree<JPL, float>::Node float_nodes[kCount];
+        RotationTree<JPL, float> float_tree{float_nodes, kCount};
+        float_tree.build(QuaternionBatch<JPL, const float>{fw, fx, fy, fz, kCount});
+
+        RotationTree<JPL, float>::Neighbor batch[16 * 4], single[4];
+        float_tree.nearest(QuaternionBatch<JPL, const float>{fw, fx, fy, fz, 16}, 4, batch);
+        for(size_t i = 0; i < 16; i++) {
+            float_tree.nearest(Quaternion<JPL, float>{fx[i], fy[i], fz[i], fw[i]}, 4, single);
+            REQUIRE(batch[4 * i].angle == 0.0f);
+            for(size_t k = 0; k < 4; k++) {
+                REQUIRE((batch[4 * i + k].index == single[k].index && batch[4 * i + k].angle == single[k].angle));
+            }
+        }
+    }
+}
@@ -0,0 +1,163 @@
+#include <tinyso3/tinyso3.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace tinyso3;
+
+namespace {
+template<typename Type>
+bool parse(const char* text, Type& value) {
+    const char* cursor = text;
+    return TextFormat<Type>::Parse(cursor, text + strlen(text), value) && *cursor == '\0';
+}
+
+template<typename Type>
+const char* format(const Type& value, char* out) {
+    out[TextFormat<Type>::Format(value, out)] = '\0';
+    return out;
+}
+
+uint64_t next(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+} // namespace
+
+TEST_CASE("TextFormat Format") {
+    char out[TextFormatd::MaxLength + 1];
+    CHECK(strcmp(format(0.0, out), "0") == 0);
+    CHECK(strcmp(format(-0.0, out), "-0") == 0);
+    CHECK(strcmp(format(1.0, out), "1") == 0);
+    CHECK(strcmp(format(0.125, out), "0.125") == 0);
+    CHECK(strcmp(format(0.1, out), "0.1") == 0);
+    CHECK(strcmp(format(-1.5, out), "-1.5") == 0);
+    CHECK(strcmp(format(123456.0, out), "123456") == 0);
+    CHECK(strcmp(format(1e-7, out), "1e-07") == 0);
+    CHECK(strcmp(format(1.2345e30, out), "1.2345e+30") == 0);
+    CHECK(strcmp(format(1e21, out), "1e+21") == 0);
+    CHECK(strcmp(format(0.000001, out), "0.000001") == 0);
+    CHECK(strcmp(format(1.7976931348623157e308, out), "1.7976931348623157e+308") == 0);
+    CHECK(strcmp(format(5e-324, out), "5e-324") == 0);
+    CHECK(strcmp(format(static_cast<double>(INFINITY), out), "inf") == 0);
+    CHECK(strcmp(format(-static_cast<double>(INFINITY), out), "-inf") == 0);
+    CHECK(strcmp(format(static_cast<double>(NAN), out), "nan") == 0);
+
+    CHECK(strcmp(format(0.1f, out), "0.1") == 0);
+    CHECK(strcmp(format(3.4028235e38f, out), "3.4028235e+38") == 0);
+
+    Quaternion<HAMILTON, double> q{0.5, -0.5, 0.25, 1.0};
+    out[TextFormatd::Format(q, out, ';')] = '\0';
+    CHECK(strcmp(out, "0.5;-0.5;0.25;1") == 0);
+}
+
+TEST_CASE("TextFormat Parse") {
+    double d = 0.0;
+    CHECK((parse("0.1", d) && d == 0.1));
+    CHECK((parse("-2.5e-3", d) && d == -2.5e-3));
+    CHECK((parse("+7E2", d) && d == 700.0));
+    CHECK((parse(".5", d) && d == 0.5));
+    CHECK((parse("1.", d) && d == 1.0));
+    CHECK((parse("2.2250738585072011e-308", d) && d == 2.2250738585072011e-308));
+    CHECK((parse("4.9406564584124654e-324", d) && d == 5e-324));
+    CHECK((parse("2e-324", d) && d == 0.0));
+    CHECK((parse("1e309", d) && isinf(d)));
+    CHECK((parse("Infinity", d) && isinf(d) && d > 0.0));
+    CHECK((parse("-inf", d) && isinf(d) && d < 0.0));
+    CHECK((parse("NaN", d) && isnan(d)));
+    // Halfway between 1 and the next double, followed by a nonzero digit far beyond the fast path.
+    CHECK((parse("1.00000000000000011102230246251565404236316680908203125000000001", d) && d == 1.0000000000000002));
+    CHECK((parse("1.00000000000000011102230246251565404236316680908203125", d) && d == 1.0));
+    // Just above and below the halfway point 2^-1075 between 0 and the smallest subnormal, beyond 19 digits.
+    CHECK((parse("2.4703282292062327208828439643411068618252990131001e-324", d) && d == 5e-324));
+    CHECK((parse("2.47032822920623272088284396434110686182529901307163e-324", d) && d == 5e-324));
+    CHECK((parse("2.47032822920623272088284396434110686182529901307162e-324", d) && d == 0.0));
+
+    float f = 0.0f;
+    CHECK((parse("0.1", f) && f == 0.1f));
+    CHECK((parse("16777217", f) && f == 16777216.0f));
+    CHECK((parse("1e-46", f) && f == 0.0f));
+    CHECK((parse("7.00649232162408535461864791644958065640130970938258e-46", f) && f == 1e-45f));
+    CHECK((parse("7.00649232162408535461864791644958065640130970938257e-46", f) && f == 0.0f));
+
+    const char* text = "x";
+    const char* cursor = text;
+    d = 3.0;
+    CHECK_FALSE(TextFormatd::Parse(cursor, text + 1, d));
+    CHECK((cursor == text && d == 3.0));
+    text = "-e5";
+    cursor = text;
+    CHECK_FALSE(TextFormatd::Parse(cursor, text + 3, d));
+
+    // Parsing stops at end and at the first character not part of the number.
+    text = "1.25e3,4";
+    cursor = text;
+    CHECK((TextFormatd::Parse(cursor, text + 6, d) && d == 1250.0 && cursor == text + 6));
+    cursor = text;
+    CHECK((TextFormatd::Parse(cursor, text + 3, d) && d == 1.2 && cursor == text + 3));
+
+    text = "1, 2 ,\t3";
+    cursor = text;
+    Vector3<double> v;
+    CHECK((TextFormatd::Parse(cursor, text + strlen(text), v) && v(0) == 1.0 && v(1) == 2.0 && v(2) == 3.0));
+    text = "1,2,";
+    cursor = text;
+    CHECK_FALSE(TextFormatd::Parse(cursor, text + strlen(text), v));
+}
+
+TEST_CASE("TextFormat round trip") {
+    char out[TextFormatd::MaxLength + 1];
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    for(int i = 0; i < 100000; i++) {
+        uint64_t bits = next(state);
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        if(isnan(value)) {
+            continue;
+        }
+        double parsed = 0.0;
+        REQUIRE(parse(format(value, out), parsed));
+        REQUIRE(memcmp(&parsed, &value, sizeof(value)) == 0);
+        REQUIRE(strtod(out, nullptr) == value);
+    }
+    for(int i = 0; i < 100000; i++) {
+        uint32_t bits = static_cast<uint32_t>(next(state));
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        if(isnan(value)) {
+            continue;
+        }
+        float parsed = 0.0f;
+        REQUIRE(parse(format(value, out), parsed));
+        REQUIRE(memcmp(&parsed, &value, sizeof(value)) == 0);
+    }
+}
+
+TEST_CASE("TextFormat Parse agrees with strtod") {
+    char text[64];
+    uint64_t state = 0x2545F4914F6CDD1Du;
+    for(int i = 0; i < 100000; i++) {
+        // Random significands of up to 25 digits with random exponents.
+        const int digits = 1 + static_cast<int>(next(state) % 25);
+        size_t n = 0;
+        for(int j = 0; j < digits; j++) {
+            text[n++] = static_cast<char>('0' + next(state) % 10);
+            if(j == 0) {
+                text[n++] = '.';
+            }
+        }
+        n += static_cast<size_t>(snprintf(text + n, sizeof(text) - n, "e%d", static_cast<int>(next(state) % 700) - 350));
+
+        double d = 0.0;
+        float f = 0.0f;
+        REQUIRE(parse(text, d));
+        REQUIRE(d == strtod(text, nullptr));
+        REQUIRE(parse(text, f));
+        REQUIRE(f == strtof(text, nullptr));
+    }
+}
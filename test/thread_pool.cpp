@@ -0,0 +1,115 @@
+#include <tinyso3/tinyso3.hpp>
+#include <tinyso3/ThreadPool.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+
+using namespace tinyso3;
+
+TEST_CASE("ThreadPool") {
+    SECTION("Every index once") {
+        const size_t threads[] = {1, 2, 3, 8};
+        const size_t sizes[] = {0, 1, 7, 1000, 4099};
+        const size_t grains[] = {0, 1, 13};
+        for(const size_t t : threads) {
+            ThreadPool pool{t};
+            REQUIRE(pool.size() == t);
+            for(const size_t size : sizes) {
+                for(const size_t grain : grains) {
+                    std::vector<std::atomic<int>> visits(size);
+                    for(std::atomic<int>& v : visits) {
+                        v.store(0);
+                    }
+                    pool.parallelFor(size, [&](size_t begin, size_t end) {
+                        for(size_t i = begin; i < end; i++) {
+                            visits[i]++;
+                        }
+                    },
+                                     grain);
+                    for(size_t i = 0; i < size; i++) {
+                        REQUIRE(visits[i].load() == 1);
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("Uneven chunks are stolen") {
+        ThreadPool pool{4};
+        std::vector<std::atomic<int>> ran(64);
+        std::atomic<int> threads[4];
+        for(std::atomic<int>& t : threads) {
+            t.store(0);
+        }
+        // The first thread's chunks are slow, the others finish theirs and take over.
+        pool.run(64, [&](size_t chunk, size_t thread) {
+            if(chunk < 16) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            ran[chunk]++;
+            threads[thread]++;
+        });
+        for(size_t chunk = 0; chunk < 64; chunk++) {
+            REQUIRE(ran[chunk].load() == 1);
+        }
+        REQUIRE(threads[0].load() < 16);
+    }
+
+    SECTION("Deterministic reduction") {
+        std::vector<float> values(100003);
+        for(size_t i = 0; i < values.size(); i++) {
+            values[i] = 1.0f / static_cast<float>(i + 1) * (i % 2 == 0 ? 1.0f : -0.999f);
+        }
+        auto map = [&](size_t begin, size_t end) {
+            float sum = 0.0f;
+            for(size_t i = begin; i < end; i++) {
+                sum += values[i];
+            }
+            return sum;
+        };
+        auto combine = [](float a, float b) { return a + b; };
+
+        ThreadPool serial{1};
+        const float reference = serial.parallelReduce(values.size(), 0.0f, map, combine);
+        for(size_t t = 2; t <= 6; t++) {
+            ThreadPool pool{t};
+            for(size_t repeat = 0; repeat < 10; repeat++) {
+                REQUIRE(pool.parallelReduce(values.size(), 0.0f, map, combine) == reference);
+                REQUIRE(pool.parallelReduce(values.size(), 0.0f, map, combine, 1000) == serial.parallelReduce(values.size(), 0.0f, map, combine, 1000));
+            }
+        }
+        REQUIRE(serial.parallelReduce(size_t(0), 1.5f, map, combine) == 1.5f);
+    }
+
+    SECTION("Dynamic reduction") {
+        ThreadPool pool{3};
+        const uint64_t sum = pool.parallelReduce(size_t(100000), uint64_t(0), [](size_t begin, size_t end) {
+            uint64_t s = 0;
+            for(size_t i = begin; i < end; i++) {
+                s += i;
+            }
+            return s;
+        },
+                                                 [](uint64_t a, uint64_t b) { return a + b; }, 0, Chunking::DYNAMIC);
+        REQUIRE(sum == uint64_t(99999) * 100000 / 2);
+    }
+
+    SECTION("Batch kernels over slices") {
+        const size_t count = 5000;
+        std::vector<float> w(count), x(count), y(count), z(count);
+        const QuaternionBatch<HAMILTON, float> q{w.data(), x.data(), y.data(), z.data(), count};
+        for(size_t i = 0; i < count; i++) {
+            const float angle = 0.001f * static_cast<float>(i);
+            q.set(i, Quaternion<HAMILTON, float>{AxisAngle<float>{Vector3<float>{0.48f, 0.6f, -0.64f}, angle}});
+        }
+
+        using Grid = RotationGrid<16, HAMILTON, float>;
+        std::vector<Grid::Cell> serial(count), parallel(count);
+        Grid::Quantize(q, serial.data());
+
+        ThreadPool pool{4};
+        pool.parallelFor(count, [&](size_t begin, size_t end) {
+            Grid::Quantize(QuaternionBatch<HAMILTON, const float>{q}.slice(begin, end - begin), parallel.data() + begin);
+        });
+        REQUIRE(serial == parallel);
+    }
+}
@@ -23,4 +23,12 @@ TEST_CASE("tiny_eplison") {
             REQUIRE_THAT(ldbl_eps, Catch::Matchers::WithinRel(pow(static_cast<double>(10), static_cast<double>(-i)), 1e-12));
         }
     }
-};
\ No newline at end of file
+
+    // Machine epsilon, 1 + eps is the next representable value after 1.
+    volatile float one_f = 1.0f;
+    volatile double one_d = 1.0;
+    REQUIRE(one_f + machine_epsilon<float>() > one_f);
+    REQUIRE(one_f + machine_epsilon<float>() / 2.0f == one_f);
+    REQUIRE(one_d + machine_epsilon<double>() > one_d);
+    REQUIRE(one_d + machine_epsilon<double>() / 2.0 == one_d);
+};
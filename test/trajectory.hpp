@@ -0,0 +1,37 @@
+/**
+ * @file trajectory.hpp
+ *
+ * Analytic attitude trajectory and angular error, shared by the interpolation and integration tests.
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#pragma once
+
+#include <tinyso3/tinyso3.hpp>
+
+// q(t) = Rz(a * t) * Rx(b * t), body frame angular velocity w(t) = Rx(b * t)^T * (0, 0, a) + (b, 0, 0)
+struct Trajectory {
+    double a;
+    double b;
+
+    template<typename QuaternionConvention = tinyso3::HAMILTON>
+    tinyso3::Quaternion<QuaternionConvention, double> attitude(double t) const {
+        using tinyso3::RotationMatrix;
+        const RotationMatrix<tinyso3::ACTIVE, double> R = RotationMatrix<tinyso3::ACTIVE, double>::RotatePrincipalAxis<tinyso3::Z>(a * t) * RotationMatrix<tinyso3::ACTIVE, double>::RotatePrincipalAxis<tinyso3::X>(b * t);
+        return tinyso3::Quaternion<QuaternionConvention, double>{typename tinyso3::Quaternion<QuaternionConvention, double>::RotationMatrixAlias{tinyso3::is_same<QuaternionConvention, tinyso3::HAMILTON>::value ? R : R.T()}};
+    }
+
+    tinyso3::AngularVelocity<double> angularVelocity(double t) const {
+        return tinyso3::AngularVelocity<double>{b, a * sin(b * t), a * cos(b * t)};
+    }
+
+    // Integral of w(t) over [t0, t1]
+    tinyso3::Vector3<double> deltaAngle(double t0, double t1) const {
+        return tinyso3::Vector3<double>{b * (t1 - t0), -a / b * (cos(b * t1) - cos(b * t0)), a / b * (sin(b * t1) - sin(b * t0))};
+    }
+};
+
+inline double angularError(const tinyso3::Quaternion<tinyso3::HAMILTON, double>& q1, const tinyso3::Quaternion<tinyso3::HAMILTON, double>& q2) {
+    return q1.boxminus(q2).norm();
+}
@@ -0,0 +1,421 @@
+/**
+ * @file tinyso3_accuracy.cpp
+ *
+ * tinyso3-accuracy, measures the angular error and the time of every direct conversion in float and double.
+ *
+ * Rotations are swept in three sets, uniformly random, near gimbal lock (the middle Euler angle of each convention
+ * and sequence at or near its singular value) and near pi rotations (angles at or within 1e-1 .. 1e-8 rad of pi).
+ * Each rotation is rounded into the source representation of the path in the measured type, converted, and compared
+ * with the source itself in long double, the error is the rotation angle between the two.
+ * Long double references go through quaternions only by products of sines and cosines, or from rotation matrices
+ * through the largest diagonal pivot, never through an inverse trigonometric function, so they stay exact beyond double.
+ *
+ * One CSV row is written per path and type,
+ * from,to,type,ns_per_op,random_max,random_rms,gimbal_max,gimbal_rms,near_pi_max,near_pi_rms
+ * with the errors in radians. The measured code is built with the flags of this tool, e.g. -ffast-math to compare a fast math build.
+ *
+ * tinyso3-accuracy --samples 100000 --filter intrinsic-zyx accuracy.csv
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#include <tinyso3/tinyso3.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace tinyso3;
+
+namespace {
+using Reference = Quaternion<HAMILTON, long double>;
+using ReferenceMatrix = RotationMatrix<ACTIVE, long double>;
+
+constexpr size_t Repetitions = 5;
+
+enum InputSet {
+    RANDOM,
+    GIMBAL,
+    NEAR_PI,
+    INPUT_SETS
+};
+
+struct Options {
+    size_t samples{10000};
+    const char* filter{nullptr};
+    const char* output{nullptr};
+};
+
+/**
+ * Representations, each with its type in a floating point type, the Matrix holding its elements,
+ * and the exact conversions between its long double type and the reference quaternion.
+ */
+struct Active {
+    template<typename T>
+    using type = RotationMatrix<ACTIVE, T>;
+    template<typename T>
+    using elements = SquareMatrix<3, T>;
+    static void Name(char* name, size_t size) { snprintf(name, size, "active"); }
+    static type<long double> FromReference(const Reference& q) { return ReferenceMatrix{q}; }
+    static Reference ToReference(const type<long double>& R) { return Reference{R}; }
+};
+
+struct Passive {
+    template<typename T>
+    using type = RotationMatrix<PASSIVE, T>;
+    template<typename T>
+    using elements = SquareMatrix<3, T>;
+    static void Name(char* name, size_t size) { snprintf(name, size, "passive"); }
+    static type<long double> FromReference(const Reference& q) { return SquareMatrix<3, long double>{ReferenceMatrix{q}.T()}; }
+    static Reference ToReference(const type<long double>& R) { return Reference{ReferenceMatrix{SquareMatrix<3, long double>{R.T()}}}; }
+};
+
+struct Hamilton {
+    template<typename T>
+    using type = Quaternion<HAMILTON, T>;
+    template<typename T>
+    using elements = Vector<4, T>;
+    static void Name(char* name, size_t size) { snprintf(name, size, "hamilton"); }
+    static type<long double> FromReference(const Reference& q) { return q; }
+    static Reference ToReference(const type<long double>& q) { return q; }
+};
+
+struct Jpl {
+    template<typename T>
+    using type = Quaternion<JPL, T>;
+    template<typename T>
+    using elements = Vector<4, T>;
+    static void Name(char* name, size_t size) { snprintf(name, size, "jpl"); }
+    static type<long double> FromReference(const Reference& q) { return type<long double>{Passive::FromReference(q)}; }
+    static Reference ToReference(const type<long double>& q) { return Passive::ToReference(RotationMatrix<PASSIVE, long double>{q}); }
+};
+
+struct AxisAngles {
+    template<typename T>
+    using type = AxisAngle<T>;
+    template<typename T>
+    using elements = Vector3<T>;
+    static void Name(char* name, size_t size) { snprintf(name, size, "axis-angle"); }
+    static type<long double> FromReference(const Reference& q) { return AxisAngle<long double>{q}; }
+    static Reference ToReference(const type<long double>& axis_angle) { return Reference{axis_angle}; }
+};
+
+template<typename Convention, typename Sequence>
+struct Eulers {
+    template<typename T>
+    using type = Euler<Convention, Sequence, T>;
+    template<typename T>
+    using elements = Vector3<T>;
+    static void Name(char* name, size_t size) {
+        snprintf(name, size, "%s-%c%c%c", is_same<Convention, INTRINSIC>::value ? "intrinsic" : "extrinsic", "xyz"[static_cast<int>(Sequence::Axis1)],
+                 "xyz"[static_cast<int>(Sequence::Axis2)], "xyz"[static_cast<int>(Sequence::Axis3)]);
+    }
+    static type<long double> FromReference(const Reference& q) { return type<long double>{q}; }
+    static Reference ToReference(const type<long double>& euler) { return Reference{euler}; }
+};
+
+/**
+ * Elementwise rounding into a floating point type, and exact widening back to long double.
+ */
+template<size_t M, size_t N, typename T>
+void round(Matrix<M, N, T>& to, const Matrix<M, N, long double>& from) {
+    for(size_t i = 0; i < M; i++) {
+        for(size_t j = 0; j < N; j++) {
+            to(i, j) = static_cast<T>(from(i, j));
+        }
+    }
+}
+
+template<size_t M, size_t N, typename T>
+void widen(Matrix<M, N, long double>& to, const Matrix<M, N, T>& from) {
+    for(size_t i = 0; i < M; i++) {
+        for(size_t j = 0; j < N; j++) {
+            to(i, j) = from(i, j);
+        }
+    }
+}
+
+template<typename Representation, typename T>
+typename Representation::template type<T> narrow(const Reference& q) {
+    typename Representation::template elements<T> elements;
+    round(elements, Representation::FromReference(q));
+    return typename Representation::template type<T>{elements};
+}
+
+template<typename Representation, typename T>
+Reference reference(const typename Representation::template type<T>& value) {
+    typename Representation::template elements<long double> elements;
+    widen(elements, value);
+    return Representation::ToReference(typename Representation::template type<long double>{elements});
+}
+
+/**
+ * Angle of the rotation between two quaternions of any norm, |q1^* q2| = 2 atan2(|v|, |w|).
+ */
+long double distance(const Reference& q1, const Reference& q2) {
+    const Vector3<long double> v1{q1.x(), q1.y(), q1.z()};
+    const Vector3<long double> v2{q2.x(), q2.y(), q2.z()};
+    const long double w = q1.w() * q2.w() + v1.dot(v2);
+    const Vector3<long double> v = v2 * q1.w() - v1 * q2.w() - v1.cross(v2);
+    return 2.0L * atan2l(v.norm(), fabsl(w));
+}
+
+/**
+ * Reference rotations of each input set.
+ */
+class Inputs {
+public:
+    explicit Inputs(size_t samples) {
+        for(size_t i = 0; i < samples; i++) {
+            add(RANDOM, Reference{gaussian(), gaussian(), gaussian(), gaussian()}.unit());
+        }
+
+        const long double pi = 3.141592653589793238462643383279502884L;
+        for(size_t axes = 0; axes < 16; axes++) {
+            const Vector3<long double> axis = Vector3<long double>{gaussian(), gaussian(), gaussian()}.unit();
+            add(NEAR_PI, Reference{AxisAngle<long double>{axis, pi}});
+            for(long double offset = 1e-1L; offset > 5e-9L; offset /= 10.0L) {
+                add(NEAR_PI, Reference{AxisAngle<long double>{axis, pi - offset}});
+            }
+        }
+
+        gimbal<INTRINSIC>();
+        gimbal<EXTRINSIC>();
+    }
+
+    inline const std::vector<Reference>& rotations() const { return _rotations; }
+    inline InputSet set(size_t i) const { return _sets[i]; }
+
+private:
+    void add(InputSet set, const Reference& q) {
+        _rotations.push_back(q);
+        _sets.push_back(set);
+    }
+
+    // Middle angles at and around the singular value of each sequence, pi / 2 for Tait-Bryan, 0 and pi for proper Euler angles.
+    template<typename Convention>
+    void gimbal() {
+        gimbal<Convention, XYZ>();
+        gimbal<Convention, XZY>();
+        gimbal<Convention, YXZ>();
+        gimbal<Convention, YZX>();
+        gimbal<Convention, ZXY>();
+        gimbal<Convention, ZYX>();
+        gimbal<Convention, XYX>();
+        gimbal<Convention, XZX>();
+        gimbal<Convention, YXY>();
+        gimbal<Convention, YZY>();
+        gimbal<Convention, ZXZ>();
+        gimbal<Convention, ZYZ>();
+    }
+
+    template<typename Convention, typename Sequence>
+    void gimbal() {
+        const long double pi = 3.141592653589793238462643383279502884L;
+        const bool proper = Sequence::Axis1 == Sequence::Axis3;
+        const long double singular[2] = {proper ? 0.0L : pi / 2.0L, proper ? pi : -pi / 2.0L};
+        for(size_t s = 0; s < 2; s++) {
+            for(long double offset = 1e-1L; offset > 5e-9L; offset /= 10.0L) {
+                for(long double side = -1.0L; side <= 1.0L; side += 1.0L) {
+                    const long double middle = singular[s] + side * offset;
+                    add(GIMBAL, Reference{Euler<Convention, Sequence, long double>{angle(), middle, angle()}});
+                }
+            }
+        }
+    }
+
+    // xorshift64*, then Box-Muller
+    long double uniform() {
+        _state ^= _state >> 12;
+        _state ^= _state << 25;
+        _state ^= _state >> 27;
+        return (static_cast<long double>((_state * 0x2545F4914F6CDD1Du) >> 11) + 0.5L) / 9007199254740992.0L;
+    }
+    long double gaussian() { return sqrtl(-2.0L * logl(uniform())) * cosl(6.283185307179586476925286766559L * uniform()); }
+    long double angle() { return 6.283185307179586476925286766559L * (uniform() - 0.5L); }
+
+    std::vector<Reference> _rotations;
+    std::vector<InputSet> _sets;
+    unsigned long long _state{0x9E3779B97F4A7C15u};
+};
+
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template<typename T>
+const char* typeName();
+template<>
+const char* typeName<float>() {
+    return "float";
+}
+template<>
+const char* typeName<double>() {
+    return "double";
+}
+
+/**
+ * Error statistics and timing of one path in one type, written as a CSV row.
+ */
+template<typename From, typename To, typename T>
+void path(const Inputs& inputs, const Options& options, FILE* output) {
+    using FromType = typename From::template type<T>;
+    using ToType = typename To::template type<T>;
+
+    char from[32], to[32], name[96];
+    From::Name(from, sizeof(from));
+    To::Name(to, sizeof(to));
+    snprintf(name, sizeof(name), "%s,%s,%s", from, to, typeName<T>());
+    if(options.filter != nullptr && strstr(name, options.filter) == nullptr) {
+        return;
+    }
+
+    const std::vector<Reference>& rotations = inputs.rotations();
+    std::vector<FromType> values;
+    values.reserve(rotations.size());
+    for(const Reference& q : rotations) {
+        values.push_back(narrow<From, T>(q));
+    }
+
+    long double maximum[INPUT_SETS] = {}, squares[INPUT_SETS] = {};
+    size_t counts[INPUT_SETS] = {};
+    for(size_t i = 0; i < values.size(); i++) {
+        const long double error = distance(reference<From, T>(values[i]), reference<To, T>(ToType{values[i]}));
+        const InputSet set = inputs.set(i);
+        if(std::isnan(error) || error > maximum[set]) { // a NaN stays the maximum
+            maximum[set] = error;
+        }
+        squares[set] += error * error;
+        counts[set]++;
+    }
+
+    double samples[Repetitions];
+    for(size_t r = 0; r < Repetitions; r++) {
+        const auto start = std::chrono::steady_clock::now();
+        for(const FromType& value : values) {
+            const ToType converted{value};
+            doNotOptimize(converted);
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        samples[r] = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(values.size());
+    }
+    std::sort(samples, samples + Repetitions);
+
+    fprintf(output, "%s,%.3f", name, samples[Repetitions / 2]);
+    for(size_t set = 0; set < INPUT_SETS; set++) {
+        const long double rms = counts[set] > 0 ? sqrtl(squares[set] / static_cast<long double>(counts[set])) : 0.0L;
+        fprintf(output, ",%.3Le,%.3Le", maximum[set], rms);
+    }
+    fprintf(output, "\n");
+}
+
+template<typename From, typename To, typename T>
+void paths(const Inputs& inputs, const Options& options, FILE* output) {
+    path<From, To, T>(inputs, options, output);
+    path<To, From, T>(inputs, options, output);
+}
+
+template<typename Convention, typename Sequence, typename T>
+void euler(const Inputs& inputs, const Options& options, FILE* output) {
+    paths<Eulers<Convention, Sequence>, Active, T>(inputs, options, output);
+    paths<Eulers<Convention, Sequence>, Passive, T>(inputs, options, output);
+    paths<Eulers<Convention, Sequence>, Hamilton, T>(inputs, options, output);
+    paths<Eulers<Convention, Sequence>, Jpl, T>(inputs, options, output);
+    paths<Eulers<Convention, Sequence>, AxisAngles, T>(inputs, options, output);
+}
+
+template<typename Convention, typename T>
+void eulers(const Inputs& inputs, const Options& options, FILE* output) {
+    euler<Convention, XYZ, T>(inputs, options, output);
+    euler<Convention, XZY, T>(inputs, options, output);
+    euler<Convention, YXZ, T>(inputs, options, output);
+    euler<Convention, YZX, T>(inputs, options, output);
+    euler<Convention, ZXY, T>(inputs, options, output);
+    euler<Convention, ZYX, T>(inputs, options, output);
+    euler<Convention, XYX, T>(inputs, options, output);
+    euler<Convention, XZX, T>(inputs, options, output);
+    euler<Convention, YXY, T>(inputs, options, output);
+    euler<Convention, YZY, T>(inputs, options, output);
+    euler<Convention, ZXZ, T>(inputs, options, output);
+    euler<Convention, ZYZ, T>(inputs, options, output);
+}
+
+template<typename T>
+void sweep(const Inputs& inputs, const Options& options, FILE* output) {
+    paths<Active, Hamilton, T>(inputs, options, output);
+    paths<Passive, Jpl, T>(inputs, options, output);
+    paths<AxisAngles, Active, T>(inputs, options, output);
+    paths<AxisAngles, Passive, T>(inputs, options, output);
+    paths<AxisAngles, Hamilton, T>(inputs, options, output);
+    paths<AxisAngles, Jpl, T>(inputs, options, output);
+    eulers<INTRINSIC, T>(inputs, options, output);
+    eulers<EXTRINSIC, T>(inputs, options, output);
+}
+
+void usage() {
+    fprintf(stderr,
+            "usage: tinyso3-accuracy [options] [output]\n"
+            "\n"
+            "  -n, --samples N  uniformly random rotations, 10000 by default\n"
+            "  -f, --filter S   only the paths whose 'from,to,type' contains S, e.g. 'intrinsic-zyx' or ',float'\n"
+            "\n"
+            "The CSV table is written to stdout when the output is omitted or '-'.\n");
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for(int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if((strcmp(arg, "-n") == 0 || strcmp(arg, "--samples") == 0) && has_value) {
+            options.samples = strtoul(argv[++i], nullptr, 10);
+        } else if((strcmp(arg, "-f") == 0 || strcmp(arg, "--filter") == 0) && has_value) {
+            options.filter = argv[++i];
+        } else if(strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            return false;
+        } else if((arg[0] != '-' || strcmp(arg, "-") == 0) && options.output == nullptr) {
+            options.output = arg;
+        } else {
+            fprintf(stderr, "unknown option '%s'\n", arg);
+            return false;
+        }
+    }
+
+    if(options.output != nullptr && strcmp(options.output, "-") == 0) {
+        options.output = nullptr;
+    }
+    return true;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if(!parseOptions(argc, argv, options)) {
+        usage();
+        return 2;
+    }
+
+    FILE* output = stdout;
+    if(options.output != nullptr) {
+        output = fopen(options.output, "w");
+        if(output == nullptr) {
+            fprintf(stderr, "%s: %s\n", options.output, strerror(errno));
+            return 1;
+        }
+    }
+
+    const Inputs inputs{options.samples};
+    fprintf(output, "from,to,type,ns_per_op,random_max,random_rms,gimbal_max,gimbal_rms,near_pi_max,near_pi_rms\n");
+    sweep<float>(inputs, options, output);
+    sweep<double>(inputs, options, output);
+
+    if(output != stdout) {
+        fclose(output);
+    }
+    return 0;
+}
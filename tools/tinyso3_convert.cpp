@@ -0,0 +1,738 @@
+/**
+ * @file tinyso3_convert.cpp
+ *
+ * tinyso3-convert, streams attitude datasets from one representation and convention to another.
+ *
+ * Input is CSV text or an AttitudeLog (detected by its magic), output is CSV text or an AttitudeLog.
+ * Records are processed in chunks, each chunk is parsed, converted through the batch views and formatted by a worker thread,
+ * and the chunks are written in input order. Every representation passes through an ACTIVE rotation matrix in double.
+ *
+ * CSV columns follow the storage order of each representation, one record per line,
+ * hamilton w, x, y, z | jpl x, y, z, w | active, passive : 9 elements row major | euler : 3 angles [rad] | axis-angle : rotation vector [rad]
+ * optionally preceded by a timestamp. Empty lines, comments (#) and header lines starting with a letter (other than inf or nan) are skipped.
+ *
+ * tinyso3-convert --from intrinsic-zyx --to jpl -t euler.csv quaternion.csv
+ *
+ * @author timetravelCat <timetraveler930@gmail.com>
+ */
+
+#include <tinyso3/tinyso3.hpp>
+#include <tinyso3/AttitudeLogFile.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace tinyso3;
+
+namespace {
+using ActiveMatrix = RotationMatrix<ACTIVE, double>;
+using ActiveBatch = RotationMatrixBatch<ACTIVE, double>;
+using ConstActiveBatch = RotationMatrixBatch<ACTIVE, const double>;
+
+constexpr size_t LogChunkSize = 4096;
+constexpr size_t LogIndexCapacity = 1 << 16; // 268M records
+
+/**
+ * Conversions to and from an ACTIVE rotation matrix.
+ */
+inline ActiveMatrix active(const ActiveMatrix& R) { return R; }
+inline ActiveMatrix active(const RotationMatrix<PASSIVE, double>& R) { return SquareMatrix<3, double>{R.T()}; }
+inline ActiveMatrix active(const Quaternion<HAMILTON, double>& q) { return ActiveMatrix{q}; }
+inline ActiveMatrix active(const Quaternion<JPL, double>& q) { return active(RotationMatrix<PASSIVE, double>{q}); }
+inline ActiveMatrix active(const AxisAngle<double>& axis_angle) { return ActiveMatrix{axis_angle}; }
+template<typename EulerConvention, typename EulerSequence>
+inline ActiveMatrix active(const Euler<EulerConvention, EulerSequence, double>& euler) { return ActiveMatrix{euler}; }
+
+template<typename Value>
+struct FromActive {
+    static inline Value convert(const ActiveMatrix& R) { return Value{R}; }
+};
+template<>
+struct FromActive<RotationMatrix<PASSIVE, double>> {
+    static inline RotationMatrix<PASSIVE, double> convert(const ActiveMatrix& R) { return SquareMatrix<3, double>{R.T()}; }
+};
+template<>
+struct FromActive<Quaternion<JPL, double>> {
+    static inline Quaternion<JPL, double> convert(const ActiveMatrix& R) { return Quaternion<JPL, double>{FromActive<RotationMatrix<PASSIVE, double>>::convert(R)}; }
+};
+
+/**
+ * Batch views over the CSV columns of each representation.
+ */
+template<typename Value>
+struct Layout;
+
+template<typename QuaternionConvention>
+struct Layout<Quaternion<QuaternionConvention, double>> {
+    static constexpr size_t Components = 4;
+    template<typename Type>
+    static QuaternionBatch<QuaternionConvention, Type> batch(Type* const* columns, size_t size) {
+        return is_same<QuaternionConvention, HAMILTON>::value ?
+                 QuaternionBatch<QuaternionConvention, Type>{columns[0], columns[1], columns[2], columns[3], size} :
+                 QuaternionBatch<QuaternionConvention, Type>{columns[3], columns[0], columns[1], columns[2], size};
+    }
+};
+
+template<typename RotationMatrixConvention>
+struct Layout<RotationMatrix<RotationMatrixConvention, double>> {
+    static constexpr size_t Components = 9;
+    template<typename Type>
+    static RotationMatrixBatch<RotationMatrixConvention, Type> batch(Type* const* columns, size_t size) {
+        return RotationMatrixBatch<RotationMatrixConvention, Type>{columns, size};
+    }
+};
+
+template<typename Vector>
+struct Vector3Layout {
+    static constexpr size_t Components = 3;
+    template<typename Type>
+    static Vector3Batch<Type> batch(Type* const* columns, size_t size) {
+        return Vector3Batch<Type>{columns[0], columns[1], columns[2], size};
+    }
+};
+
+template<typename EulerConvention, typename EulerSequence>
+struct Layout<Euler<EulerConvention, EulerSequence, double>> : Vector3Layout<Euler<EulerConvention, EulerSequence, double>> {};
+template<>
+struct Layout<AxisAngle<double>> : Vector3Layout<AxisAngle<double>> {};
+
+template<typename Value>
+void decode(const double* const* columns, const ActiveBatch& out) {
+    const auto in = Layout<Value>::batch(columns, out.size());
+    for(size_t i = 0; i < out.size(); i++) {
+        out.set(i, active(Value{in[i]}));
+    }
+}
+
+template<typename Value>
+void encode(const ConstActiveBatch& in, double* const* columns) {
+    const auto out = Layout<Value>::batch(columns, in.size());
+    for(size_t i = 0; i < in.size(); i++) {
+        out.set(i, FromActive<Value>::convert(in[i]));
+    }
+}
+
+/**
+ * Representations selectable at runtime.
+ */
+struct Representation {
+    const char* name;
+    size_t components;
+    int log_convention; // attitude_log_convention, -1 if an AttitudeLog can not hold it
+    void (*decode)(const double* const* columns, const ActiveBatch& out);
+    void (*encode)(const ConstActiveBatch& in, double* const* columns);
+};
+
+template<typename Value>
+constexpr Representation representation(const char* name, int log_convention = -1) {
+    return Representation{name, Layout<Value>::Components, log_convention, &decode<Value>, &encode<Value>};
+}
+
+const Representation representations[] = {
+  representation<Quaternion<HAMILTON, double>>("hamilton", attitude_log_convention<HAMILTON>::value),
+  representation<Quaternion<JPL, double>>("jpl", attitude_log_convention<JPL>::value),
+  representation<RotationMatrix<ACTIVE, double>>("active", attitude_log_convention<ACTIVE>::value),
+  representation<RotationMatrix<PASSIVE, double>>("passive", attitude_log_convention<PASSIVE>::value),
+  representation<AxisAngle<double>>("axis-angle"),
+  representation<Euler<INTRINSIC, XYZ, double>>("intrinsic-xyz"),
+  representation<Euler<INTRINSIC, XZY, double>>("intrinsic-xzy"),
+  representation<Euler<INTRINSIC, YXZ, double>>("intrinsic-yxz"),
+  representation<Euler<INTRINSIC, YZX, double>>("intrinsic-yzx"),
+  representation<Euler<INTRINSIC, ZXY, double>>("intrinsic-zxy"),
+  representation<Euler<INTRINSIC, ZYX, double>>("intrinsic-zyx"),
+  representation<Euler<INTRINSIC, XYX, double>>("intrinsic-xyx"),
+  representation<Euler<INTRINSIC, XZX, double>>("intrinsic-xzx"),
+  representation<Euler<INTRINSIC, YXY, double>>("intrinsic-yxy"),
+  representation<Euler<INTRINSIC, YZY, double>>("intrinsic-yzy"),
+  representation<Euler<INTRINSIC, ZXZ, double>>("intrinsic-zxz"),
+  representation<Euler<INTRINSIC, ZYZ, double>>("intrinsic-zyz"),
+  representation<Euler<EXTRINSIC, XYZ, double>>("extrinsic-xyz"),
+  representation<Euler<EXTRINSIC, XZY, double>>("extrinsic-xzy"),
+  representation<Euler<EXTRINSIC, YXZ, double>>("extrinsic-yxz"),
+  representation<Euler<EXTRINSIC, YZX, double>>("extrinsic-yzx"),
+  representation<Euler<EXTRINSIC, ZXY, double>>("extrinsic-zxy"),
+  representation<Euler<EXTRINSIC, ZYX, double>>("extrinsic-zyx"),
+  representation<Euler<EXTRINSIC, XYX, double>>("extrinsic-xyx"),
+  representation<Euler<EXTRINSIC, XZX, double>>("extrinsic-xzx"),
+  representation<Euler<EXTRINSIC, YXY, double>>("extrinsic-yxy"),
+  representation<Euler<EXTRINSIC, YZY, double>>("extrinsic-yzy"),
+  representation<Euler<EXTRINSIC, ZXZ, double>>("extrinsic-zxz"),
+  representation<Euler<EXTRINSIC, ZYZ, double>>("extrinsic-zyz"),
+};
+
+const Representation* findRepresentation(const char* name) {
+    for(const Representation& r : representations) {
+        if(strcmp(r.name, name) == 0) {
+            return &r;
+        }
+    }
+    return nullptr;
+}
+
+const Representation* findRepresentation(int log_convention) {
+    for(const Representation& r : representations) {
+        if(r.log_convention == log_convention) {
+            return &r;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Records of one chunk, columns are stored one after another.
+ */
+struct Chunk {
+    // CSV input, complete lines
+    const char* text{nullptr};
+    size_t text_size{0};
+    size_t first_line{0};
+    // AttitudeLog input
+    size_t log_chunk{0};
+
+    size_t count{0};
+    std::vector<double> timestamps;
+    std::vector<double> input;
+    std::vector<double> matrices;
+    std::vector<double> output;
+    std::string formatted;
+    size_t error_line{0}; // 0 if none
+
+    static void columns(std::vector<double>& storage, size_t components, size_t count, double** out) {
+        storage.resize(components * count);
+        for(size_t k = 0; k < components; k++) {
+            out[k] = storage.data() + k * count;
+        }
+    }
+};
+
+struct Options {
+    const Representation* from{nullptr};
+    const Representation* to{nullptr};
+    const char* input{nullptr};
+    const char* output{nullptr};
+    bool timestamps{false};
+    bool log_output{false};
+    size_t threads{0};
+    size_t chunk{LogChunkSize};
+};
+
+/**
+ * CSV parsing and formatting.
+ */
+void parse(Chunk& chunk, const Options& options) {
+    const size_t components = options.from->components;
+
+    size_t lines = 0;
+    for(size_t i = 0; i < chunk.text_size; i++) {
+        lines += chunk.text[i] == '\n' ? 1 : 0;
+    }
+    lines += 1;
+
+    double* columns[9];
+    Chunk::columns(chunk.input, components, lines, columns);
+    chunk.timestamps.resize(lines);
+
+    // Parsed in the storage order of each layout, quaternions w, x, y, z and matrices row major.
+    CsvReader<double> reader;
+    double* timestamps = options.timestamps ? chunk.timestamps.data() : nullptr;
+    if(components == 3) {
+        reader.read(chunk.text, chunk.text_size, Vector3Batch<double>{columns[0], columns[1], columns[2], lines}, timestamps, true);
+    } else if(components == 4) {
+        reader.read(chunk.text, chunk.text_size, QuaternionBatch<HAMILTON, double>{columns[0], columns[1], columns[2], columns[3], lines}, timestamps, true);
+    } else {
+        reader.read(chunk.text, chunk.text_size, RotationMatrixBatch<ACTIVE, double>{columns, lines}, timestamps, true);
+    }
+    if(reader.failed()) {
+        chunk.error_line = chunk.first_line + reader.line();
+        return;
+    }
+    const size_t count = reader.records();
+
+    // Compact the columns to the parsed record count.
+    for(size_t k = 1; k < components; k++) {
+        memmove(chunk.input.data() + k * count, columns[k], count * sizeof(double));
+    }
+    chunk.count = count;
+}
+
+void format(Chunk& chunk, bool timestamps, size_t components) {
+    chunk.formatted.clear();
+    chunk.formatted.reserve(chunk.count * (components + 1) * 24);
+
+    char buffer[TextFormatd::MaxLength + 1];
+    for(size_t i = 0; i < chunk.count; i++) {
+        if(timestamps) {
+            const size_t n = TextFormatd::Format(chunk.timestamps[i], buffer);
+            buffer[n] = ',';
+            chunk.formatted.append(buffer, n + 1);
+        }
+        for(size_t k = 0; k < components; k++) {
+            const size_t n = TextFormatd::Format(chunk.output[k * chunk.count + i], buffer);
+            buffer[n] = k + 1 < components ? ',' : '\n';
+            chunk.formatted.append(buffer, n + 1);
+        }
+    }
+}
+
+/**
+ * AttitudeLog input, widened to double.
+ */
+template<typename Value, typename Type>
+struct Widen;
+template<typename QuaternionConvention, typename Type>
+struct Widen<Quaternion<QuaternionConvention, double>, Quaternion<QuaternionConvention, Type>> {
+    static inline Quaternion<QuaternionConvention, double> convert(const Quaternion<QuaternionConvention, Type>& q) {
+        return Vector<4, double>{static_cast<Matrix<4, 1, double>>(q)};
+    }
+};
+template<typename RotationMatrixConvention, typename Type>
+struct Widen<RotationMatrix<RotationMatrixConvention, double>, RotationMatrix<RotationMatrixConvention, Type>> {
+    static inline RotationMatrix<RotationMatrixConvention, double> convert(const RotationMatrix<RotationMatrixConvention, Type>& R) {
+        return SquareMatrix<3, double>{static_cast<Matrix<3, 3, double>>(R)};
+    }
+};
+
+template<typename Convention, typename Type>
+void decodeLog(const AttitudeLogReader& reader, size_t chunk, true_type, const ActiveBatch& out) {
+    const QuaternionBatch<Convention, const Type> in = reader.quaternions<Convention, Type>(chunk);
+    for(size_t i = 0; i < out.size(); i++) {
+        out.set(i, active(Widen<Quaternion<Convention, double>, Quaternion<Convention, Type>>::convert(in[i])));
+    }
+}
+
+template<typename Convention, typename Type>
+void decodeLog(const AttitudeLogReader& reader, size_t chunk, false_type, const ActiveBatch& out) {
+    const RotationMatrixBatch<Convention, const Type> in = reader.rotationMatrices<Convention, Type>(chunk);
+    for(size_t i = 0; i < out.size(); i++) {
+        out.set(i, active(Widen<RotationMatrix<Convention, double>, RotationMatrix<Convention, Type>>::convert(in[i])));
+    }
+}
+
+template<typename Convention, typename Type>
+void decodeLog(const AttitudeLogReader& reader, size_t chunk, const ActiveBatch& out) {
+    decodeLog<Convention, Type>(reader, chunk, integral_constant<bool, is_quaternion_convention<Convention>::value>{}, out);
+}
+
+using DecodeLog = void (*)(const AttitudeLogReader&, size_t, const ActiveBatch&);
+
+template<typename Convention>
+DecodeLog logDecoder(const AttitudeLogReader& reader) {
+    if(reader.holds<Convention, double>()) {
+        return &decodeLog<Convention, double>;
+    }
+    if(reader.holds<Convention, float>()) {
+        return &decodeLog<Convention, float>;
+    }
+    return nullptr;
+}
+
+/**
+ * Input sources, fill the next block of chunks.
+ */
+class Input {
+public:
+    virtual ~Input() = default;
+    virtual size_t next(std::vector<Chunk>& chunks) = 0;
+    virtual void process(Chunk& chunk, const Options& options) const = 0;
+};
+
+class CsvInput : public Input {
+public:
+    CsvInput(FILE* file, size_t chunk_lines, size_t block_bytes) :
+    _file(file), _chunk_lines(chunk_lines), _block_bytes(block_bytes) {}
+
+    size_t next(std::vector<Chunk>& chunks) override {
+        // Keep the incomplete last line of the previous block, read until the block holds a complete line.
+        _buffer.erase(0, _consumed);
+        size_t end = std::string::npos;
+        while(!_eof && end == std::string::npos) {
+            const size_t kept = _buffer.size();
+            _buffer.resize(kept + _block_bytes);
+            const size_t read = fread(&_buffer[kept], 1, _block_bytes, _file);
+            _buffer.resize(kept + read);
+            _eof = read < _block_bytes;
+            end = _buffer.rfind('\n');
+        }
+        end = _eof ? _buffer.size() : end + 1;
+        _consumed = end;
+
+        // Split into chunks of at most _chunk_lines lines.
+        const char* const begin = _buffer.data();
+        size_t used = 0;
+        for(size_t position = 0; position < end; used++) {
+            size_t stop = position;
+            size_t lines = 0;
+            for(; stop < end && lines < _chunk_lines; lines++) {
+                const void* newline = memchr(begin + stop, '\n', end - stop);
+                stop = newline == nullptr ? end : static_cast<size_t>(static_cast<const char*>(newline) - begin) + 1;
+            }
+
+            if(used == chunks.size()) {
+                chunks.emplace_back();
+            }
+            Chunk& chunk = chunks[used];
+            chunk.text = begin + position;
+            chunk.text_size = stop - position;
+            chunk.first_line = _line;
+            _line += lines;
+            position = stop;
+        }
+        return used;
+    }
+
+    void process(Chunk& chunk, const Options& options) const override {
+        parse(chunk, options);
+        if(chunk.error_line != 0) {
+            return;
+        }
+
+        double* input[9];
+        double* matrices[9];
+        for(size_t k = 0; k < options.from->components; k++) {
+            input[k] = chunk.input.data() + k * chunk.count;
+        }
+        Chunk::columns(chunk.matrices, 9, chunk.count, matrices);
+        options.from->decode(input, ActiveBatch{matrices, chunk.count});
+    }
+
+private:
+    FILE* _file;
+    size_t _chunk_lines;
+    size_t _block_bytes;
+    std::string _buffer;
+    size_t _consumed{0};
+    size_t _line{1};
+    bool _eof{false};
+};
+
+class LogInput : public Input {
+public:
+    LogInput(const AttitudeLogReader& reader, DecodeLog decoder, size_t block_chunks) :
+    _reader(reader), _decoder(decoder), _block_chunks(block_chunks) {}
+
+    size_t next(std::vector<Chunk>& chunks) override {
+        size_t used = 0;
+        while(used < _block_chunks && _chunk < _reader.chunks()) {
+            if(used == chunks.size()) {
+                chunks.emplace_back();
+            }
+            chunks[used++].log_chunk = _chunk++;
+        }
+        return used;
+    }
+
+    void process(Chunk& chunk, const Options&) const override {
+        chunk.count = static_cast<size_t>(_reader.index(chunk.log_chunk).count);
+        const double* timestamps = _reader.timestamps(chunk.log_chunk);
+        chunk.timestamps.assign(timestamps, timestamps + chunk.count);
+
+        double* matrices[9];
+        Chunk::columns(chunk.matrices, 9, chunk.count, matrices);
+        _decoder(_reader, chunk.log_chunk, ActiveBatch{matrices, chunk.count});
+    }
+
+private:
+    const AttitudeLogReader& _reader;
+    DecodeLog _decoder;
+    size_t _block_chunks;
+    size_t _chunk{0};
+};
+
+/**
+ * Output sinks, write the chunks in order.
+ */
+class Output {
+public:
+    virtual ~Output() = default;
+    virtual bool write(Chunk& chunk) = 0;
+    virtual bool close() = 0;
+};
+
+class CsvOutput : public Output {
+public:
+    explicit CsvOutput(FILE* file) :
+    _file(file) {}
+
+    bool write(Chunk& chunk) override {
+        return fwrite(chunk.formatted.data(), 1, chunk.formatted.size(), _file) == chunk.formatted.size();
+    }
+    bool close() override { return fflush(_file) == 0; }
+
+private:
+    FILE* _file;
+};
+
+template<typename Convention>
+class LogOutput : public Output {
+public:
+    using Writer = AttitudeLogWriter<Convention, double, FileSink, LogChunkSize>;
+    using Value = typename Writer::ValueType;
+
+    LogOutput(int fd, bool timestamps) :
+    _index(LogIndexCapacity), _writer(new Writer{FileSink{fd}, _index.data(), _index.size()}), _timestamps(timestamps) {}
+
+    bool write(Chunk& chunk) override {
+        if(!_timestamps) { // record numbers
+            chunk.timestamps.resize(chunk.count);
+            for(size_t i = 0; i < chunk.count; i++) {
+                chunk.timestamps[i] = static_cast<double>(_records + i);
+            }
+        }
+        _records += chunk.count;
+
+        const double* columns[9];
+        for(size_t k = 0; k < Layout<Value>::Components; k++) {
+            columns[k] = chunk.output.data() + k * chunk.count;
+        }
+        return _writer->append(chunk.timestamps.data(), Layout<Value>::batch(columns, chunk.count));
+    }
+    bool close() override { return _writer->close(); }
+
+private:
+    std::vector<AttitudeLogIndexEntry> _index;
+    std::unique_ptr<Writer> _writer; // holds a chunk of records
+    bool _timestamps;
+    size_t _records{0};
+};
+
+std::unique_ptr<Output> logOutput(int log_convention, int fd, bool timestamps) {
+    switch(log_convention) {
+    case attitude_log_convention<HAMILTON>::value:
+        return std::unique_ptr<Output>{new LogOutput<HAMILTON>{fd, timestamps}};
+    case attitude_log_convention<JPL>::value:
+        return std::unique_ptr<Output>{new LogOutput<JPL>{fd, timestamps}};
+    case attitude_log_convention<ACTIVE>::value:
+        return std::unique_ptr<Output>{new LogOutput<ACTIVE>{fd, timestamps}};
+    default:
+        return std::unique_ptr<Output>{new LogOutput<PASSIVE>{fd, timestamps}};
+    }
+}
+
+void convert(Chunk& chunk, const Input& input, const Options& options) {
+    chunk.error_line = 0;
+    chunk.count = 0;
+    input.process(chunk, options);
+    if(chunk.error_line != 0) {
+        return;
+    }
+
+    double* matrices[9];
+    double* output[9];
+    for(size_t k = 0; k < 9; k++) {
+        matrices[k] = chunk.matrices.data() + k * chunk.count;
+    }
+    Chunk::columns(chunk.output, options.to->components, chunk.count, output);
+    options.to->encode(ConstActiveBatch{ActiveBatch{matrices, chunk.count}}, output);
+
+    if(!options.log_output) {
+        format(chunk, options.timestamps, options.to->components);
+    }
+}
+
+void usage() {
+    fprintf(stderr,
+            "usage: tinyso3-convert --from REPRESENTATION --to REPRESENTATION [options] [input [output]]\n"
+            "\n"
+            "  REPRESENTATION   hamilton | jpl | active | passive | axis-angle | intrinsic-SEQ | extrinsic-SEQ\n"
+            "                   SEQ is one of xyz, xzy, yxz, yzx, zxy, zyx, xyx, xzx, yxy, yzy, zxz, zyz\n"
+            "  -t, --timestamps the first CSV column is a timestamp\n"
+            "  --log            write an AttitudeLog (hamilton, jpl, active or passive) instead of CSV\n"
+            "  -j, --threads N  worker threads, the hardware concurrency by default\n"
+            "  -c, --chunk N    records per chunk of CSV input, %zu by default\n"
+            "\n"
+            "The input is read from stdin and the output written to stdout when omitted or '-'.\n"
+            "AttitudeLog input is detected by its magic, --from may then be omitted.\n",
+            LogChunkSize);
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    const char* positional[2] = {nullptr, nullptr};
+    size_t positionals = 0;
+
+    for(int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if(strcmp(arg, "--from") == 0 && has_value) {
+            options.from = findRepresentation(argv[++i]);
+            if(options.from == nullptr) {
+                fprintf(stderr, "unknown representation '%s'\n", argv[i]);
+                return false;
+            }
+        } else if(strcmp(arg, "--to") == 0 && has_value) {
+            options.to = findRepresentation(argv[++i]);
+            if(options.to == nullptr) {
+                fprintf(stderr, "unknown representation '%s'\n", argv[i]);
+                return false;
+            }
+        } else if(strcmp(arg, "-t") == 0 || strcmp(arg, "--timestamps") == 0) {
+            options.timestamps = true;
+        } else if(strcmp(arg, "--log") == 0) {
+            options.log_output = true;
+        } else if((strcmp(arg, "-j") == 0 || strcmp(arg, "--threads") == 0) && has_value) {
+            options.threads = strtoul(argv[++i], nullptr, 10);
+        } else if((strcmp(arg, "-c") == 0 || strcmp(arg, "--chunk") == 0) && has_value) {
+            options.chunk = strtoul(argv[++i], nullptr, 10);
+        } else if(strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            return false;
+        } else if((arg[0] != '-' || strcmp(arg, "-") == 0) && positionals < 2) {
+            positional[positionals++] = arg;
+        } else {
+            fprintf(stderr, "unknown option '%s'\n", arg);
+            return false;
+        }
+    }
+
+    options.input = positional[0] != nullptr && strcmp(positional[0], "-") != 0 ? positional[0] : nullptr;
+    options.output = positional[1] != nullptr && strcmp(positional[1], "-") != 0 ? positional[1] : nullptr;
+    if(options.threads == 0) {
+        options.threads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+    }
+    if(options.to == nullptr || options.chunk == 0) {
+        return false;
+    }
+    if(options.log_output && options.to->log_convention < 0) {
+        fprintf(stderr, "an AttitudeLog can not hold '%s'\n", options.to->name);
+        return false;
+    }
+    return true;
+}
+
+bool isLog(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if(file == nullptr) {
+        return false;
+    }
+    char magic[8] = {};
+    const bool log = fread(magic, 1, sizeof(magic), file) == sizeof(magic) && memcmp(magic, "TSO3LOG", 8) == 0;
+    fclose(file);
+    return log;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if(!parseOptions(argc, argv, options)) {
+        usage();
+        return 2;
+    }
+
+    // Input
+    std::unique_ptr<MappedFile> mapped;
+    std::unique_ptr<AttitudeLogReader> reader;
+    std::unique_ptr<Input> input;
+    FILE* input_file = stdin;
+    const size_t block_chunks = 4 * options.threads;
+
+    if(options.input != nullptr && isLog(options.input)) {
+        mapped.reset(new MappedFile{options.input});
+        reader.reset(new AttitudeLogReader{mapped->data(), mapped->size()});
+        if(!mapped->valid() || !reader->valid()) {
+            fprintf(stderr, "%s: invalid AttitudeLog\n", options.input);
+            return 1;
+        }
+
+        const Representation* stored = findRepresentation(static_cast<int>(reader->header().convention));
+        DecodeLog decoder = nullptr;
+        switch(reader->header().convention) {
+        case attitude_log_convention<HAMILTON>::value: decoder = logDecoder<HAMILTON>(*reader); break;
+        case attitude_log_convention<JPL>::value: decoder = logDecoder<JPL>(*reader); break;
+        case attitude_log_convention<ACTIVE>::value: decoder = logDecoder<ACTIVE>(*reader); break;
+        case attitude_log_convention<PASSIVE>::value: decoder = logDecoder<PASSIVE>(*reader); break;
+        default: break;
+        }
+        if(decoder == nullptr || (options.from != nullptr && options.from != stored)) {
+            fprintf(stderr, "%s: the AttitudeLog does not hold '%s'\n", options.input, options.from != nullptr ? options.from->name : "a supported representation");
+            return 1;
+        }
+        options.from = stored;
+        options.timestamps = true;
+        input.reset(new LogInput{*reader, decoder, block_chunks});
+    } else {
+        if(options.from == nullptr) {
+            usage();
+            return 2;
+        }
+        if(options.input != nullptr && (input_file = fopen(options.input, "rb")) == nullptr) {
+            fprintf(stderr, "%s: %s\n", options.input, strerror(errno));
+            return 1;
+        }
+        input.reset(new CsvInput{input_file, options.chunk, block_chunks << 20});
+    }
+
+    // Output
+    FILE* output_file = stdout;
+    if(options.output != nullptr && (output_file = fopen(options.output, "wb")) == nullptr) {
+        fprintf(stderr, "%s: %s\n", options.output, strerror(errno));
+        return 1;
+    }
+    std::unique_ptr<Output> output;
+    if(options.log_output) {
+        fflush(output_file);
+        output = logOutput(options.to->log_convention, fileno(output_file), options.timestamps);
+    } else {
+        output.reset(new CsvOutput{output_file});
+    }
+
+    // Convert a block of chunks in parallel, then write them in order.
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<Chunk> chunks;
+    size_t records = 0;
+    int status = 0;
+
+    for(size_t used = input->next(chunks); used > 0 && status == 0; used = input->next(chunks)) {
+        std::atomic<size_t> next{0};
+        auto work = [&]() {
+            for(size_t i = next++; i < used; i = next++) {
+                convert(chunks[i], *input, options);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for(size_t t = 1; t < options.threads && t < used; t++) {
+            workers.emplace_back(work);
+        }
+        work();
+        for(std::thread& worker : workers) {
+            worker.join();
+        }
+
+        for(size_t i = 0; i < used; i++) {
+            if(chunks[i].error_line != 0) {
+                fprintf(stderr, "%s:%zu: expected %zu comma separated values\n", options.input != nullptr ? options.input : "stdin",
+                        chunks[i].error_line, options.from->components + (options.timestamps ? 1 : 0));
+                status = 1;
+                break;
+            }
+            if(!output->write(chunks[i])) {
+                fprintf(stderr, "failed to write the output\n");
+                status = 1;
+                break;
+            }
+            records += chunks[i].count;
+        }
+    }
+
+    if(status == 0 && !output->close()) {
+        fprintf(stderr, "failed to write the output\n");
+        status = 1;
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    fprintf(stderr, "%s -> %s : %zu records in %.3f s, %.0f records/s (%zu threads)\n", options.from->name, options.to->name,
+            records, seconds, seconds > 0.0 ? static_cast<double>(records) / seconds : 0.0, options.threads);
+
+    if(input_file != stdin) {
+        fclose(input_file);
+    }
+    if(output_file != stdout) {
+        fclose(output_file);
+    }
+    return status;
+}